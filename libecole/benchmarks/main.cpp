@@ -0,0 +1,14 @@
+#include <benchmark/benchmark.h>
+
+#include "ecole/random.hpp"
+
+int main(int argc, char** argv) {
+	// Every benchmark also seeds its own random engines, this covers the ones spawned implicitly
+	ecole::seed(0);
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+		return 1;
+	}
+	benchmark::RunSpecifiedBenchmarks();
+	return 0;
+}
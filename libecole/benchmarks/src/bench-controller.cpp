@@ -0,0 +1,46 @@
+#include <memory>
+
+#include <benchmark/benchmark.h>
+#include <scip/scip.h>
+
+#include "ecole/utility/reverse-control.hpp"
+
+using namespace ecole;
+
+namespace {
+
+using utility::Controller;
+
+/**
+ * Time a round trip between the environment and a solving thread that does nothing but wait.
+ *
+ * This is the overhead of the reverse control paid on every transition.
+ */
+void controller_handoff(benchmark::State& state) {
+	// Without a solver, the result of the action function tells the thread when to stop
+	auto controller = Controller{[](std::weak_ptr<Controller::Executor> const& weak_executor) {
+		auto result = SCIP_DIDNOTRUN;
+		while (result != SCIP_DIDNOTFIND) {
+			auto const action_func = weak_executor.lock()->hold_env();
+			action_func(nullptr, &result);
+		}
+	}};
+	controller.wait_thread();
+
+	for (auto _ : state) {
+		controller.resume_thread([](SCIP* /*scip*/, SCIP_RESULT* result) {
+			*result = SCIP_SUCCESS;
+			return SCIP_OKAY;
+		});
+		controller.wait_thread();
+	}
+
+	controller.resume_thread([](SCIP* /*scip*/, SCIP_RESULT* result) {
+		*result = SCIP_DIDNOTFIND;
+		return SCIP_OKAY;
+	});
+	controller.wait_thread();
+}
+BENCHMARK(controller_handoff)->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,58 @@
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+#include <scip/def.h>
+
+#include "ecole/environment/branching.hpp"
+#include "ecole/observation/nodebipartite.hpp"
+#include "ecole/observation/nothing.hpp"
+
+#include "benchmark.hpp"
+
+using namespace ecole;
+using namespace ecole::benchmarks;
+
+namespace {
+
+/** Node limit of the episodes, so that the benchmark remains short on harder instances. */
+constexpr auto node_limit = SCIP_Longint{500};
+
+/**
+ * Time full branching episodes, always branching on the first candidate.
+ *
+ * The environment is seeded before every episode, so that every episode is the same.
+ */
+template <typename ObservationFunction> void branching_episode(benchmark::State& state) {
+	auto const instance = get_instance(state);
+	auto env = environment::Branching<ObservationFunction>{};
+	env.scip_params()["limits/nodes"] = node_limit;
+	auto n_steps = std::size_t{0};
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto model = get_model(instance);
+		env.random_engine().seed(benchmark_seed);
+		state.ResumeTiming();
+
+		auto [obs, action_set, reward, done, info] = env.reset(std::move(model));
+		while (!done) {
+			std::tie(obs, action_set, reward, done, info) = env.step(action_set.value()[0]);
+			++n_steps;
+		}
+		benchmark::DoNotOptimize(obs);
+	}
+	state.counters["steps"] = benchmark::Counter(static_cast<double>(n_steps), benchmark::Counter::kAvgIterations);
+}
+
+void branching_episode_nothing(benchmark::State& state) {
+	branching_episode<observation::Nothing>(state);
+}
+BENCHMARK(branching_episode_nothing)->Apply(all_instances)->Unit(benchmark::kMillisecond);
+
+void branching_episode_node_bipartite(benchmark::State& state) {
+	branching_episode<observation::NodeBipartite>(state);
+}
+BENCHMARK(branching_episode_node_bipartite)->Apply(all_instances)->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include "ecole/observation/khalil-2016.hpp"
+#include "ecole/observation/nodebipartite.hpp"
+#include "ecole/observation/pseudocosts.hpp"
+#include "ecole/observation/strongbranchingscores.hpp"
+
+#include "benchmark.hpp"
+
+using namespace ecole;
+using namespace ecole::benchmarks;
+
+namespace {
+
+/**
+ * Time the extraction of an observation on the root node.
+ *
+ * The model is not modified between extractions, so only the cost of the extraction itself is measured.
+ */
+template <typename ObservationFunction> void extract_on_root_node(benchmark::State& state) {
+	auto model = get_model(get_instance(state));
+	auto obs_func = ObservationFunction{};
+	obs_func.before_reset(model);
+	advance_to_root_node(model);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(obs_func.extract(model, false));
+	}
+}
+
+void node_bipartite_extract(benchmark::State& state) {
+	extract_on_root_node<observation::NodeBipartite>(state);
+}
+BENCHMARK(node_bipartite_extract)->Apply(all_instances)->Unit(benchmark::kMicrosecond);
+
+void khalil_2016_extract(benchmark::State& state) {
+	extract_on_root_node<observation::Khalil2016>(state);
+}
+BENCHMARK(khalil_2016_extract)->Apply(all_instances)->Unit(benchmark::kMicrosecond);
+
+void strong_branching_scores_extract(benchmark::State& state) {
+	extract_on_root_node<observation::StrongBranchingScores>(state);
+}
+BENCHMARK(strong_branching_scores_extract)->Apply(all_instances)->Unit(benchmark::kMillisecond);
+
+void pseudocosts_extract(benchmark::State& state) {
+	extract_on_root_node<observation::Pseudocosts>(state);
+}
+BENCHMARK(pseudocosts_extract)->Apply(all_instances)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
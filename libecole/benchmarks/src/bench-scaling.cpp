@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <scip/def.h>
+
+#include "ecole/environment/branching.hpp"
+#include "ecole/instrumentation.hpp"
+#include "ecole/observation/nothing.hpp"
+#include "ecole/random.hpp"
+
+#include "benchmark.hpp"
+
+using namespace ecole;
+using namespace ecole::benchmarks;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/** Node limit of the episodes, so that all threads do the same amount of work. */
+constexpr auto node_limit = SCIP_Longint{200};
+
+double to_microseconds(Clock::duration duration) {
+	return std::chrono::duration<double, std::micro>{duration}.count();
+}
+
+/** Return the given percentile of unsorted values, or zero if there are none. */
+double percentile(std::vector<double>& values, double fraction) {
+	if (values.empty()) {
+		return 0.;
+	}
+	auto const rank = static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1));
+	std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(rank), values.end());
+	return values[rank];
+}
+
+/**
+ * Transition latencies of all the threads of a benchmark run.
+ *
+ * Every thread adds its latencies once it is done, and the last one computes the percentiles over all of them.
+ */
+struct SharedLatencies {
+	std::mutex mutex;
+	std::vector<double> latencies;
+	int n_threads_done = 0;
+};
+
+/**
+ * Run identical branching episodes in every benchmark thread.
+ *
+ * Each thread copies the instance, creates a new environment, seeds it, and runs an episode, so that the shared parts
+ * of Ecole are all exercised concurrently:
+ * - the copy of the model, protected by a global mutex;
+ * - the spawning of random engines, from a global atomic counter;
+ * - the handoff between the environment and the solving thread, on every transition.
+ *
+ * Reported counters:
+ * - ``steps``, the total throughput in transitions per second;
+ * - ``step_p50_us``, ``step_p90_us``, ``step_p99_us``, latency percentiles of the transitions of all threads;
+ * - ``copy_model_us`` and ``create_env_us``, wall time spent copying the model (including waiting for the copy mutex)
+ *   and creating the environment per episode, averaged over the threads;
+ * - ``handoff_us``, time spent in handoffs per episode averaged over the threads, only when compiled with
+ *   instrumentation.
+ */
+void scaling_branching(benchmark::State& state) {
+	auto const instance = static_cast<Instance>(state.range(0));
+	if (state.thread_index == 0) {
+		state.SetLabel(instance_name(instance));
+	}
+	// Not timed, the first thread creates the original instance
+	std::ignore = get_model(instance);
+	static auto shared = SharedLatencies{};
+
+	auto step_latencies = std::vector<double>{};
+	auto copy_time = Clock::duration{0};
+	auto create_time = Clock::duration{0};
+	auto handoff_time = instrumentation::Clock::duration{0};
+	for (auto _ : state) {
+		auto const copy_start = Clock::now();
+		auto model = get_model(instance);
+		auto const create_start = Clock::now();
+		auto env = environment::Branching<observation::Nothing>{};
+		auto const create_end = Clock::now();
+		copy_time += create_start - copy_start;
+		create_time += create_end - create_start;
+
+		env.scip_params()["limits/nodes"] = node_limit;
+		env.seed(benchmark_seed);
+		auto [obs, action_set, reward, done, info] = env.reset(std::move(model));
+		while (!done) {
+			auto const step_start = Clock::now();
+			std::tie(obs, action_set, reward, done, info) = env.step(action_set.value()[0]);
+			step_latencies.push_back(to_microseconds(Clock::now() - step_start));
+		}
+		handoff_time += env.stats()[instrumentation::Stage::handoff].total;
+	}
+
+	using benchmark::Counter;
+	auto const per_episode = Counter::kAvgIterations | Counter::kAvgThreads;
+	state.counters["steps"] = Counter(static_cast<double>(step_latencies.size()), Counter::kIsRate);
+	{
+		auto const lk = std::lock_guard{shared.mutex};
+		shared.latencies.insert(shared.latencies.end(), step_latencies.begin(), step_latencies.end());
+		// Counters are summed over the threads, so only the last thread sets the percentiles
+		if (++shared.n_threads_done == state.threads) {
+			state.counters["step_p50_us"] = percentile(shared.latencies, 0.5);   // NOLINT(readability-magic-numbers)
+			state.counters["step_p90_us"] = percentile(shared.latencies, 0.9);   // NOLINT(readability-magic-numbers)
+			state.counters["step_p99_us"] = percentile(shared.latencies, 0.99);  // NOLINT(readability-magic-numbers)
+			shared.latencies.clear();
+			shared.n_threads_done = 0;
+		}
+	}
+	state.counters["copy_model_us"] = Counter(to_microseconds(copy_time), per_episode);
+	state.counters["create_env_us"] = Counter(to_microseconds(create_time), per_episode);
+	if constexpr (instrumentation::enabled) {
+		state.counters["handoff_us"] = Counter(to_microseconds(handoff_time), per_episode);
+	}
+}
+
+/** Run from one thread to the number of cores, doubling every time. */
+void thread_range(benchmark::internal::Benchmark* bench) {
+	auto const n_cores = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+	bench->ThreadRange(1, n_cores);
+	for (auto const instance : generated_instances) {
+		bench->Arg(static_cast<std::int64_t>(instance));
+	}
+	bench->Arg(static_cast<std::int64_t>(Instance::bppc8));
+}
+BENCHMARK(scaling_branching)->Apply(thread_range)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+
+#include "ecole/scip/model.hpp"
+
+#include "benchmark.hpp"
+
+using namespace ecole;
+using namespace ecole::benchmarks;
+
+namespace {
+
+void model_from_file(benchmark::State& state) {
+	auto const* const filename = instance_file(get_instance(state));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(scip::Model::from_file(filename));
+	}
+}
+BENCHMARK(model_from_file)->Apply(all_file_instances)->Unit(benchmark::kMillisecond);
+
+void model_copy_orig(benchmark::State& state) {
+	auto const model = get_model(get_instance(state));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(model.copy_orig());
+	}
+}
+BENCHMARK(model_copy_orig)->Apply(all_instances)->Unit(benchmark::kMillisecond);
+
+}  // namespace
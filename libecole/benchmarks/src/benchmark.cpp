@@ -0,0 +1,99 @@
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/combinatorial-auction.hpp"
+#include "ecole/instance/set-cover.hpp"
+
+#include "benchmark.hpp"
+
+namespace ecole::benchmarks {
+
+namespace {
+
+/** Smaller than the generators default so that full episodes remain short. */
+scip::Model generate(Instance instance) {
+	auto random_engine = RandomEngine{benchmark_seed};
+	switch (instance) {
+	case Instance::set_cover:
+		return ecole::instance::SetCoverGenerator::generate_instance({250, 500}, random_engine);  // NOLINT
+	case Instance::combinatorial_auction:
+		return ecole::instance::CombinatorialAuctionGenerator::generate_instance({50, 250}, random_engine);  // NOLINT
+	default:
+		return scip::Model::from_file(instance_file(instance));
+	}
+}
+
+}  // namespace
+
+char const* instance_name(Instance instance) {
+	switch (instance) {
+	case Instance::bppc8:
+		return "bppc8-02";
+	case Instance::enlight8:
+		return "enlight8";
+	case Instance::set_cover:
+		return "set_cover";
+	case Instance::combinatorial_auction:
+		return "combinatorial_auction";
+	}
+	return "";
+}
+
+char const* instance_file(Instance instance) {
+	switch (instance) {
+	case Instance::bppc8:
+		return TEST_DATA_DIR "/bppc8-02.mps";
+	case Instance::enlight8:
+		return TEST_DATA_DIR "/enlight8.mps";
+	default:
+		throw Exception("Instance is not read from a file");
+	}
+}
+
+scip::Model get_model(Instance instance) {
+	// Instances are kept in their original state and copied for every use
+	static auto originals = std::map<Instance, scip::Model>{};
+	static auto originals_mutex = std::mutex{};
+	auto const& original = [instance]() -> scip::Model const& {
+		auto const lk = std::lock_guard{originals_mutex};
+		auto iter = originals.find(instance);
+		if (iter == originals.end()) {
+			iter = originals.emplace(instance, generate(instance)).first;
+		}
+		return iter->second;
+	}();
+	// Not under the lock, so that concurrent benchmarks only contend in Ecole
+	auto model = original.copy_orig();
+	model.disable_cuts();
+	model.disable_presolve();
+	return model;
+}
+
+void advance_to_root_node(scip::Model& model) {
+	model.solve_iter();
+}
+
+void all_instances(::benchmark::internal::Benchmark* bench) {
+	for (auto const instance : file_instances) {
+		bench->Arg(static_cast<std::int64_t>(instance));
+	}
+	for (auto const instance : generated_instances) {
+		bench->Arg(static_cast<std::int64_t>(instance));
+	}
+}
+
+void all_file_instances(::benchmark::internal::Benchmark* bench) {
+	for (auto const instance : file_instances) {
+		bench->Arg(static_cast<std::int64_t>(instance));
+	}
+}
+
+Instance get_instance(::benchmark::State& state) {
+	auto const instance = static_cast<Instance>(state.range(0));
+	state.SetLabel(instance_name(instance));
+	return instance;
+}
+
+}  // namespace ecole::benchmarks
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+
+#ifndef TEST_DATA_DIR
+#error "Need to define TEST_DATA_DIR."
+#endif
+
+namespace ecole::benchmarks {
+
+/** Seed of everything random in the benchmarks, so that results can be compared between runs. */
+inline constexpr Seed benchmark_seed = 0;
+
+/**
+ * The instances on which benchmarks are run.
+ *
+ * Instances are given to benchmarks as their first argument.
+ */
+enum struct Instance : std::int64_t {
+	bppc8 = 0,
+	enlight8,
+	set_cover,
+	combinatorial_auction,
+};
+
+/** Instances read from the test data files. */
+inline constexpr Instance file_instances[] = {Instance::bppc8, Instance::enlight8};  // NOLINT
+
+/** Instances generated with Ecole generators. */
+inline constexpr Instance generated_instances[] = {Instance::set_cover, Instance::combinatorial_auction};  // NOLINT
+
+[[nodiscard]] char const* instance_name(Instance instance);
+
+/**
+ * Path of an instance read from file.
+ */
+[[nodiscard]] char const* instance_file(Instance instance);
+
+/**
+ * Return a new copy of an instance.
+ *
+ * As in the tests, presolving and cuts are disabled.
+ * Generated instances are created once, with the benchmark seed.
+ * Can be called from many threads.
+ */
+[[nodiscard]] scip::Model get_model(Instance instance);
+
+/**
+ * Solve a model until the first branching decision.
+ */
+void advance_to_root_node(scip::Model& model);
+
+/**
+ * Run a benchmark on every instance.
+ */
+void all_instances(::benchmark::internal::Benchmark* bench);
+
+/**
+ * Run a benchmark on the instances read from file.
+ */
+void all_file_instances(::benchmark::internal::Benchmark* bench);
+
+/**
+ * Return the instance of the benchmark, and label the benchmark with its name.
+ */
+[[nodiscard]] Instance get_instance(::benchmark::State& state);
+
+}  // namespace ecole::benchmarks
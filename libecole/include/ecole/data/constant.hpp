@@ -8,6 +8,9 @@ namespace ecole::data {
 
 template <typename Data> class ConstantFunction : public DataFunction<Data> {
 public:
+	/** Extraction only reads the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
 	ConstantFunction() = default;
 	ConstantFunction(Data data_) : data{std::move(data_)} {}
 
@@ -7,6 +7,9 @@ namespace ecole::data {
 
 class NoneFunction : public DataFunction<NoneType> {
 public:
+	/** Extraction only reads the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
 	NoneType extract(scip::Model& /* model */, bool /* done */) override { return ecole::None; }
 };
 
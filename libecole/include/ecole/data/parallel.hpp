@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ecole/data/abstract.hpp"
+#include "ecole/traits.hpp"
+#include "ecole/utility/thread-pool.hpp"
+
+namespace ecole::data {
+
+/**
+ * Like TupleFunction, but running the read-only functions concurrently.
+ *
+ * Functions marked as read-only (see trait::is_read_only_data_function) are extracted on a thread pool.
+ * Other functions, which may modify the model, are extracted on the calling thread once all the functions before them
+ * have finished, and before the functions after them start.
+ * Every function thus sees the model in the same state as with a TupleFunction.
+ */
+template <typename... Functions>
+class ParallelTupleFunction : public DataFunction<std::tuple<trait::data_of_t<Functions>...>> {
+public:
+	using DataTuple = std::tuple<trait::data_of_t<Functions>...>;
+
+	/** The number of functions run on the thread pool. */
+	static constexpr std::size_t n_read_only = (std::size_t{0} + ... + trait::is_read_only_data_function_v<Functions>);
+
+	/** Default construct all functions, with a thread per read-only function. */
+	ParallelTupleFunction() : ParallelTupleFunction{make_thread_pool(), std::tuple<Functions...>{}} {}
+
+	/** Store a copy of the functions, with a thread per read-only function. */
+	ParallelTupleFunction(Functions... functions) :
+		ParallelTupleFunction{make_thread_pool(), std::tuple<Functions...>{std::move(functions)...}} {}
+
+	/**
+	 * Store a copy of the functions, extracting the read-only ones on the given thread pool.
+	 *
+	 * The pool can be shared, for instance between the observation functions of multiple environments.
+	 */
+	ParallelTupleFunction(std::shared_ptr<utility::ThreadPool> thread_pool_, std::tuple<Functions...> functions) :
+		data_functions{std::move(functions)}, thread_pool{std::move(thread_pool_)} {}
+
+	/** Call before_reset on all functions, in order on the calling thread. */
+	void before_reset(scip::Model& model) override {
+		std::apply([&model](auto&... functions) { ((functions.before_reset(model)), ...); }, data_functions);
+	}
+
+	/** Return data from all functions as a tuple. */
+	DataTuple extract(scip::Model& model, bool done) override {
+		return extract_all(model, done, std::index_sequence_for<Functions...>{});
+	}
+
+private:
+	std::tuple<Functions...> data_functions;
+	std::shared_ptr<utility::ThreadPool> thread_pool;
+
+	static auto make_thread_pool() -> std::shared_ptr<utility::ThreadPool> {
+		if constexpr (n_read_only > 0) {
+			return std::make_shared<utility::ThreadPool>(n_read_only);
+		} else {
+			return nullptr;
+		}
+	}
+
+	/** Wait for all the tasks before rethrowing the first exception, as they reference the caller's data. */
+	static void join(std::vector<std::future<void>>& pending) {
+		for (auto& task : pending) {
+			task.wait();
+		}
+		auto tasks = std::move(pending);
+		pending.clear();
+		for (auto& task : tasks) {
+			task.get();
+		}
+	}
+
+	template <std::size_t... I>
+	DataTuple extract_all(scip::Model& model, bool done, std::index_sequence<I...> /*unused*/) {
+		auto data = std::tuple<std::optional<trait::data_of_t<Functions>>...>{};
+		auto pending = std::vector<std::future<void>>{};
+		pending.reserve(n_read_only);
+
+		auto const extract_one = [&](auto& function, auto& datum) {
+			using Function = std::decay_t<decltype(function)>;
+			if constexpr (trait::is_read_only_data_function_v<Function>) {
+				pending.push_back(
+					thread_pool->submit([&function, &datum, &model, done] { datum.emplace(function.extract(model, done)); }));
+			} else {
+				join(pending);
+				datum.emplace(function.extract(model, done));
+			}
+		};
+
+		try {
+			(extract_one(std::get<I>(data_functions), std::get<I>(data)), ...);
+			join(pending);
+		} catch (...) {
+			for (auto& task : pending) {
+				task.wait();
+			}
+			throw;
+		}
+		return DataTuple{std::move(std::get<I>(data)).value()...};
+	}
+};
+
+}  // namespace ecole::data
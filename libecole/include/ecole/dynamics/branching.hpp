@@ -1,25 +1,105 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <vector>
 
+#include <nonstd/span.hpp>
 #include <xtensor/xtensor.hpp>
 
 #include "ecole/dynamics/dynamics.hpp"
 
 namespace ecole::dynamics {
 
-class BranchingDynamics : public EnvironmentDynamics<std::size_t, std::optional<xt::xtensor<std::size_t, 1>>> {
+/**
+ * Branch on a variable of the focus node, chosen among the branching candidates.
+ *
+ * The action set is a view of LP column indices, into a buffer reused between transitions.
+ */
+class BranchingDynamics : public EnvironmentDynamics<std::size_t, std::optional<nonstd::span<std::size_t const>>> {
 public:
-	using ActionSet = std::optional<xt::xtensor<std::size_t, 1>>;
+	/** A view valid until the next transition. */
+	using ActionSet = std::optional<nonstd::span<std::size_t const>>;
 
 	bool pseudo_candidates;
 
-	BranchingDynamics(bool pseudo_candidates = false) noexcept;
+	BranchingDynamics(bool pseudo_candidates = false);
 
 	std::tuple<bool, ActionSet> reset_dynamics(scip::Model& model) override;
 
 	std::tuple<bool, ActionSet> step_dynamics(scip::Model& model, std::size_t const& action) override;
+
+	/**
+	 * The branching candidates, as LP column indices.
+	 *
+	 * The view is into a buffer overwritten on the next transition.
+	 */
+	[[nodiscard]] nonstd::span<std::size_t const> candidate_indices() const noexcept {
+		return {cand_cols->data(), n_cands};
+	}
+
+	/**
+	 * One element per LP column, set to one for branching candidates and zero otherwise.
+	 *
+	 * The view is into a buffer updated in place on the next transition.
+	 * It is meant for masking the policy outputs without converting the action set.
+	 */
+	[[nodiscard]] nonstd::span<std::int32_t const> candidate_mask() const noexcept {
+		return {cand_mask->data(), n_lp_cols};
+	}
+
+	/**
+	 * The buffers behind the views.
+	 *
+	 * Buffers are replaced, rather than reallocated, when they need to grow, so that sharing their ownership keeps
+	 * views valid (although overwritten), for instance in NumPy arrays.
+	 */
+	[[nodiscard]] std::shared_ptr<std::vector<std::size_t> const> candidate_indices_buffer() const noexcept {
+		return cand_cols;
+	}
+	[[nodiscard]] std::shared_ptr<std::vector<std::int32_t> const> candidate_mask_buffer() const noexcept {
+		return cand_mask;
+	}
+
+private:
+	std::shared_ptr<std::vector<std::size_t>> cand_cols = std::make_shared<std::vector<std::size_t>>();
+	std::shared_ptr<std::vector<std::int32_t>> cand_mask = std::make_shared<std::vector<std::int32_t>>();
+	std::size_t n_cands = 0;
+	std::size_t n_lp_cols = 0;
+
+	ActionSet update_candidates(scip::Model const& model, bool done);
+};
+
+/**
+ * Branching dynamics where one action is reused over many nodes.
+ *
+ * The action is a ranking of LP column indices, from the highest to the lowest priority.
+ * The node is branched on the highest ranked candidate.
+ * The following nodes are branched the same way, without returning to the agent, as long as all their branching
+ * candidates are in the ranking, and for at most refresh_interval nodes in total (or without limit if zero).
+ */
+class BatchedBranchingDynamics :
+	public EnvironmentDynamics<xt::xtensor<std::size_t, 1>, std::optional<xt::xtensor<std::size_t, 1>>> {
+public:
+	using Action = xt::xtensor<std::size_t, 1>;
+	using ActionSet = std::optional<xt::xtensor<std::size_t, 1>>;
+
+	bool pseudo_candidates;
+	std::size_t refresh_interval;
+
+	BatchedBranchingDynamics(bool pseudo_candidates = false, std::size_t refresh_interval = 16) noexcept;
+
+	std::tuple<bool, ActionSet> reset_dynamics(scip::Model& model) override;
+
+	std::tuple<bool, ActionSet> step_dynamics(scip::Model& model, Action const& action) override;
+
+	/** Number of nodes branched during the last transition. */
+	[[nodiscard]] std::size_t n_last_branchings() const noexcept { return n_branchings; }
+
+private:
+	std::size_t n_branchings = 0;
 };
 
 }  // namespace ecole::dynamics
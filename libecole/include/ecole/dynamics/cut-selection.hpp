@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/dynamics/dynamics.hpp"
+
+namespace ecole::dynamics {
+
+/**
+ * Select the cuts added to the LP among the cuts found by the separators.
+ *
+ * The solver pauses at every separation round where the separators have found cuts.
+ * The action set holds the indices of the cuts in Model::cuts (the separation storage).
+ * The action is a mask with one element per cut, where the cuts to add to the LP are true.
+ */
+class CutSelectionDynamics :
+	public EnvironmentDynamics<xt::xtensor<bool, 1>, std::optional<xt::xtensor<std::size_t, 1>>> {
+public:
+	using Action = xt::xtensor<bool, 1>;
+	using ActionSet = std::optional<xt::xtensor<std::size_t, 1>>;
+
+	std::tuple<bool, ActionSet> reset_dynamics(scip::Model& model) override;
+
+	std::tuple<bool, ActionSet> step_dynamics(scip::Model& model, Action const& action) override;
+};
+
+}  // namespace ecole::dynamics
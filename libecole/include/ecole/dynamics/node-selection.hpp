@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/dynamics/dynamics.hpp"
+#include "ecole/scip/type.hpp"
+
+namespace ecole::dynamics {
+
+/**
+ * Select the next node to process in the branch-and-bound tree.
+ *
+ * The open nodes are stored, in a buffer reused between transitions, as the leaves, then the children, and then the
+ * siblings of the current node (the order of SCIPgetOpenNodesData).
+ * The action set holds the indices of the open nodes in that buffer, and the action is one of these indices.
+ */
+class NodeSelectionDynamics : public EnvironmentDynamics<std::size_t, std::optional<xt::xtensor<std::size_t, 1>>> {
+public:
+	using ActionSet = std::optional<xt::xtensor<std::size_t, 1>>;
+
+	std::tuple<bool, ActionSet> reset_dynamics(scip::Model& model) override;
+
+	std::tuple<bool, ActionSet> step_dynamics(scip::Model& model, std::size_t const& action) override;
+
+	/** The open nodes indexed by the last action set. */
+	[[nodiscard]] std::vector<scip::Node*> const& open_nodes() const noexcept { return nodes; }
+
+private:
+	std::vector<scip::Node*> nodes;
+
+	ActionSet action_set(scip::Model const& model);
+};
+
+}  // namespace ecole::dynamics
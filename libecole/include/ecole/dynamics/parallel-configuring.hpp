@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/param-set.hpp"
+
+namespace ecole::utility {
+class ThreadPool;
+}
+
+namespace ecole::dynamics {
+
+/**
+ * Solve many configurations of the same problem concurrently.
+ *
+ * Every Model is solved with its own ParamSet on a pool of threads.
+ * With racing enabled, once a first run is solved in time t, the runs still going after race_factor * t (measured
+ * from their own start) are interrupted, as they can no longer be competitive in solving time.
+ */
+class ParallelConfiguringDynamics {
+public:
+	/** A function called in the worker thread with the index of the run. */
+	using Hook = std::function<void(std::size_t)>;
+
+	/**
+	 * Create the pool of threads.
+	 *
+	 * @param n_threads The number of concurrent solves, or the hardware concurrency if zero.
+	 * @param race_factor If set, interrupt runs slower than this factor times the fastest run.
+	 */
+	ParallelConfiguringDynamics(std::size_t n_threads = 0, std::optional<double> race_factor = {});
+	ParallelConfiguringDynamics(ParallelConfiguringDynamics&&) noexcept;
+	~ParallelConfiguringDynamics();
+
+	ParallelConfiguringDynamics& operator=(ParallelConfiguringDynamics&&) noexcept;
+
+	/**
+	 * Set random elements of the dynamics, as done by the other environment dynamics.
+	 */
+	void set_dynamics_random_state(scip::Model& model, RandomEngine& random_engine);
+
+	/**
+	 * Apply every ParamSet on its Model and solve all models concurrently.
+	 *
+	 * @param models The models to solve, all distincts.
+	 * @param param_sets The configuration used for every model.
+	 * @param before_solve Called in the worker thread before parameters are applied.
+	 * @param after_solve Called in the worker thread after the model is solved or interrupted.
+	 * @return For every run, whether it completed (i.e. was not eliminated by racing).
+	 */
+	std::vector<bool> solve_all(
+		std::vector<scip::Model*> const& models,
+		std::vector<scip::ParamSet> const& param_sets,
+		Hook const& before_solve = {},
+		Hook const& after_solve = {});
+
+	[[nodiscard]] std::optional<double> race_factor() const noexcept { return the_race_factor; }
+
+private:
+	std::unique_ptr<utility::ThreadPool> thread_pool;
+	std::optional<double> the_race_factor;
+};
+
+}  // namespace ecole::dynamics
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ecole/dynamics/dynamics.hpp"
+
+namespace ecole::dynamics {
+
+/**
+ * Schedule the primal heuristics run at the nodes of the branch-and-bound tree.
+ *
+ * The solver pauses before processing nodes whose depth is a multiple of the frequency.
+ * The action set is the names of the heuristics that can be scheduled, in the order of Model::heuristics.
+ * The action maps heuristic names to an effort budget: heuristics that are omitted or with a non positive budget do
+ * not run, the others are run at every node until the next decision.
+ * The budget is used as the ``maxlpiterquot`` of diving heuristics and the ``nodesquot`` of large neighborhood search
+ * heuristics, which bound their LP iterations and sub-SCIP nodes relatively to the main search.
+ */
+class PrimalHeuristicDynamics :
+	public EnvironmentDynamics<std::map<std::string, double>, std::optional<std::vector<std::string>>> {
+public:
+	using Action = std::map<std::string, double>;
+	using ActionSet = std::optional<std::vector<std::string>>;
+
+	int frequency;
+
+	PrimalHeuristicDynamics(int frequency = 1) noexcept;
+
+	std::tuple<bool, ActionSet> reset_dynamics(scip::Model& model) override;
+
+	std::tuple<bool, ActionSet> step_dynamics(scip::Model& model, Action const& action) override;
+};
+
+}  // namespace ecole::dynamics
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "ecole/dynamics/dynamics.hpp"
+#include "ecole/none.hpp"
+#include "ecole/scip/param-set.hpp"
+#include "ecole/scip/type.hpp"
+
+namespace ecole::utility {
+class ThreadPool;
+}
+
+namespace ecole::dynamics {
+
+/**
+ * Race many configurations of the solver and keep the best one.
+ *
+ * The action is a list of candidate configurations.
+ * Every configuration is applied on its own copy of the instance and all copies are solved in lockstep time slices.
+ * After every slice, the candidates are compared on their primal-dual gap and only the best fraction is resumed.
+ * The race stops as soon as a candidate finishes solving, or when only one candidate remains, which is then solved
+ * to completion.
+ * At the end of the step, the Model given to the dynamics is replaced by the winning copy, so that reward and
+ * observation functions apply to the winner.
+ */
+class RacingConfiguringDynamics : public EnvironmentDynamics<std::vector<scip::ParamSet>, NoneType> {
+public:
+	/**
+	 * Configure the race.
+	 *
+	 * @param time_slice The wall clock time, in seconds, given to the candidates between every comparison.
+	 * @param keep_fraction The fraction of candidates resumed after every comparison (at least one is kept).
+	 * @param n_threads The number of concurrent solves, or the hardware concurrency if zero.
+	 */
+	RacingConfiguringDynamics(scip::real time_slice = 1., scip::real keep_fraction = 0.5, std::size_t n_threads = 0);
+	RacingConfiguringDynamics(RacingConfiguringDynamics&&) noexcept;
+	~RacingConfiguringDynamics() override;
+
+	RacingConfiguringDynamics& operator=(RacingConfiguringDynamics&&) noexcept;
+
+	std::tuple<bool, NoneType> reset_dynamics(scip::Model& model) override;
+	std::tuple<bool, NoneType> step_dynamics(scip::Model& model, std::vector<scip::ParamSet> const& param_sets) override;
+
+	/** Index, in the last action, of the configuration that won the race. */
+	[[nodiscard]] std::size_t winner() const noexcept { return the_winner; }
+	/** Number of time slices run in the last race. */
+	[[nodiscard]] std::size_t n_rounds() const noexcept { return the_n_rounds; }
+
+	[[nodiscard]] scip::real time_slice() const noexcept { return the_time_slice; }
+	[[nodiscard]] scip::real keep_fraction() const noexcept { return the_keep_fraction; }
+
+private:
+	std::unique_ptr<utility::ThreadPool> thread_pool;
+	scip::real the_time_slice;
+	scip::real the_keep_fraction;
+	std::size_t the_winner = 0;
+	std::size_t the_n_rounds = 0;
+};
+
+}  // namespace ecole::dynamics
@@ -14,4 +14,11 @@ template <
 	typename InformationFunction = information::Nothing>
 using Branching = Environment<dynamics::BranchingDynamics, ObservationFunction, RewardFunction, InformationFunction>;
 
+template <
+	typename ObservationFunction = observation::NodeBipartite,
+	typename RewardFunction = reward::IsDone,
+	typename InformationFunction = information::Nothing>
+using BatchedBranching =
+	Environment<dynamics::BatchedBranchingDynamics, ObservationFunction, RewardFunction, InformationFunction>;
+
 }  // namespace ecole::environment
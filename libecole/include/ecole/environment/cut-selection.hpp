@@ -0,0 +1,18 @@
+#pragma once
+
+#include "ecole/dynamics/cut-selection.hpp"
+#include "ecole/environment/environment.hpp"
+#include "ecole/information/nothing.hpp"
+#include "ecole/observation/cutpool.hpp"
+#include "ecole/reward/isdone.hpp"
+
+namespace ecole::environment {
+
+template <
+	typename ObservationFunction = observation::CutPool,
+	typename RewardFunction = reward::IsDone,
+	typename InformationFunction = information::Nothing>
+using CutSelection =
+	Environment<dynamics::CutSelectionDynamics, ObservationFunction, RewardFunction, InformationFunction>;
+
+}  // namespace ecole::environment
@@ -9,6 +9,7 @@
 #include "ecole/dynamics/dynamics.hpp"
 #include "ecole/exception.hpp"
 #include "ecole/information/abstract.hpp"
+#include "ecole/instrumentation.hpp"
 #include "ecole/random.hpp"
 #include "ecole/reward/abstract.hpp"
 #include "ecole/scip/model.hpp"
@@ -98,6 +99,9 @@ public:
 	auto reset(scip::Model&& new_model, Args&&... args)
 		-> std::tuple<Observation, ActionSet, Reward, bool, InformationMap> {
 		can_transition = true;
+		the_stats.clear();
+		ECOLE_RECORD_SCOPE(the_stats);
+		ECOLE_TIME_SCOPE(instrumentation::Stage::reset);
 		try {
 			// Create clean new Model
 			model() = std::move(new_model);
@@ -108,16 +112,11 @@ public:
 			observation_function().before_reset(model());
 			reward_function().before_reset(model());
 			information_function().before_reset(model());
-			auto const [done, action_set] = dynamics().reset_dynamics(model(), std::forward<Args>(args)...);
+			// Not const so that the action set is moved in the returned tuple
+			auto [done, action_set] = dynamics().reset_dynamics(model(), std::forward<Args>(args)...);
 
 			can_transition = !done;
-			return {
-				observation_function().extract(model(), done),
-				std::move(action_set),
-				reward_function().extract(model(), done),
-				done,
-				information_function().extract(model(), done),
-			};
+			return extract_transition(done, std::move(action_set));
 		} catch (std::exception const&) {
 			can_transition = false;
 			throw;
@@ -157,17 +156,13 @@ public:
 		if (!can_transition) {
 			throw Exception("Environment need to be reset.");
 		}
+		ECOLE_RECORD_SCOPE(the_stats);
+		ECOLE_TIME_SCOPE(instrumentation::Stage::step);
 		try {
-			auto const [done, action_set] = dynamics().step_dynamics(model(), action, std::forward<Args>(args)...);
+			auto [done, action_set] = dynamics().step_dynamics(model(), action, std::forward<Args>(args)...);
 			can_transition = !done;
 
-			return {
-				observation_function().extract(model(), done),
-				std::move(action_set),
-				reward_function().extract(model(), done),
-				done,
-				information_function().extract(model(), done),
-			};
+			return extract_transition(done, std::move(action_set));
 		} catch (std::exception const&) {
 			can_transition = false;
 			throw;
@@ -182,6 +177,11 @@ public:
 	auto& scip_params() { return the_scip_params; }
 	auto& random_engine() { return the_random_engine; }
 
+	/**
+	 * Timers of the current episode, only filled when compiled with instrumentation.
+	 */
+	[[nodiscard]] instrumentation::EpisodeStats const& stats() const noexcept { return the_stats; }
+
 private:
 	Dynamics the_dynamics;
 	scip::Model the_model;
@@ -190,7 +190,21 @@ private:
 	InformationFunction the_information_function;
 	std::map<std::string, scip::Param> the_scip_params;
 	RandomEngine the_random_engine;
+	instrumentation::EpisodeStats the_stats;
 	bool can_transition = false;
+
+	auto extract_transition(bool done, ActionSet&& action_set)
+		-> std::tuple<Observation, ActionSet, Reward, bool, InformationMap> {
+		using instrumentation::Stage;
+		using instrumentation::timed;
+		return {
+			timed(Stage::observation, [&] { return observation_function().extract(model(), done); }),
+			std::move(action_set),
+			timed(Stage::reward, [&] { return reward_function().extract(model(), done); }),
+			done,
+			timed(Stage::information, [&] { return information_function().extract(model(), done); }),
+		};
+	}
 };
 
 }  // namespace ecole::environment
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ecole/random.hpp"
+#include "ecole/reward/abstract.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/watchdog.hpp"
+#include "ecole/utility/work-stealing.hpp"
+
+namespace ecole::environment {
+
+/**
+ * Evaluate a policy on many episodes, in parallel.
+ *
+ * Episodes are scheduled on threads stealing work from each other, so that cores do not stay idle when solving times
+ * are heterogeneous.
+ * Every thread runs its episodes in its own environment, and the metrics of every episode are reported as soon as it
+ * finishes.
+ * Episodes are seeded independently of the thread running them, so results do not depend on the number of threads.
+ *
+ * @tparam Environment The ecole::environment::Environment used to run the episodes.
+ */
+template <typename Environment> class EpisodeRunner {
+public:
+	using Seed = ecole::Seed;
+	using Observation = typename Environment::Observation;
+	using Action = typename Environment::Action;
+	using ActionSet = typename Environment::ActionSet;
+	using Reward = reward::Reward;
+	using Clock = std::chrono::steady_clock;
+
+	/** Create a new environment, called once by every thread. */
+	using EnvironmentFactory = std::function<Environment()>;
+	/** Return the problem instance of an episode, called concurrently by the threads. */
+	using InstanceSource = std::function<scip::Model(std::size_t episode)>;
+	/**
+	 * Choose the action to take, called concurrently by the threads.
+	 *
+	 * Policies that benefit from batching (e.g. a neural network) can forward the queries to a
+	 * ecole::policy::PolicyBridge.
+	 */
+	using Policy = std::function<Action(Observation const&, ActionSet const&)>;
+
+	struct Options {
+		/** The number of concurrent episodes, or the hardware concurrency if zero. */
+		std::size_t n_threads = 0;
+		/** If set, episodes taking longer are interrupted, including the time spent in the policy. */
+		std::optional<Clock::duration> time_limit = {};
+		/** Episode ``i`` is run with the environment seeded with ``seed + i``. */
+		Seed seed = 0;
+	};
+
+	struct EpisodeResult {
+		std::size_t episode = 0;
+		/** The index of the thread that ran the episode. */
+		std::size_t thread = 0;
+		/** The sum of the rewards of the episode, including the one returned on reset. */
+		Reward cumulative_reward = 0;
+		std::size_t n_steps = 0;
+		/** Whether the episode reached a terminal state, including after being interrupted. */
+		bool done = false;
+		bool time_limit_reached = false;
+		Clock::duration wall_time = {};
+		/** The exception thrown during the episode, in which case the other metrics are partial. */
+		std::exception_ptr error = nullptr;
+	};
+
+	/** Called as every episode finishes, never concurrently. */
+	using Callback = std::function<void(EpisodeResult const&)>;
+
+	EpisodeRunner(EnvironmentFactory environment_factory, Policy policy, Options options = {}) :
+		the_environment_factory{std::move(environment_factory)}, the_policy{std::move(policy)}, the_options{options} {}
+
+	/**
+	 * Run the given number of episodes, streaming their results to the callback.
+	 *
+	 * Errors inside an episode are reported in its result, while errors from the callback stop the evaluation and
+	 * are rethrown.
+	 */
+	void run(InstanceSource const& instance_source, std::size_t n_episodes, Callback const& callback);
+
+	/**
+	 * Run the given number of episodes and return their results, ordered by episode.
+	 */
+	auto run(InstanceSource const& instance_source, std::size_t n_episodes) -> std::vector<EpisodeResult>;
+
+	[[nodiscard]] auto options() const noexcept -> Options const& { return the_options; }
+
+private:
+	EnvironmentFactory the_environment_factory;
+	Policy the_policy;
+	Options the_options;
+
+	auto run_episode(
+		Environment& env,
+		InstanceSource const& instance_source,
+		std::size_t episode,
+		std::optional<scip::Watchdog>& watchdog) -> EpisodeResult;
+};
+
+/*************************************
+ *  Implementation of EpisodeRunner  *
+ *************************************/
+
+template <typename Environment>
+void EpisodeRunner<Environment>::run(
+	InstanceSource const& instance_source,
+	std::size_t n_episodes,
+	Callback const& callback) {
+	auto n_threads = the_options.n_threads;
+	if (n_threads == 0) {
+		n_threads = std::max(std::thread::hardware_concurrency(), 1U);
+	}
+	// Environments are created lazily by their thread, as there may be fewer episodes than threads
+	auto environments = std::vector<std::optional<Environment>>(n_threads);
+	auto watchdog = std::optional<scip::Watchdog>{};
+	if (the_options.time_limit.has_value()) {
+		watchdog.emplace();
+	}
+	auto callback_mutex = std::mutex{};
+
+	utility::run_work_stealing(n_episodes, n_threads, [&](std::size_t episode, std::size_t thread) {
+		auto& env = environments[thread];
+		auto result = EpisodeResult{};
+		try {
+			if (!env.has_value()) {
+				env.emplace(the_environment_factory());
+			}
+			result = run_episode(env.value(), instance_source, episode, watchdog);
+		} catch (...) {
+			result.episode = episode;
+			result.error = std::current_exception();
+		}
+		result.thread = thread;
+		auto const lk = std::lock_guard{callback_mutex};
+		callback(result);
+	});
+}
+
+template <typename Environment>
+auto EpisodeRunner<Environment>::run(InstanceSource const& instance_source, std::size_t n_episodes)
+	-> std::vector<EpisodeResult> {
+	auto results = std::vector<EpisodeResult>(n_episodes);
+	run(instance_source, n_episodes, [&results](EpisodeResult const& result) { results[result.episode] = result; });
+	return results;
+}
+
+template <typename Environment>
+auto EpisodeRunner<Environment>::run_episode(
+	Environment& env,
+	InstanceSource const& instance_source,
+	std::size_t episode,
+	std::optional<scip::Watchdog>& watchdog) -> EpisodeResult {
+	auto const start = Clock::now();
+	auto result = EpisodeResult{};
+	result.episode = episode;
+	env.seed(static_cast<Seed>(the_options.seed + episode));
+
+	auto model = instance_source(episode);
+	// Watched before being moved in the environment, and unwatched before the model is reset in the next episode
+	auto deadline = std::optional<scip::Watchdog::Deadline>{};
+	if (watchdog.has_value()) {
+		deadline.emplace(watchdog->watch(model, the_options.time_limit.value()));
+	}
+	auto const expired = [&deadline] { return deadline.has_value() && deadline->expired(); };
+
+	auto observation = Observation{};
+	auto action_set = ActionSet{};
+	auto reward = Reward{};
+	auto done = false;
+	try {
+		std::tie(observation, action_set, reward, done, std::ignore) = env.reset(std::move(model));
+		result.cumulative_reward += reward;
+		// The interrupted solve normally ends the episode, unless the dynamics do not resume SCIP on every step
+		while (!done && !expired()) {
+			auto const action = the_policy(observation, action_set);
+			std::tie(observation, action_set, reward, done, std::ignore) = env.step(action);
+			result.cumulative_reward += reward;
+			++result.n_steps;
+		}
+	} catch (...) {
+		result.error = std::current_exception();
+	}
+	result.done = done;
+	result.time_limit_reached = expired();
+	result.wall_time = Clock::now() - start;
+	return result;
+}
+
+}  // namespace ecole::environment
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ecole/data/parser.hpp"
+#include "ecole/dynamics/parallel-configuring.hpp"
+#include "ecole/random.hpp"
+#include "ecole/reward/abstract.hpp"
+#include "ecole/reward/isdone.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/param-set.hpp"
+#include "ecole/scip/type.hpp"
+
+namespace ecole::environment {
+
+/**
+ * Evaluate a batch of configurations on a problem instance.
+ *
+ * Every configuration is solved on its own copy of the instance, concurrently, and the reward function is used to
+ * score each of them, as if a Configuring environment was run once per configuration.
+ * This is the building block for bandit or Bayesian optimization loops over solver parameters.
+ *
+ * @tparam RewardFunction The ecole::reward::RewardFunction used to score every configuration.
+ *         It is copied for every run.
+ */
+template <typename RewardFunction = reward::IsDone> class ParallelConfiguring {
+public:
+	using Seed = ecole::Seed;
+	using Reward = reward::Reward;
+
+	/**
+	 * Create the environment and seed it with a random value.
+	 *
+	 * @param n_threads The number of concurrent solves, or the hardware concurrency if zero.
+	 * @param race_factor If set, interrupt runs slower than this factor times the fastest run.
+	 */
+	ParallelConfiguring(
+		RewardFunction reward_function = {},
+		std::map<std::string, scip::Param> scip_params = {},
+		std::size_t n_threads = 0,
+		std::optional<double> race_factor = {}) :
+		the_dynamics(n_threads, race_factor),
+		the_reward_function(data::parse(std::move(reward_function))),
+		the_scip_params(std::move(scip_params)),
+		the_random_engine(spawn_random_engine()) {}
+
+	void seed(Seed new_seed) { random_engine().seed(new_seed); }
+
+	/**
+	 * Solve every configuration on a copy of the instance and return their rewards.
+	 *
+	 * @return The reward of every configuration.
+	 * @return Whether every configuration ran to completion (runs eliminated by racing did not).
+	 */
+	auto evaluate(scip::Model const& model, std::vector<scip::ParamSet> const& param_sets)
+		-> std::tuple<std::vector<Reward>, std::vector<bool>> {
+		auto const n_runs = param_sets.size();
+
+		// Models are prepared sequentially so that random states are deterministic
+		auto models = std::vector<scip::Model>{};
+		models.reserve(n_runs);
+		for (std::size_t i = 0; i < n_runs; ++i) {
+			models.push_back(model.copy_orig());
+			models.back().set_params(scip_params());
+			dynamics().set_dynamics_random_state(models.back(), random_engine());
+		}
+		auto model_ptrs = std::vector<scip::Model*>(n_runs);
+		for (std::size_t i = 0; i < n_runs; ++i) {
+			model_ptrs[i] = &models[i];
+		}
+
+		auto reward_functions = std::vector<RewardFunction>(n_runs, reward_function());
+		auto rewards = std::vector<Reward>(n_runs);
+		auto completed = dynamics().solve_all(
+			model_ptrs,
+			param_sets,
+			[&](std::size_t i) { reward_functions[i].before_reset(models[i]); },
+			[&](std::size_t i) { rewards[i] = reward_functions[i].extract(models[i], true); });
+		return {std::move(rewards), std::move(completed)};
+	}
+
+	auto evaluate(std::string const& filename, std::vector<scip::ParamSet> const& param_sets)
+		-> std::tuple<std::vector<Reward>, std::vector<bool>> {
+		return evaluate(scip::Model::from_file(filename), param_sets);
+	}
+
+	auto& dynamics() { return the_dynamics; }
+	auto& reward_function() { return the_reward_function; }
+	auto& scip_params() { return the_scip_params; }
+	auto& random_engine() { return the_random_engine; }
+
+private:
+	dynamics::ParallelConfiguringDynamics the_dynamics;
+	RewardFunction the_reward_function;
+	std::map<std::string, scip::Param> the_scip_params;
+	RandomEngine the_random_engine;
+};
+
+}  // namespace ecole::environment
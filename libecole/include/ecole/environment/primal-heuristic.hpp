@@ -0,0 +1,18 @@
+#pragma once
+
+#include "ecole/dynamics/primal-heuristic.hpp"
+#include "ecole/environment/environment.hpp"
+#include "ecole/information/nothing.hpp"
+#include "ecole/observation/heuristicstats.hpp"
+#include "ecole/reward/isdone.hpp"
+
+namespace ecole::environment {
+
+template <
+	typename ObservationFunction = observation::HeuristicStats,
+	typename RewardFunction = reward::IsDone,
+	typename InformationFunction = information::Nothing>
+using PrimalHeuristic =
+	Environment<dynamics::PrimalHeuristicDynamics, ObservationFunction, RewardFunction, InformationFunction>;
+
+}  // namespace ecole::environment
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::instance {
+
+/**
+ * Abstract base class for all instance generators.
+ *
+ * Instance generators build new problems directly in SCIP from a random engine.
+ */
+class InstanceGenerator {
+public:
+	virtual ~InstanceGenerator() = default;
+
+	/**
+	 * Generate a new problem instance.
+	 */
+	virtual scip::Model next() = 0;
+
+	/**
+	 * Seed the internal random engine of the generator.
+	 */
+	virtual void seed(Seed seed) = 0;
+};
+
+}  // namespace ecole::instance
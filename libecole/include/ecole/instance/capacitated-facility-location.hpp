@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+#include "ecole/instance/abstract.hpp"
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::instance {
+
+/**
+ * Generate capacitated facility location problems.
+ *
+ * The problem is generated following
+ *   Cornuejols G, Sridharan R, Thizy J-M (1991) A Comparison of Heuristics and Relaxations for the Capacitated Plant
+ *   Location Problem. European Journal of Operations Research 50:280-297.
+ */
+class CapacitatedFacilityLocationGenerator : public InstanceGenerator {
+public:
+	struct Parameters {
+		std::size_t n_customers = 100;  // NOLINT(readability-magic-numbers)
+		std::size_t n_facilities = 100;  // NOLINT(readability-magic-numbers)
+		double ratio = 5.;  // NOLINT(readability-magic-numbers)
+	};
+
+	static scip::Model generate_instance(Parameters parameters, RandomEngine& random_engine);
+
+	CapacitatedFacilityLocationGenerator(
+		Parameters parameters = {},
+		RandomEngine random_engine = spawn_random_engine());
+
+	scip::Model next() override;
+	void seed(Seed seed) override;
+
+	[[nodiscard]] Parameters const& get_parameters() const noexcept { return parameters; }
+
+private:
+	RandomEngine random_engine;
+	Parameters parameters;
+};
+
+}  // namespace ecole::instance
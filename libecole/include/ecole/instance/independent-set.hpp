@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+
+#include "ecole/instance/abstract.hpp"
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::instance {
+
+/**
+ * Generate maximum independent set problems on random graphs.
+ *
+ * The constraints are strengthened with a greedy clique partition of the graph.
+ */
+class IndependentSetGenerator : public InstanceGenerator {
+public:
+	enum class GraphType {
+		barabasi_albert,
+		erdos_renyi,
+	};
+
+	struct Parameters {
+		std::size_t n_nodes = 100;  // NOLINT(readability-magic-numbers)
+		double edge_probability = 0.25;  // NOLINT(readability-magic-numbers)
+		std::size_t affinity = 5;  // NOLINT(readability-magic-numbers)
+		GraphType graph_type = GraphType::barabasi_albert;
+	};
+
+	static scip::Model generate_instance(Parameters parameters, RandomEngine& random_engine);
+
+	IndependentSetGenerator(Parameters parameters = {}, RandomEngine random_engine = spawn_random_engine());
+
+	scip::Model next() override;
+	void seed(Seed seed) override;
+
+	[[nodiscard]] Parameters const& get_parameters() const noexcept { return parameters; }
+
+private:
+	RandomEngine random_engine;
+	Parameters parameters;
+};
+
+}  // namespace ecole::instance
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::instance {
+
+/**
+ * Generate instances ahead of time on background threads.
+ *
+ * Instances are produced into a bounded buffer so that retrieving the next instance (e.g. before resetting an
+ * environment) does not wait on instance creation.
+ * Instance number ``i`` is always generated with a random engine derived from the pipeline seed and ``i``, and
+ * instances are returned in order, so the sequence of instances only depends on the seed, not on the number of
+ * threads or the scheduling.
+ */
+class InstancePipeline {
+public:
+	/** A function generating a new instance from a random engine. */
+	using Generate = std::function<scip::Model(RandomEngine&)>;
+
+	struct Options {
+		/** Maximum number of instances generated ahead of time. */
+		std::size_t buffer_size = 8;  // NOLINT(readability-magic-numbers)
+		/** Number of background threads, or the hardware concurrency if zero. */
+		std::size_t n_threads = 1;
+		/** Replace generated instances by a copy of their original problem. */
+		bool copy_orig = false;
+		/** Presolve the instances ahead of time. */
+		bool presolve = false;
+	};
+
+	/**
+	 * Wrap a native instance generator.
+	 *
+	 * The parameters of the generator are copied so that instances can be generated concurrently.
+	 */
+	template <typename Generator>
+	static InstancePipeline
+	from_generator(Generator const& generator, Options options = {}, Seed seed = spawn_random_engine()());
+
+	/**
+	 * Start generating instances in the background.
+	 *
+	 * The function can be called concurrently if more than one thread is used.
+	 */
+	InstancePipeline(Generate generate, Options options = {}, Seed seed = spawn_random_engine()());
+	InstancePipeline(InstancePipeline const&) = delete;
+	InstancePipeline(InstancePipeline&&) = delete;
+	~InstancePipeline();
+
+	InstancePipeline& operator=(InstancePipeline const&) = delete;
+	InstancePipeline& operator=(InstancePipeline&&) = delete;
+
+	/**
+	 * Get the next instance, waiting for it only if it was not already generated.
+	 *
+	 * Exceptions raised while generating the instance are rethrown here.
+	 */
+	scip::Model next();
+
+	/**
+	 * Restart the sequence of instances from a new seed.
+	 *
+	 * Instances already generated are discarded.
+	 */
+	void seed(Seed seed);
+
+	[[nodiscard]] Options const& get_options() const noexcept { return options; }
+
+private:
+	struct Slot {
+		std::optional<scip::Model> model;
+		std::exception_ptr error;
+	};
+
+	Generate generate;
+	Options options;
+	Seed the_seed;
+
+	std::mutex mutex;
+	std::condition_variable produced_cv;
+	std::condition_variable consumed_cv;
+	std::map<std::size_t, Slot> buffer;
+	std::size_t next_to_produce = 0;
+	std::size_t next_to_consume = 0;
+	bool stopping = false;
+	std::vector<std::thread> workers;
+
+	void start();
+	void stop();
+	void run_worker();
+	scip::Model make_instance(std::size_t index) const;
+};
+
+/****************************************
+ *  Implementation of InstancePipeline  *
+ ****************************************/
+
+template <typename Generator>
+InstancePipeline InstancePipeline::from_generator(Generator const& generator, Options options, Seed seed) {
+	return {
+		[parameters = generator.get_parameters()](RandomEngine& random_engine) {
+			return Generator::generate_instance(parameters, random_engine);
+		},
+		options,
+		seed};
+}
+
+}  // namespace ecole::instance
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+
+#include "ecole/instance/abstract.hpp"
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::instance {
+
+/**
+ * Generate set cover problems.
+ *
+ * Algorithm described in
+ *   E. Balas and A. Ho, Set covering algorithms using cutting planes, heuristics, and subgradient optimization: A
+ *   computational study, Mathematical Programming, 12 (1980), 37-60.
+ */
+class SetCoverGenerator : public InstanceGenerator {
+public:
+	struct Parameters {
+		std::size_t n_rows = 500;  // NOLINT(readability-magic-numbers)
+		std::size_t n_cols = 1000;  // NOLINT(readability-magic-numbers)
+		double density = 0.05;  // NOLINT(readability-magic-numbers)
+		std::size_t max_coef = 100;  // NOLINT(readability-magic-numbers)
+	};
+
+	static scip::Model generate_instance(Parameters parameters, RandomEngine& random_engine);
+
+	SetCoverGenerator(Parameters parameters = {}, RandomEngine random_engine = spawn_random_engine());
+
+	scip::Model next() override;
+	void seed(Seed seed) override;
+
+	[[nodiscard]] Parameters const& get_parameters() const noexcept { return parameters; }
+
+private:
+	RandomEngine random_engine;
+	Parameters parameters;
+};
+
+}  // namespace ecole::instance
@@ -0,0 +1,238 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace ecole::instrumentation {
+
+/**
+ * Whether Ecole was compiled with instrumentation (``ECOLE_INSTRUMENTATION``).
+ *
+ * Without it, timers are compiled out and episode statistics stay empty.
+ */
+#ifdef ECOLE_INSTRUMENTATION
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * The timed parts of the environment.
+ *
+ * Stages can be nested, for instance the solve stage is part of the step stage, and the handoff between the solving
+ * thread and the environment is part of the solve stage.
+ */
+enum struct Stage : std::size_t {
+	reset = 0,
+	step,
+	solve,
+	handoff,
+	observation,
+	reward,
+	information,
+	python_conversion,
+};
+inline constexpr std::size_t n_stages = 8;
+
+[[nodiscard]] std::string_view stage_name(Stage stage) noexcept;
+
+struct Timer {
+	Clock::duration total{0};
+	std::size_t count = 0;
+};
+
+/**
+ * Timers aggregated over an episode.
+ */
+class EpisodeStats {
+public:
+	void clear() noexcept { timers = {}; }
+
+	void add(Stage stage, Clock::duration duration) noexcept {
+		auto& timer = timers[static_cast<std::size_t>(stage)];
+		timer.total += duration;
+		++timer.count;
+	}
+
+	[[nodiscard]] Timer const& operator[](Stage stage) const noexcept { return timers[static_cast<std::size_t>(stage)]; }
+
+private:
+	std::array<Timer, n_stages> timers{};
+};
+
+/**
+ * The statistics receiving the timers of the current thread, or null.
+ */
+[[nodiscard]] EpisodeStats* current() noexcept;
+
+/**
+ * Add a duration to the statistics of the current thread, if any.
+ */
+void record(Stage stage, Clock::duration duration) noexcept;
+
+/**
+ * Direct the timers of the current thread to some statistics, for the lifetime of the object.
+ */
+class ScopedRecording {
+public:
+	ScopedRecording(EpisodeStats& stats) noexcept;
+	ScopedRecording(ScopedRecording const&) = delete;
+	ScopedRecording(ScopedRecording&&) = delete;
+	~ScopedRecording();
+
+	ScopedRecording& operator=(ScopedRecording const&) = delete;
+	ScopedRecording& operator=(ScopedRecording&&) = delete;
+
+private:
+	EpisodeStats* previous;
+};
+
+/**
+ * Time its own lifetime in the statistics of the current thread.
+ *
+ * The clock is not read when the thread is not recording.
+ */
+class ScopedTimer {
+public:
+	ScopedTimer(Stage stage_) noexcept : stage{stage_}, stats{current()} {
+		if (stats != nullptr) {
+			start = Clock::now();
+		}
+	}
+	ScopedTimer(ScopedTimer const&) = delete;
+	ScopedTimer(ScopedTimer&&) = delete;
+	~ScopedTimer() {
+		if (stats != nullptr) {
+			stats->add(stage, Clock::now() - start);
+		}
+	}
+
+	ScopedTimer& operator=(ScopedTimer const&) = delete;
+	ScopedTimer& operator=(ScopedTimer&&) = delete;
+
+private:
+	Stage stage;
+	EpisodeStats* stats;
+	Clock::time_point start;
+};
+
+/*************
+ *  Tracing  *
+ *************/
+
+/**
+ * Begin or end of a traced event.
+ *
+ * The name must be a string with static storage duration, such as a literal.
+ */
+struct TraceEvent {
+	char const* name = nullptr;
+	Clock::time_point time;
+	bool begin = false;
+};
+
+inline constexpr std::size_t default_trace_capacity = 1U << 16U;
+
+namespace detail {
+/** Read on every traced event, so kept in the header. */
+extern std::atomic<bool> tracing_active;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+}  // namespace detail
+
+/**
+ * Start recording trace events, discarding events previously recorded.
+ *
+ * Every thread records its events in its own ring buffer holding the last ``capacity`` events.
+ * Recording an event is lock-free, only the first event of a thread in a tracing session takes a lock.
+ */
+void start_tracing(std::size_t capacity = default_trace_capacity);
+
+/**
+ * Stop recording trace events, keeping the ones recorded.
+ */
+void stop_tracing() noexcept;
+
+[[nodiscard]] inline bool tracing() noexcept {
+	return detail::tracing_active.load(std::memory_order_relaxed);
+}
+
+/**
+ * Record an event in the buffer of the current thread, if tracing.
+ */
+void trace(char const* name, bool begin) noexcept;
+
+/**
+ * Write the recorded events in the Chrome trace event JSON format.
+ *
+ * The file can be opened in ``chrome://tracing`` or Perfetto.
+ * Threads are numbered in the order they recorded their first event.
+ * Events should be written after tracing is stopped, otherwise the oldest events may be overwritten while read.
+ */
+void write_trace(std::ostream& out);
+void write_trace(std::string const& filename);
+
+/**
+ * Trace the lifetime of the object as an event.
+ */
+class ScopedTrace {
+public:
+	ScopedTrace(char const* name_) noexcept : name{tracing() ? name_ : nullptr} {
+		if (name != nullptr) {
+			trace(name, true);
+		}
+	}
+	ScopedTrace(Stage stage) noexcept : ScopedTrace{stage_name(stage).data()} {}
+	ScopedTrace(ScopedTrace const&) = delete;
+	ScopedTrace(ScopedTrace&&) = delete;
+	~ScopedTrace() {
+		if (name != nullptr) {
+			trace(name, false);
+		}
+	}
+
+	ScopedTrace& operator=(ScopedTrace const&) = delete;
+	ScopedTrace& operator=(ScopedTrace&&) = delete;
+
+private:
+	char const* name;
+};
+
+}  // namespace ecole::instrumentation
+
+#define ECOLE_INSTRUMENTATION_CONCAT_IMPL(a, b) a##b
+#define ECOLE_INSTRUMENTATION_CONCAT(a, b) ECOLE_INSTRUMENTATION_CONCAT_IMPL(a, b)
+
+#ifdef ECOLE_INSTRUMENTATION
+/** Time and trace the rest of the enclosing scope. */
+#define ECOLE_TIME_SCOPE(stage)                                                                                        \
+	::ecole::instrumentation::ScopedTimer const ECOLE_INSTRUMENTATION_CONCAT(ecole_timer_, __LINE__){stage};             \
+	::ecole::instrumentation::ScopedTrace const ECOLE_INSTRUMENTATION_CONCAT(ecole_trace_, __LINE__) { stage }
+/** Trace the rest of the enclosing scope as an event with the given static name. */
+#define ECOLE_TRACE_SCOPE(name)                                                                                        \
+	::ecole::instrumentation::ScopedTrace const ECOLE_INSTRUMENTATION_CONCAT(ecole_trace_, __LINE__) { name }
+/** Record the timers of the rest of the enclosing scope in the given statistics. */
+#define ECOLE_RECORD_SCOPE(stats)                                                                                      \
+	::ecole::instrumentation::ScopedRecording const ECOLE_INSTRUMENTATION_CONCAT(ecole_recording_, __LINE__) { stats }
+#else
+#define ECOLE_TIME_SCOPE(stage) static_cast<void>(0)
+#define ECOLE_RECORD_SCOPE(stats) static_cast<void>(0)
+#define ECOLE_TRACE_SCOPE(name) static_cast<void>(0)
+#endif
+
+namespace ecole::instrumentation {
+
+/**
+ * Call a function, timing it if instrumentation is enabled.
+ */
+template <typename Func> decltype(auto) timed([[maybe_unused]] Stage stage, Func&& func) {
+	ECOLE_TIME_SCOPE(stage);
+	return func();
+}
+
+}  // namespace ecole::instrumentation
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/observation/abstract.hpp"
+#include "ecole/utility/sparse-matrix.hpp"
+
+namespace ecole::observation {
+
+class CutPoolObs {
+public:
+	using value_type = double;
+
+	static constexpr std::size_t n_cut_features = 6;
+	enum struct CutFeatures : std::size_t {
+		efficacy = 0,
+		objective_parallelism,
+		density,
+		integral_support,
+		is_local,
+		rank,
+	};
+
+	/** One row of features per cut, contiguous in memory. */
+	xt::xtensor<value_type, 2> cut_features;
+	/** The coefficients of the cuts on the LP columns. */
+	utility::coo_matrix<value_type> coefficients;
+};
+
+/**
+ * Features of the cuts in the separation storage, in the order of Model::cuts.
+ */
+class CutPool : public ObservationFunction<std::optional<CutPoolObs>> {
+public:
+	std::optional<CutPoolObs> extract(scip::Model& model, bool done) override;
+};
+
+}  // namespace ecole::observation
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/observation/abstract.hpp"
+
+namespace ecole::observation {
+
+/**
+ * Success statistics of the primal heuristics.
+ *
+ * The observation is a matrix with one row per heuristic, in the order of Model::heuristics (the action set of
+ * PrimalHeuristicDynamics).
+ */
+class HeuristicStats : public ObservationFunction<std::optional<xt::xtensor<double, 2>>> {
+public:
+	/** Extraction only reads the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
+	static constexpr std::size_t n_features = 6;
+	enum struct Features : std::size_t {
+		n_calls = 0,
+		n_solutions_found,
+		n_best_solutions_found,
+		success_rate,
+		solving_time,
+		is_scheduled,
+	};
+
+	std::optional<xt::xtensor<double, 2>> extract(scip::Model& model, bool done) override;
+};
+
+}  // namespace ecole::observation
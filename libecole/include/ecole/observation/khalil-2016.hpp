@@ -1,7 +1,9 @@
 #pragma once
 
+#include <bitset>
 #include <cstddef>
 #include <optional>
+#include <vector>
 
 #include <xtensor/xtensor.hpp>
 
@@ -13,6 +15,9 @@ using Khalil2016Obs = xt::xtensor<double, 2>;
 
 class Khalil2016 : public ObservationFunction<std::optional<Khalil2016Obs>> {
 public:
+	/** Extraction only reads the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
 	struct Feature {
 		static constexpr std::size_t n_static = 18;
 		static constexpr std::size_t n_dynamic = 54;
@@ -106,14 +111,52 @@ public:
 			active_coef_weight4_min,
 			active_coef_weight4_max,
 		};
+
+		static constexpr std::size_t n_groups = 12;
+
+		/** Groups of features computed together, that can be disabled together. */
+		enum struct Group : std::size_t {
+			/** Static groups */
+			obj_coef = 0,
+			n_rows,
+			rows_deg,
+			rows_pos_coefs,
+			rows_neg_coefs,
+			/** Dynamic groups */
+			slack_ceil_dist,
+			pseudocosts,
+			infeasibility,
+			dynamic_rows_deg,
+			coef_rhs_ratios,
+			coef_coef_ratios,
+			active_coefs,
+		};
 	};
 
+	using FeatureGroups = std::bitset<Feature::n_groups>;
+
+	/**
+	 * Compute all the features.
+	 */
+	Khalil2016() noexcept;
+	/**
+	 * Compute only the features of the given groups.
+	 *
+	 * Features of other groups are neither computed nor allocated, and the columns of the observation are the features
+	 * of the given groups, in the order given by Khalil2016::features.
+	 */
+	explicit Khalil2016(std::vector<Feature::Group> const& groups);
+
 	void before_reset(scip::Model& model) override;
 
 	std::optional<Khalil2016Obs> extract(scip::Model& model, bool done) override;
 
+	/** The index (as in Feature::Static and Feature::Dynamic) of every column of the observation. */
+	[[nodiscard]] std::vector<std::size_t> features() const;
+
 private:
 	xt::xtensor<Khalil2016Obs::value_type, 2> static_features;
+	FeatureGroups groups;
 };
 
 }  // namespace ecole::observation
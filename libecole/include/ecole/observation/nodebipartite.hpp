@@ -1,6 +1,9 @@
 #pragma once
 
+#include <bitset>
+#include <cstddef>
 #include <optional>
+#include <vector>
 
 #include <xtensor/xtensor.hpp>
 
@@ -36,6 +39,20 @@ public:
 		is_type_continuous,        // One hot encoded
 	};
 
+	static constexpr std::size_t n_column_feature_groups = 9;
+	/** Groups of column features computed together, that can be disabled together. */
+	enum struct ColumnFeatureGroup : std::size_t {
+		bounds = 0,         // has_lower_bound, has_upper_bound
+		reduced_cost,       // normed_reduced_cost
+		objective,          // objective
+		solution,           // solution_value, solution_frac, is_solution_at_lower_bound, is_solution_at_upper_bound
+		age,                // scaled_age
+		basis,              // is_basis_*
+		incumbent,          // incumbent_value
+		average_incumbent,  // average_incumbent_value
+		type,               // is_type_*
+	};
+
 	static constexpr std::size_t n_row_features = 5;
 	enum struct RowFeatures : std::size_t {
 		bias = 0,
@@ -52,7 +69,30 @@ public:
 
 class NodeBipartite : public ObservationFunction<std::optional<NodeBipartiteObs>> {
 public:
+	/** Extraction only reads the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
+	using ColumnFeatureGroups = std::bitset<NodeBipartiteObs::n_column_feature_groups>;
+
+	/**
+	 * Compute all the column features.
+	 */
+	NodeBipartite() noexcept;
+	/**
+	 * Compute only the column features of the given groups.
+	 *
+	 * Features of other groups are neither computed nor allocated, and the columns of the column features are the
+	 * features of the given groups, in the order given by NodeBipartite::column_features.
+	 */
+	explicit NodeBipartite(std::vector<NodeBipartiteObs::ColumnFeatureGroup> const& column_groups);
+
 	std::optional<NodeBipartiteObs> extract(scip::Model& model, bool done) override;
+
+	/** The feature of every column of the column features. */
+	[[nodiscard]] std::vector<NodeBipartiteObs::ColumnFeatures> column_features() const;
+
+private:
+	ColumnFeatureGroups column_groups;
 };
 
 }  // namespace ecole::observation
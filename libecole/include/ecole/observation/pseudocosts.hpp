@@ -10,6 +10,9 @@ namespace ecole::observation {
 
 class Pseudocosts : public ObservationFunction<std::optional<xt::xtensor<double, 1>>> {
 public:
+	/** Extraction only reads the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
 	std::optional<xt::xtensor<double, 1>> extract(scip::Model& model, bool done) override;
 };
 
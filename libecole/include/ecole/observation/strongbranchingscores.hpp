@@ -12,6 +12,9 @@ namespace ecole::observation {
 
 class StrongBranchingScores : public ObservationFunction<std::optional<xt::xtensor<double, 1>>> {
 public:
+	/** Extraction sets parameters and runs the branching rule, so it cannot run concurrently with other functions. */
+	static constexpr bool read_only = false;
+
 	bool pseudo_candidates;
 
 	StrongBranchingScores(bool pseudo_candidates = true);
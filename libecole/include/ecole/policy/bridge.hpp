@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ecole/exception.hpp"
+
+namespace ecole::policy {
+
+/**
+ * Gather the queries of many environment threads in batches evaluated by a single policy call.
+ *
+ * Environment threads block in query until the batch holding their request is evaluated.
+ * A dispatching thread waits for the first pending request, then for the batch to be full or for the timeout to expire
+ * since the first request was queued, and calls the policy once on the whole batch.
+ * This is meant for policies with a high fixed cost per call, such as neural networks on GPU.
+ *
+ * @tparam Request What is given by environment threads, typically an observation and an action set.
+ * @tparam Response What is returned to environment threads, typically an action.
+ */
+template <typename Request, typename Response> class PolicyBridge {
+public:
+	using Clock = std::chrono::steady_clock;
+	/** Return one response per request, in the same order. */
+	using Policy = std::function<std::vector<Response>(std::vector<Request>&)>;
+
+	struct Options {
+		/** Maximum number of requests per call to the policy. */
+		std::size_t batch_size = 32;  // NOLINT(readability-magic-numbers)
+		/** Maximum time the first request of a batch waits for other requests. */
+		std::chrono::microseconds timeout{1000};  // NOLINT(readability-magic-numbers)
+	};
+
+	/** Number of buckets in the queue latency histogram. */
+	static constexpr std::size_t n_latency_buckets = 32;
+
+	/**
+	 * Histograms of the batches evaluated.
+	 *
+	 * The batch size histogram counts the batches of every size, starting at zero.
+	 * The queue latency histogram counts requests by the time they waited before being evaluated, where bucket ``i``
+	 * holds latencies in ``[2^i, 2^(i+1))`` microseconds, the first one also holding shorter latencies, and the last one
+	 * longer ones.
+	 */
+	struct Stats {
+		std::vector<std::size_t> batch_sizes;
+		std::vector<std::size_t> queue_latencies;
+	};
+
+	/**
+	 * Start the dispatching thread.
+	 */
+	PolicyBridge(Policy policy, Options options = {});
+	PolicyBridge(PolicyBridge const&) = delete;
+	PolicyBridge(PolicyBridge&&) = delete;
+	/**
+	 * Pending requests are evaluated before the dispatching thread is stopped.
+	 *
+	 * The destructor waits for the batch being evaluated, so it must not hold a resource the policy needs.
+	 */
+	~PolicyBridge();
+
+	PolicyBridge& operator=(PolicyBridge const&) = delete;
+	PolicyBridge& operator=(PolicyBridge&&) = delete;
+
+	/**
+	 * Queue a request and wait for its response.
+	 *
+	 * Exceptions thrown by the policy are rethrown in all the threads of the batch, each as its own Exception with
+	 * the same message, since an exception object cannot safely be rethrown in many threads.
+	 */
+	auto query(Request request) -> Response;
+
+	[[nodiscard]] auto stats() const -> Stats;
+	[[nodiscard]] auto get_options() const noexcept -> Options const& { return options; }
+
+private:
+	struct Pending {
+		Request request;
+		std::promise<Response> promise;
+		Clock::time_point queued;
+	};
+
+	Policy policy;
+	Options options;
+
+	mutable std::mutex mutex;
+	std::condition_variable pending_cv;
+	std::deque<Pending> pending;
+	bool stopping = false;
+	Stats the_stats;
+	std::thread dispatcher;
+
+	auto run_dispatcher() -> void;
+	auto evaluate(std::vector<Pending>&& batch) -> void;
+};
+
+/************************************
+ *  Implementation of PolicyBridge  *
+ ************************************/
+
+template <typename Request, typename Response>
+PolicyBridge<Request, Response>::PolicyBridge(Policy policy_, Options options_) :
+	policy{std::move(policy_)}, options{options_} {
+	if (options.batch_size == 0) {
+		throw Exception("The batch size of the policy bridge must be at least one");
+	}
+	the_stats.batch_sizes.resize(options.batch_size + 1);
+	the_stats.queue_latencies.resize(n_latency_buckets);
+	dispatcher = std::thread{[this] { run_dispatcher(); }};
+}
+
+template <typename Request, typename Response> PolicyBridge<Request, Response>::~PolicyBridge() {
+	{
+		auto const lk = std::lock_guard{mutex};
+		stopping = true;
+	}
+	pending_cv.notify_all();
+	dispatcher.join();
+}
+
+template <typename Request, typename Response>
+auto PolicyBridge<Request, Response>::query(Request request) -> Response {
+	auto future = std::future<Response>{};
+	{
+		auto const lk = std::lock_guard{mutex};
+		auto& item = pending.emplace_back(Pending{std::move(request), {}, Clock::now()});
+		future = item.promise.get_future();
+	}
+	pending_cv.notify_all();
+	return future.get();
+}
+
+template <typename Request, typename Response>
+auto PolicyBridge<Request, Response>::stats() const -> Stats {
+	auto const lk = std::lock_guard{mutex};
+	return the_stats;
+}
+
+template <typename Request, typename Response> auto PolicyBridge<Request, Response>::run_dispatcher() -> void {
+	while (true) {
+		auto batch = std::vector<Pending>{};
+		{
+			auto lk = std::unique_lock{mutex};
+			pending_cv.wait(lk, [this] { return stopping || !pending.empty(); });
+			if (pending.empty()) {
+				break;
+			}
+			auto const deadline = pending.front().queued + options.timeout;
+			pending_cv.wait_until(lk, deadline, [this] { return stopping || pending.size() >= options.batch_size; });
+
+			auto const batch_size = std::min(pending.size(), options.batch_size);
+			auto const batch_end = pending.begin() + static_cast<std::ptrdiff_t>(batch_size);
+			batch.reserve(batch_size);
+			std::move(pending.begin(), batch_end, std::back_inserter(batch));
+			pending.erase(pending.begin(), batch_end);
+
+			auto const now = Clock::now();
+			++the_stats.batch_sizes[batch_size];
+			for (auto const& item : batch) {
+				using Rep = std::chrono::microseconds::rep;
+				auto const latency = std::chrono::duration_cast<std::chrono::microseconds>(now - item.queued).count();
+				auto bucket = std::size_t{0};
+				while ((bucket + 1 < n_latency_buckets) && ((Rep{2} << bucket) <= latency)) {
+					++bucket;
+				}
+				++the_stats.queue_latencies[bucket];
+			}
+		}
+		evaluate(std::move(batch));
+	}
+}
+
+template <typename Request, typename Response>
+auto PolicyBridge<Request, Response>::evaluate(std::vector<Pending>&& batch) -> void {
+	auto n_answered = std::size_t{0};
+	try {
+		auto requests = std::vector<Request>{};
+		requests.reserve(batch.size());
+		for (auto& item : batch) {
+			requests.push_back(std::move(item.request));
+		}
+		auto responses = policy(requests);
+		if (responses.size() != batch.size()) {
+			throw Exception("The policy must return one response per request");
+		}
+		for (; n_answered < batch.size(); ++n_answered) {
+			batch[n_answered].promise.set_value(std::move(responses[n_answered]));
+		}
+	} catch (std::exception const& error) {
+		for (; n_answered < batch.size(); ++n_answered) {
+			batch[n_answered].promise.set_exception(std::make_exception_ptr(Exception{error.what()}));
+		}
+	} catch (...) {
+		for (; n_answered < batch.size(); ++n_answered) {
+			batch[n_answered].promise.set_exception(std::make_exception_ptr(Exception{"Unknown error in the policy"}));
+		}
+	}
+}
+
+}  // namespace ecole::policy
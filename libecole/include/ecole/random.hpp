@@ -1,10 +1,73 @@
 #pragma once
 
-#include <random>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
 
 namespace ecole {
 
-using RandomEngine = std::mt19937;
+/**
+ * Counter-based pseudo-random number engine, Philox4x32-10 from Salmon et al. (2011).
+ *
+ * The output is a bijection of a key (the seed) and a counter (the stream and the position in the stream), so that
+ * moving in a stream (discard) and creating independent streams (split) are constant time operations.
+ * The state fits in a few words, and the engine satisfies the requirements of a uniform random bit generator
+ * used by the standard library distributions.
+ */
+class Philox4x32 {
+public:
+	using result_type = std::uint_fast32_t;
+
+	static constexpr result_type default_seed = 5489U;
+
+	static constexpr auto min() noexcept -> result_type { return 0; }
+	static constexpr auto max() noexcept -> result_type { return std::numeric_limits<std::uint32_t>::max(); }
+
+	explicit Philox4x32(result_type value = default_seed) noexcept { seed(value); }
+
+	/** Reset the engine to the begining of the first stream of the given seed. */
+	auto seed(result_type value = default_seed) noexcept -> void;
+
+	auto operator()() noexcept -> result_type;
+
+	/** Advance the engine by ``n`` values, in constant time. */
+	auto discard(unsigned long long n) noexcept -> void;
+
+	/**
+	 * A new engine, independent from this one and from the other splits with different ids.
+	 *
+	 * The new engine only depends on the state of this engine (not its position) and the id, so that engines can be
+	 * derived deterministically in any order, for instance from the index of an environment in a pool.
+	 */
+	[[nodiscard]] auto split(std::uint64_t id) const noexcept -> Philox4x32;
+
+	friend auto operator==(Philox4x32 const& lhs, Philox4x32 const& rhs) noexcept -> bool {
+		return lhs.key == rhs.key && lhs.stream == rhs.stream && lhs.position == rhs.position;
+	}
+	friend auto operator!=(Philox4x32 const& lhs, Philox4x32 const& rhs) noexcept -> bool { return !(lhs == rhs); }
+
+	friend auto operator<<(std::ostream& os, Philox4x32 const& engine) -> std::ostream&;
+	friend auto operator>>(std::istream& is, Philox4x32& engine) -> std::istream&;
+
+	using Key = std::array<std::uint32_t, 2>;
+	using Counter = std::array<std::uint32_t, 4>;
+
+	/** The Philox4x32-10 bijection. */
+	[[nodiscard]] static auto block(Counter counter, Key key) noexcept -> Counter;
+
+private:
+	Key key = {};
+	std::uint64_t stream = 0;
+	/** The number of values generated in the stream. */
+	std::uint64_t position = 0;
+	/** The values of the block of the current position, unless invalidated. */
+	Counter buffer = {};
+	bool buffer_valid = false;
+};
+
+using RandomEngine = Philox4x32;
 using Seed = RandomEngine::result_type;
 
 /**
@@ -20,9 +83,71 @@ auto seed(Seed val) -> void;
  * Get a new random engine that derive from Ecole's main source of randomness.
  *
  * This is the function used by all Ecole components that need a random engine.
- * While the function is thread safe, undeterministic behaviour can happen if this function is call in different threads
- * in a non deterministic order.
+ * The function is lock-free, but the engine returned depends on the number of engines spawned before it, so
+ * undeterministic behaviour can happen if this function is call in different threads in a non deterministic order.
  */
 auto spawn_random_engine() -> RandomEngine;
 
+/**
+ * Get the random engine of the given id, deriving from Ecole's main source of randomness.
+ *
+ * The engine only depends on the seed and the id, for instance the index of an environment in a pool, so that it is
+ * deterministic regardless of the order in which threads spawn their engines.
+ */
+auto spawn_random_engine(std::uint64_t id) -> RandomEngine;
+
+/*****************************************
+ *  Implementation of Philox4x32 engine  *
+ *****************************************/
+
+inline auto Philox4x32::seed(result_type value) noexcept -> void {
+	auto const value64 = static_cast<std::uint64_t>(value);
+	key = {static_cast<std::uint32_t>(value64), static_cast<std::uint32_t>(value64 >> 32U)};
+	stream = 0;
+	position = 0;
+	buffer_valid = false;
+}
+
+inline auto Philox4x32::operator()() noexcept -> result_type {
+	auto const index = static_cast<std::size_t>(position & 3U);
+	if (index == 0 || !buffer_valid) {
+		auto const block_index = position >> 2U;
+		buffer = block(
+			{static_cast<std::uint32_t>(block_index),
+			 static_cast<std::uint32_t>(block_index >> 32U),
+			 static_cast<std::uint32_t>(stream),
+			 static_cast<std::uint32_t>(stream >> 32U)},
+			key);
+		buffer_valid = true;
+	}
+	++position;
+	return buffer[index];
+}
+
+inline auto Philox4x32::discard(unsigned long long n) noexcept -> void {
+	position += static_cast<std::uint64_t>(n);
+	buffer_valid = false;
+}
+
+inline auto Philox4x32::block(Counter counter, Key key) noexcept -> Counter {
+	constexpr auto multiplier_0 = std::uint64_t{0xD2511F53};
+	constexpr auto multiplier_1 = std::uint64_t{0xCD9E8D57};
+	constexpr auto weyl_0 = std::uint32_t{0x9E3779B9};
+	constexpr auto weyl_1 = std::uint32_t{0xBB67AE85};
+	constexpr auto n_rounds = 10;
+	for (auto round = 0; round < n_rounds; ++round) {
+		auto const product_0 = multiplier_0 * counter[0];
+		auto const product_1 = multiplier_1 * counter[2];
+		counter = {
+			static_cast<std::uint32_t>(product_1 >> 32U) ^ counter[1] ^ key[0],
+			static_cast<std::uint32_t>(product_1),
+			static_cast<std::uint32_t>(product_0 >> 32U) ^ counter[3] ^ key[1],
+			static_cast<std::uint32_t>(product_0),
+		};
+		key[0] += weyl_0;
+		key[1] += weyl_1;
+	}
+	return counter;
+}
+
 }  // namespace ecole
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "ecole/reward/abstract.hpp"
+
+namespace ecole::reward {
+
+/**
+ * The primal bound, in the original objective space.
+ *
+ * The bound is tracked during solving by an event handler, and refreshed from SCIP in constant time on extraction.
+ */
+class PrimalBound : public RewardFunction {
+public:
+	void before_reset(scip::Model& model) override;
+	Reward extract(scip::Model& model, bool done = false) override;
+};
+
+/**
+ * The dual bound, in the original objective space.
+ *
+ * The bound is tracked during solving by an event handler, and refreshed from SCIP in constant time on extraction.
+ */
+class DualBound : public RewardFunction {
+public:
+	void before_reset(scip::Model& model) override;
+	Reward extract(scip::Model& model, bool done = false) override;
+};
+
+}  // namespace ecole::reward
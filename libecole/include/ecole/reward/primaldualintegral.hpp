@@ -0,0 +1,23 @@
+#pragma once
+
+#include "ecole/reward/abstract.hpp"
+
+namespace ecole::reward {
+
+/**
+ * Primal-dual integral difference.
+ *
+ * The reward is the integral over solving time of the primal-dual gap (as defined by Berthold) since the previous
+ * state.
+ * The gap is integrated during solving by an event handler, and refreshed from SCIP in constant time on extraction.
+ */
+class PrimalDualIntegral : public RewardFunction {
+public:
+	void before_reset(scip::Model& model) override;
+	Reward extract(scip::Model& model, bool done = false) override;
+
+private:
+	double last_integral = 0.;
+};
+
+}  // namespace ecole::reward
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+
+#include "ecole/scip/type.hpp"
+
+namespace ecole::scip {
+
+/**
+ * Running aggregates of the primal and dual bounds, updated by an event handler during solving.
+ *
+ * The bounds are updated when a new best solution is found, a node is solved, or an LP is solved, so that they are
+ * read in constant time instead of being polled at every transition.
+ * Bounds are given in the original objective space.
+ *
+ * @see Model::track_bounds
+ */
+struct BoundTracker {
+	/** The value of an infinite bound, as given by SCIP. */
+	real infinity;
+	real primal_bound;
+	real dual_bound;
+	/** The solving time, in seconds, of the last update. */
+	real last_time = 0.;
+	/** The primal-dual gap since the last update. */
+	real last_gap = 1.;
+	/** The integral of the primal-dual gap over solving time, until the last update. */
+	real primal_dual_integral = 0.;
+	std::size_t n_updates = 0;
+
+	/** Start with infinite bounds, in the direction of the objective sense. */
+	BoundTracker(real infinity_, bool minimize) noexcept;
+
+	/** Start from the given bounds, without integrating the gap before the given solving time. */
+	void seed(real primal_bound_, real dual_bound_, real time) noexcept;
+
+	/** Integrate the gap until the given solving time, and update the bounds. */
+	void update(real primal_bound_, real dual_bound_, real time) noexcept;
+
+	/** The primal-dual integral until the given solving time, assuming the bounds have not changed since. */
+	[[nodiscard]] real primal_dual_integral_at(real time) const noexcept {
+		return primal_dual_integral + last_gap * (time - last_time);
+	}
+
+	/**
+	 * The primal-dual gap function of Berthold (2013).
+	 *
+	 * The gap is zero when the bounds are equal, one when a bound is infinite or the bounds have different signs, and
+	 * the relative difference between the bounds otherwise.
+	 */
+	[[nodiscard]] real gap(real primal, real dual) const noexcept;
+};
+
+}  // namespace ecole::scip
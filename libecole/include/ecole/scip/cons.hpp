@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <nonstd/span.hpp>
+#include <scip/scip.h>
+
+#include "ecole/scip/type.hpp"
+
+namespace ecole::scip {
+
+/**
+ * Release a SCIP constraint once it is not needed by its creator anymore.
+ */
+class ConsReleaser {
+public:
+	ConsReleaser(SCIP* scip_) noexcept : scip(scip_) {}
+	void operator()(SCIP_CONS* ptr);
+
+private:
+	SCIP* scip = nullptr;
+};
+
+using unique_cons = std::unique_ptr<SCIP_CONS, ConsReleaser>;
+
+/**
+ * Create a linear constraint lhs <= vals * vars <= rhs.
+ */
+auto create_cons_basic_linear(
+	SCIP* scip,
+	std::string const& name,
+	nonstd::span<Var* const> vars,
+	nonstd::span<real const> vals,
+	real lhs,
+	real rhs) -> unique_cons;
+
+/**
+ * Create a linear constraint and add it to the problem.
+ */
+void add_cons_basic_linear(
+	SCIP* scip,
+	std::string const& name,
+	nonstd::span<Var* const> vars,
+	nonstd::span<real const> vals,
+	real lhs,
+	real rhs);
+
+}  // namespace ecole::scip
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include <scip/scip.h>
+
+#include "ecole/scip/type.hpp"
+
+namespace ecole::scip {
+
+/**
+ * The LP of a node, gathered once in structure-of-arrays buffers.
+ *
+ * Data functions read the snapshot given by Model::lp_snapshot instead of querying SCIP for every column and row,
+ * so that observations combined (e.g. in a data::TupleFunction) traverse the LP only once per node.
+ * Columns and rows are indexed by their LP position.
+ */
+struct LpSnapshot {
+	/** The focus node number, number of LPs solved, number of LP columns and rows. */
+	using Key = std::tuple<long_int, long_int, int, int>;
+
+	/* Columns of the LP */
+	std::vector<Col*> cols;
+	std::vector<Var*> col_vars;
+	std::vector<real> col_lbs;
+	std::vector<real> col_ubs;
+	std::vector<real> col_objs;
+	std::vector<real> col_primsols;
+	std::vector<real> col_redcosts;
+	std::vector<base_stat> col_basis_statuses;
+
+	/* Rows of the LP */
+	std::vector<Row*> rows;
+	std::vector<real> row_lhss;
+	std::vector<real> row_rhss;
+	std::vector<real> row_constants;
+	std::vector<real> row_activities;
+	std::vector<real> row_dualsols;
+	std::vector<real> row_norms;
+	std::vector<std::size_t> row_n_lp_nonzs;
+	/** Whether the sides are finite. */
+	std::vector<bool> row_has_lhs;
+	std::vector<bool> row_has_rhs;
+	/** Whether the LP activity is at the sides. */
+	std::vector<bool> row_at_lhs;
+	std::vector<bool> row_at_rhs;
+
+	/** The euclidean norm of the objective, lazily computed by SCIP. */
+	real obj_norm = 0.;
+
+	/* LP branching candidates, only gathered when the LP is solved (empty otherwise) */
+	std::vector<Var*> lp_branch_cands;
+	std::vector<real> lp_branch_cand_sols;
+
+	/** The LP the snapshot was taken from, if any. */
+	std::optional<Key> key;
+
+	/** Identify the current LP of a SCIP in solving stage. */
+	static Key current_key(SCIP* scip) noexcept;
+
+	/**
+	 * Overwrite the buffers with the current LP, keeping their memory.
+	 */
+	void gather(SCIP* scip);
+
+	[[nodiscard]] std::size_t n_cols() const noexcept { return cols.size(); }
+	[[nodiscard]] std::size_t n_rows() const noexcept { return rows.size(); }
+	/** Unshifted sides, as given by get_unshifted_lhs and get_unshifted_rhs. */
+	[[nodiscard]] real unshifted_lhs(std::size_t row) const noexcept { return row_lhss[row] - row_constants[row]; }
+	[[nodiscard]] real unshifted_rhs(std::size_t row) const noexcept { return row_rhss[row] - row_constants[row]; }
+};
+
+}  // namespace ecole::scip
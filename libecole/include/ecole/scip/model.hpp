@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <nonstd/span.hpp>
 #include <scip/scip.h>
@@ -21,6 +22,8 @@ namespace ecole::scip {
 
 /* Forward declare scip holder type */
 class Scimpl;
+struct LpSnapshot;
+struct BoundTracker;
 
 /**
  * A stateful SCIP solver object.
@@ -116,8 +119,44 @@ public:
 	void solve() const;
 	[[nodiscard]] bool is_solved() const noexcept;
 
+	/**
+	 * Transform and presolve the problem, without solving it.
+	 *
+	 * Solving (e.g. in an environment) resumes from the presolved problem.
+	 */
+	void presolve() const;
+
+	/**
+	 * Ask SCIP to stop solving at the next possible point.
+	 *
+	 * This can be called from another thread while solve is running.
+	 * Nothing happens if the Model is not presolving or solving.
+	 */
+	void interrupt_solve() const noexcept;
+
 	void solve_iter();
 	void solve_iter_branch(Var* var);
+	/**
+	 * Start solving, pausing every time a node must be selected.
+	 *
+	 * Use solve_iter_select_node to select the next node to process.
+	 */
+	void solve_iter_nodesel();
+	void solve_iter_select_node(Node* node);
+	/**
+	 * Start solving, pausing before processing nodes at depths multiple of the frequency.
+	 *
+	 * Use solve_iter_continue to resume solving.
+	 */
+	void solve_iter_heuristic(int frequency);
+	void solve_iter_continue();
+	/**
+	 * Start solving, pausing every time separators have found cuts.
+	 *
+	 * Use solve_iter_select_cuts to select the cuts added to the LP, among the cuts returned by Model::cuts.
+	 */
+	void solve_iter_cut_selection();
+	void solve_iter_select_cuts(std::vector<Row*> cuts);
 	void solve_iter_stop();
 	[[nodiscard]] bool solve_iter_is_done();
 
@@ -126,6 +165,41 @@ public:
 	[[nodiscard]] nonstd::span<Var*> pseudo_branch_cands() const;
 	[[nodiscard]] nonstd::span<Col*> lp_columns() const;
 	[[nodiscard]] nonstd::span<Row*> lp_rows() const;
+	/**
+	 * The columns, rows, and branching candidates of the current LP, gathered once per LP.
+	 *
+	 * The snapshot is shared by all the data functions extracting data on the same node.
+	 * It is gathered again when the focus node or the LP changes, and must not be kept across transitions.
+	 */
+	[[nodiscard]] LpSnapshot const& lp_snapshot() const;
+	/**
+	 * Track the primal and dual bounds during solving, with an event handler.
+	 *
+	 * Can be called in any stage, for instance on a presolved model, in which case tracking starts from the current
+	 * bounds. Does nothing if the bounds are already tracked.
+	 */
+	void track_bounds();
+	/** The bounds tracked since track_bounds was called. */
+	[[nodiscard]] BoundTracker const& bound_tracker() const;
+	/**
+	 * The bounds tracked, first updated with the current bounds of SCIP.
+	 *
+	 * Bounds also change without the events caught, for instance when the last node is removed at the end of solving.
+	 */
+	BoundTracker const& update_bound_tracker();
+	[[nodiscard]] nonstd::span<Node*> leaves() const;
+	[[nodiscard]] nonstd::span<Node*> children() const;
+	[[nodiscard]] nonstd::span<Node*> siblings() const;
+	/**
+	 * The primal heuristics of SCIP, sorted by name.
+	 *
+	 * Heuristics included by Ecole are omitted.
+	 */
+	[[nodiscard]] std::vector<Heur*> heuristics() const;
+	/**
+	 * The cuts in the separation storage, waiting to be added to the LP.
+	 */
+	[[nodiscard]] nonstd::span<Row*> cuts() const;
 
 private:
 	std::unique_ptr<Scimpl> scimpl;
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ecole/scip/type.hpp"
+
+namespace ecole::scip {
+
+/* Forward declare Model type */
+class Model;
+
+/**
+ * A validated set of parameters ready to be applied on any Model.
+ *
+ * The parameter names and values are resolved once at construction: the type of every parameter is looked up, the
+ * value is cast to the exact SCIP type, and checked against the parameter bounds.
+ * Applying the set on a Model then only performs the final typed SCIP calls, which makes it suitable for applying
+ * the same configurations many times (e.g. in hyperparameter search).
+ * Parameter sets are immutable, hashable, and can be compared and diffed with one another.
+ */
+class ParamSet {
+public:
+	using value_type = std::pair<std::string, Param>;
+	using const_iterator = std::vector<value_type>::const_iterator;
+
+	/**
+	 * Construct an empty parameter set.
+	 */
+	ParamSet() = default;
+
+	/**
+	 * Resolve parameters using the types and bounds of a default Model.
+	 *
+	 * The default Model is created once and shared by all the parameter sets.
+	 */
+	ParamSet(std::map<std::string, Param> const& name_values);
+
+	/**
+	 * Resolve parameters using the types and bounds of the given Model.
+	 *
+	 * This is required for parameters that are not part of SCIP default plugins.
+	 */
+	ParamSet(std::map<std::string, Param> const& name_values, Model const& model);
+
+	/**
+	 * Set all the parameters of the set on the given Model.
+	 */
+	void apply(Model& model) const;
+
+	/**
+	 * Return the parameters of this set that are missing or have a different value in the other set.
+	 */
+	[[nodiscard]] ParamSet diff(ParamSet const& other) const;
+
+	/**
+	 * Convert back to a map of parameter names and (exactly typed) values.
+	 */
+	[[nodiscard]] std::map<std::string, Param> to_dict() const;
+
+	[[nodiscard]] std::size_t hash() const noexcept { return the_hash; }
+	[[nodiscard]] std::size_t size() const noexcept { return name_values.size(); }
+	[[nodiscard]] bool empty() const noexcept { return name_values.empty(); }
+	[[nodiscard]] const_iterator begin() const noexcept { return name_values.begin(); }
+	[[nodiscard]] const_iterator end() const noexcept { return name_values.end(); }
+
+	bool operator==(ParamSet const& other) const;
+	bool operator!=(ParamSet const& other) const;
+
+private:
+	/** Sorted by parameter name, with values holding the exact SCIP parameter type. */
+	std::vector<value_type> name_values;
+	std::size_t the_hash = 0;
+
+	static ParamSet from_resolved(std::vector<value_type>&& resolved_name_values) noexcept;
+};
+
+}  // namespace ecole::scip
+
+namespace std {
+
+template <> struct hash<ecole::scip::ParamSet> {
+	std::size_t operator()(ecole::scip::ParamSet const& param_set) const noexcept { return param_set.hash(); }
+};
+
+}  // namespace std
@@ -1,9 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <scip/scip.h>
 
+#include "ecole/scip/bound-tracker.hpp"
+#include "ecole/scip/lp-snapshot.hpp"
 #include "ecole/utility/reverse-control.hpp"
 
 namespace ecole::scip {
@@ -15,7 +19,7 @@ struct ScipDeleter {
 class Scimpl {
 public:
 	Scimpl();
-	Scimpl(std::unique_ptr<SCIP, ScipDeleter>&& /*scip_ptr*/) noexcept;
+	Scimpl(std::unique_ptr<SCIP, ScipDeleter>&& /*scip_ptr*/);
 
 	SCIP* get_scip_ptr() noexcept;
 
@@ -23,12 +27,37 @@ public:
 
 	void solve_iter();
 	void solve_iter_branch(SCIP_VAR* var);
+	void solve_iter_nodesel();
+	void solve_iter_select_node(SCIP_NODE* node);
+	void solve_iter_heur(int freq);
+	void solve_iter_continue();
+	void solve_iter_sepa();
+	void solve_iter_select_cuts(std::vector<SCIP_ROW*> cuts);
 	void solve_iter_stop();
 	bool solve_iter_is_done();
 
+	/**
+	 * The snapshot of the current LP, gathered again only if the LP changed.
+	 *
+	 * Safe to call concurrently, as long as the model is not otherwise modified.
+	 */
+	LpSnapshot const& lp_snapshot();
+
+	/** Start updating the bound tracker with the event handler included at creation, if not already tracking. */
+	void track_bounds();
+	/** The bound tracker, or null if bounds are not tracked. */
+	BoundTracker const* bound_tracker() const noexcept { return m_bound_tracker.get(); }
+	/** Update the bound tracker, if any, with the current bounds of SCIP. */
+	void update_bound_tracker();
+
 private:
 	std::unique_ptr<SCIP, ScipDeleter> m_scip = nullptr;
 	std::unique_ptr<utility::Controller> m_controller = nullptr;
+	LpSnapshot m_lp_snapshot;
+	/** Behind a pointer to keep Scimpl movable. */
+	std::unique_ptr<std::mutex> m_lp_snapshot_mutex = std::make_unique<std::mutex>();
+	/** Shared with the event handler, which SCIP may free after the Scimpl members. */
+	std::shared_ptr<BoundTracker> m_bound_tracker = nullptr;
 };
 
 }  // namespace ecole::scip
@@ -49,6 +49,8 @@ using Stage = SCIP_STAGE;
 using Var = SCIP_VAR;
 using Col = SCIP_COL;
 using Row = SCIP_ROW;
+using Node = SCIP_NODE;
+using Heur = SCIP_HEUR;
 
 /**
  * Class template to store the number of elements in Scip enums.
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <scip/scip.h>
+
+#include "ecole/scip/type.hpp"
+
+namespace ecole::scip {
+
+/**
+ * Release a SCIP variable once it is not needed by its creator anymore.
+ */
+class VarReleaser {
+public:
+	VarReleaser(SCIP* scip_) noexcept : scip(scip_) {}
+	void operator()(Var* ptr);
+
+private:
+	SCIP* scip = nullptr;
+};
+
+using unique_var = std::unique_ptr<Var, VarReleaser>;
+
+/**
+ * Create a variable with the given bounds, objective coefficient, and type.
+ */
+auto create_var_basic(SCIP* scip, std::string const& name, real lb, real ub, real obj, SCIP_VARTYPE vtype)
+	-> unique_var;
+
+/**
+ * Create a variable and add it to the problem.
+ *
+ * The problem captures the variable, which is also returned to add it in constraints.
+ */
+auto add_var_basic(SCIP* scip, std::string const& name, real lb, real ub, real obj, SCIP_VARTYPE vtype)
+	-> unique_var;
+
+}  // namespace ecole::scip
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <scip/scip.h>
+
+#include "ecole/scip/model.hpp"
+
+namespace ecole::scip {
+
+/**
+ * Interrupt solves that exceed their time limit.
+ *
+ * A single background thread watches any number of models, possibly solving in different threads, and interrupts
+ * with ``SCIPinterruptSolve`` those whose deadline has passed.
+ * Unlike the SCIP ``limits/time`` parameter, the limit includes the time spent outside of SCIP, such as the time spent
+ * by a policy in an environment.
+ */
+class Watchdog {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	/** How often expired solves are interrupted again, in case they were not interruptible yet. */
+	static auto constexpr poll_interval = std::chrono::milliseconds{10};
+
+	/**
+	 * A handle on a watched model, the model stops being watched when the handle is destructed.
+	 *
+	 * The handle must be destructed before the model, or before it is reset with another problem.
+	 */
+	class Deadline {
+	public:
+		Deadline(Deadline const&) = delete;
+		Deadline(Deadline&&) noexcept = default;
+		~Deadline();
+
+		Deadline& operator=(Deadline const&) = delete;
+		Deadline& operator=(Deadline&&) = delete;
+
+		/** Whether the time limit has passed, after which the model is interrupted, never for moved from handles. */
+		[[nodiscard]] bool expired() const noexcept;
+
+	private:
+		friend class Watchdog;
+		struct Entry {
+			SCIP* scip;
+			Clock::time_point deadline;
+			std::atomic<bool> expired{false};
+		};
+
+		Watchdog* watchdog;
+		std::shared_ptr<Entry> entry;
+
+		Deadline(Watchdog* watchdog, std::shared_ptr<Entry> entry) noexcept;
+	};
+
+	Watchdog();
+	Watchdog(Watchdog const&) = delete;
+	Watchdog(Watchdog&&) = delete;
+	~Watchdog();
+
+	Watchdog& operator=(Watchdog const&) = delete;
+	Watchdog& operator=(Watchdog&&) = delete;
+
+	/**
+	 * Interrupt the model if it is still presolving or solving after the given duration.
+	 *
+	 * The underlying SCIP pointer is watched, so the model can be moved (e.g. into an environment) while the handle
+	 * is alive.
+	 */
+	[[nodiscard]] Deadline watch(Model const& model, Clock::duration time_limit);
+
+private:
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::vector<std::shared_ptr<Deadline::Entry>> entries;
+	bool stopping = false;
+	std::thread monitor;
+
+	void unwatch(Deadline::Entry const* entry);
+	void run_monitor();
+};
+
+}  // namespace ecole::scip
@@ -52,6 +52,28 @@ using is_information_function =
 	std::conjunction<is_data_function<T>, internal::extract_return_is<T, is_information_map>>;
 template <typename T> inline constexpr bool is_information_function_v = is_information_function<T>::value;
 
+/*******************************************
+ *  Detection of read-only data functions  *
+ *******************************************/
+
+namespace internal {
+
+template <typename, typename = std::void_t<>> struct has_read_only : std::false_type {};
+template <typename T>
+struct has_read_only<T, std::void_t<decltype(T::read_only)>> : std::bool_constant<static_cast<bool>(T::read_only)> {};
+
+}  // namespace internal
+
+/**
+ * Whether a data function only reads the model when extracting, and can run concurrently with other such functions.
+ *
+ * Data functions opt in with a ``static constexpr bool read_only = true`` member.
+ * Others are assumed to modify the model.
+ */
+template <typename T>
+using is_read_only_data_function = std::conjunction<is_data_function<T>, internal::has_read_only<T>>;
+template <typename T> inline constexpr bool is_read_only_data_function_v = is_read_only_data_function<T>::value;
+
 /******************************
  *  Detection of environment  *
  ******************************/
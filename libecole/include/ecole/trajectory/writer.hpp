@@ -0,0 +1,128 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include <xtensor/xarray.hpp>
+
+#include "ecole/observation/nodebipartite.hpp"
+#include "ecole/utility/sparse-matrix.hpp"
+
+namespace ecole::trajectory {
+
+/** An array of data recorded for one step. */
+using Column = std::variant<xt::xarray<double>, xt::xarray<std::size_t>, xt::xarray<std::int64_t>>;
+
+/** The named arrays recorded for one step. */
+using Record = std::map<std::string, Column>;
+
+/**
+ * Add the arrays of a sparse matrix to a record.
+ *
+ * The matrix is recorded as ``<name>.values``, ``<name>.indices`` (transposed, with one row per non zero), and
+ * ``<name>.shape``.
+ */
+void add_columns(Record& record, std::string const& name, utility::coo_matrix<double> const& matrix);
+
+/**
+ * Add the arrays of a NodeBipartite observation to a record.
+ *
+ * The observation is recorded as ``<name>.column_features``, ``<name>.row_features``, and the ``<name>.edge_features``
+ * sparse matrix.
+ */
+void add_columns(Record& record, std::string const& name, observation::NodeBipartiteObs const& obs);
+
+/**
+ * Record trajectories in a compact on-disk format.
+ *
+ * Records are written in a directory, in chunks of a fixed number of steps.
+ * Every chunk is a directory holding one ``.npy`` file per column, where the arrays of all the steps of the chunk are
+ * concatenated along the first dimension.
+ * Non scalar columns are accompanied with an ``.offsets.npy`` file giving the first row of every step.
+ * Files can be memory mapped back without copying, for instance with ``ecole.trajectory.TrajectoryReader``.
+ *
+ * Records are copied in a queue and written by a background thread.
+ * Every record of a chunk must have the same columns, with the same types and trailing dimensions.
+ */
+class TrajectoryWriter {
+public:
+	struct Options {
+		/** Number of steps per chunk. */
+		std::size_t chunk_size = 1024;  // NOLINT(readability-magic-numbers)
+		/** Maximum number of records waiting to be written before write blocks. */
+		std::size_t queue_size = 256;  // NOLINT(readability-magic-numbers)
+	};
+
+	/**
+	 * Start the writing thread.
+	 *
+	 * The directory is created if needed, and new chunks are numbered after the ones already present.
+	 */
+	TrajectoryWriter(std::string directory, Options options = {});
+	TrajectoryWriter(TrajectoryWriter const&) = delete;
+	TrajectoryWriter(TrajectoryWriter&&) = delete;
+	~TrajectoryWriter();
+
+	TrajectoryWriter& operator=(TrajectoryWriter const&) = delete;
+	TrajectoryWriter& operator=(TrajectoryWriter&&) = delete;
+
+	/**
+	 * Queue a record to be written.
+	 *
+	 * Errors from the writing thread are rethrown by the next call to write or flush.
+	 */
+	void write(Record record);
+
+	/**
+	 * Wait for queued records to be written, and write the current (incomplete) chunk.
+	 */
+	void flush();
+
+	[[nodiscard]] std::string const& directory() const noexcept { return the_directory; }
+	[[nodiscard]] Options const& get_options() const noexcept { return options; }
+
+private:
+	/** Accumulate the data of a column for the current chunk. */
+	struct ColumnBuffer {
+		std::variant<std::vector<double>, std::vector<std::size_t>> data;
+		std::vector<std::size_t> trailing_shape;
+		std::vector<std::size_t> offsets;
+		bool scalar = false;
+	};
+
+	std::string the_directory;
+	Options options;
+
+	std::mutex mutex;
+	std::condition_variable queue_cv;
+	/** Records to write, where an empty record asks to write the current chunk. */
+	std::queue<std::optional<Record>> records;
+	std::size_t n_flush_requested = 0;
+	std::size_t n_flush_done = 0;
+	bool stopping = false;
+	std::exception_ptr error;
+	std::thread worker;
+
+	/** Only accessed by the writing thread. */
+	std::map<std::string, ColumnBuffer> chunk;
+	std::size_t chunk_n_steps = 0;
+	std::size_t next_chunk_id = 0;
+
+	void run_worker();
+	void append(Record const& record);
+	void write_chunk();
+	/** Must be called with the mutex locked. */
+	void rethrow_error();
+};
+
+}  // namespace ecole::trajectory
@@ -11,6 +11,8 @@
 
 #include <scip/scip.h>
 
+#include "ecole/instrumentation.hpp"
+
 namespace ecole::utility {
 
 class Controller {
@@ -47,6 +49,12 @@ private:
 		bool thread_owns_model = true;
 		bool thread_finished = false;
 		action_func_t action_func;
+#ifdef ECOLE_INSTRUMENTATION
+		/** When the model was last given to the other thread. */
+		instrumentation::Clock::time_point handoff_start;
+		/** Time taken by the solving thread to resume, recorded with the next handoff to the environment. */
+		instrumentation::Clock::duration resume_latency{0};
+#endif
 
 		[[nodiscard]] auto is_valid_lock(lock_t const& lk) const noexcept -> bool;
 		auto maybe_throw(lock_t&& lk) -> lock_t;
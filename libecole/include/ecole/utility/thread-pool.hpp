@@ -0,0 +1,70 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ecole::utility {
+
+/**
+ * A fixed size pool of threads executing tasks in submission order.
+ *
+ * Results and exceptions of the tasks are retrieved through the returned futures.
+ * Remaining tasks are run before the pool is destructed.
+ */
+class ThreadPool {
+public:
+	/**
+	 * Start the threads of the pool.
+	 *
+	 * @param n_threads The number of threads to use, or the hardware concurrency if zero.
+	 */
+	ThreadPool(std::size_t n_threads = 0);
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool(ThreadPool&&) = delete;
+	~ThreadPool();
+
+	ThreadPool& operator=(ThreadPool const&) = delete;
+	ThreadPool& operator=(ThreadPool&&) = delete;
+
+	[[nodiscard]] auto size() const noexcept -> std::size_t { return workers.size(); }
+
+	/**
+	 * Schedule a function to be executed by one of the threads.
+	 */
+	template <typename Function> auto submit(Function&& func) -> std::future<std::invoke_result_t<Function>>;
+
+private:
+	std::mutex tasks_mutex;
+	std::condition_variable tasks_cv;
+	std::queue<std::function<void()>> tasks;
+	bool stopping = false;
+	std::vector<std::thread> workers;
+
+	auto enqueue(std::function<void()>&& task) -> void;
+	auto run_worker() -> void;
+};
+
+/**********************************
+ *  Implementation of ThreadPool  *
+ **********************************/
+
+template <typename Function>
+auto ThreadPool::submit(Function&& func) -> std::future<std::invoke_result_t<Function>> {
+	using Result = std::invoke_result_t<Function>;
+	// std::function needs to be copyable but std::packaged_task is not
+	auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(func));
+	auto future = task->get_future();
+	enqueue([task] { (*task)(); });
+	return future;
+}
+
+}  // namespace ecole::utility
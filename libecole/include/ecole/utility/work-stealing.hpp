@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ecole::utility {
+
+/**
+ * Run the tasks ``0, ..., n_tasks - 1`` on threads stealing work from each other.
+ *
+ * Tasks are first split in contiguous ranges, one per thread, and every thread runs its own tasks in order.
+ * A thread out of tasks steals the last task of another thread, so that no thread stays idle while tasks are waiting,
+ * even when task durations are very heterogeneous.
+ * The function is called with the task and the index of the thread running it, so that threads can reuse their own
+ * resources.
+ *
+ * After an exception, no new task is started, and the first exception is rethrown once all threads are finished.
+ *
+ * @param n_threads The number of threads to use, or the hardware concurrency if zero.
+ */
+void run_work_stealing(
+	std::size_t n_tasks,
+	std::size_t n_threads,
+	std::function<void(std::size_t task, std::size_t thread)> const& func);
+
+}  // namespace ecole::utility
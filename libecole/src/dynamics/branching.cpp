@@ -1,6 +1,8 @@
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <xtensor/xtensor.hpp>
 
@@ -12,15 +14,19 @@
 
 namespace ecole::dynamics {
 
-BranchingDynamics::BranchingDynamics(bool pseudo_candidates_) noexcept : pseudo_candidates(pseudo_candidates_) {}
+BranchingDynamics::BranchingDynamics(bool pseudo_candidates_) : pseudo_candidates(pseudo_candidates_) {}
 
 namespace {
 
+nonstd::span<scip::Var*> branching_candidates(scip::Model const& model, bool pseudo) {
+	return pseudo ? model.pseudo_branch_cands() : model.lp_branch_cands();
+}
+
 std::optional<xt::xtensor<std::size_t, 1>> action_set(scip::Model const& model, bool pseudo) {
 	if (model.get_stage() != SCIP_STAGE_SOLVING) {
 		return {};
 	}
-	auto const branch_cands = pseudo ? model.pseudo_branch_cands() : model.lp_branch_cands();
+	auto const branch_cands = branching_candidates(model, pseudo);
 	auto branch_cols = xt::xtensor<std::size_t, 1>::from_shape({branch_cands.size()});
 	std::transform(  //
 		branch_cands.begin(),
@@ -34,13 +40,46 @@ std::optional<xt::xtensor<std::size_t, 1>> action_set(scip::Model const& model,
 
 }  // namespace
 
+auto BranchingDynamics::update_candidates(scip::Model const& model, bool done) -> ActionSet {
+	// Only the mask entries of the previous candidates are reset, rather than the whole mask
+	auto& mask = *cand_mask;
+	for (auto const col : candidate_indices()) {
+		if (col < mask.size()) {
+			mask[col] = 0;
+		}
+	}
+	n_cands = 0;
+	n_lp_cols = 0;
+	if (done || (model.get_stage() != SCIP_STAGE_SOLVING)) {
+		return {};
+	}
+
+	auto const branch_cands = branching_candidates(model, pseudo_candidates);
+	n_lp_cols = static_cast<std::size_t>(SCIPgetNLPCols(model.get_scip_ptr()));
+	// Buffers are replaced when too small, as views of the previous ones may still be in use
+	if (cand_cols->size() < branch_cands.size()) {
+		cand_cols = std::make_shared<std::vector<std::size_t>>(branch_cands.size());
+	}
+	if (cand_mask->size() < n_lp_cols) {
+		cand_mask = std::make_shared<std::vector<std::int32_t>>(n_lp_cols, 0);
+	}
+
+	auto& cols = *cand_cols;
+	for (auto* const var : branch_cands) {
+		auto const lp_pos = SCIPcolGetLPPos(SCIPvarGetCol(var));
+		cols[n_cands++] = static_cast<std::size_t>(lp_pos);
+		// Pseudo candidates whose column is not in the LP have no position
+		if (lp_pos >= 0) {
+			(*cand_mask)[static_cast<std::size_t>(lp_pos)] = 1;
+		}
+	}
+	return candidate_indices();
+}
+
 auto BranchingDynamics::reset_dynamics(scip::Model& model) -> std::tuple<bool, ActionSet> {
 	model.solve_iter();
 	auto const done = model.solve_iter_is_done();
-	if (done) {
-		return {done, {}};
-	}
-	return {done, action_set(model, pseudo_candidates)};
+	return {done, update_candidates(model, done)};
 }
 
 auto BranchingDynamics::step_dynamics(scip::Model& model, std::size_t const& action) -> std::tuple<bool, ActionSet> {
@@ -50,6 +89,16 @@ auto BranchingDynamics::step_dynamics(scip::Model& model, std::size_t const& act
 	}
 	model.solve_iter_branch(SCIPcolGetVar(lp_cols[action]));
 
+	auto const done = model.solve_iter_is_done();
+	return {done, update_candidates(model, done)};
+}
+
+BatchedBranchingDynamics::BatchedBranchingDynamics(bool pseudo_candidates_, std::size_t refresh_interval_) noexcept :
+	pseudo_candidates(pseudo_candidates_), refresh_interval(refresh_interval_) {}
+
+auto BatchedBranchingDynamics::reset_dynamics(scip::Model& model) -> std::tuple<bool, ActionSet> {
+	n_branchings = 0;
+	model.solve_iter();
 	auto const done = model.solve_iter_is_done();
 	if (done) {
 		return {done, {}};
@@ -57,4 +106,50 @@ auto BranchingDynamics::step_dynamics(scip::Model& model, std::size_t const& act
 	return {done, action_set(model, pseudo_candidates)};
 }
 
+auto BatchedBranchingDynamics::step_dynamics(scip::Model& model, Action const& action) -> std::tuple<bool, ActionSet> {
+	auto const lp_cols = model.lp_columns();
+	// Columns positions may change between nodes, so the ranking is kept as variables
+	auto ranking = std::vector<scip::Var*>(action.size());
+	std::transform(action.begin(), action.end(), ranking.begin(), [&lp_cols](auto const idx) {
+		if (idx >= lp_cols.size()) {
+			throw Exception{"Branching index is larger than the number of columns."};
+		}
+		return SCIPcolGetVar(lp_cols[idx]);
+	});
+	// Rank of every ranked variable, so that each node only scans its candidates once
+	auto rank_of = std::unordered_map<scip::Var*, std::size_t>{};
+	rank_of.reserve(ranking.size());
+	for (std::size_t rank = 0; rank < ranking.size(); ++rank) {
+		rank_of.emplace(ranking[rank], rank);  // Keeps the first rank of duplicates
+	}
+
+	n_branchings = 0;
+	while (true) {
+		auto const branch_cands = branching_candidates(model, pseudo_candidates);
+		auto const is_ranked = [&rank_of](auto* var) { return rank_of.count(var) > 0; };
+		if (n_branchings > 0) {
+			auto const interval_elapsed = (refresh_interval > 0) && (n_branchings >= refresh_interval);
+			if (interval_elapsed || !std::all_of(branch_cands.begin(), branch_cands.end(), is_ranked)) {
+				break;
+			}
+		}
+		auto best = ranking.size();
+		for (auto* const var : branch_cands) {
+			if (auto const iter = rank_of.find(var); iter != rank_of.end()) {
+				best = std::min(best, iter->second);
+			}
+		}
+		if (best == ranking.size()) {
+			throw Exception{"None of the ranked columns is a branching candidate."};
+		}
+		model.solve_iter_branch(ranking[best]);
+		++n_branchings;
+
+		if (model.solve_iter_is_done()) {
+			return {true, {}};
+		}
+	}
+	return {false, action_set(model, pseudo_candidates)};
+}
+
 }  // namespace ecole::dynamics
@@ -0,0 +1,56 @@
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/dynamics/cut-selection.hpp"
+#include "ecole/exception.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::dynamics {
+
+namespace {
+
+auto action_set(scip::Model const& model) -> CutSelectionDynamics::ActionSet {
+	if (model.get_stage() != SCIP_STAGE_SOLVING) {
+		return {};
+	}
+	auto indices = xt::xtensor<std::size_t, 1>::from_shape({model.cuts().size()});
+	std::iota(indices.begin(), indices.end(), std::size_t{0});
+	return indices;
+}
+
+}  // namespace
+
+auto CutSelectionDynamics::reset_dynamics(scip::Model& model) -> std::tuple<bool, ActionSet> {
+	model.solve_iter_cut_selection();
+	auto const done = model.solve_iter_is_done();
+	if (done) {
+		return {done, {}};
+	}
+	return {done, action_set(model)};
+}
+
+auto CutSelectionDynamics::step_dynamics(scip::Model& model, Action const& action) -> std::tuple<bool, ActionSet> {
+	auto const cuts = model.cuts();
+	if (action.size() != cuts.size()) {
+		throw Exception{fmt::format("Cut mask has size {} but there are {} cuts.", action.size(), cuts.size())};
+	}
+	auto selected = std::vector<scip::Row*>{};
+	for (std::size_t i = 0; i < cuts.size(); ++i) {
+		if (action[i]) {
+			selected.push_back(cuts[i]);
+		}
+	}
+	model.solve_iter_select_cuts(std::move(selected));
+
+	auto const done = model.solve_iter_is_done();
+	if (done) {
+		return {done, {}};
+	}
+	return {done, action_set(model)};
+}
+
+}  // namespace ecole::dynamics
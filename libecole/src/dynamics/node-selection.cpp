@@ -0,0 +1,49 @@
+#include <numeric>
+
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/dynamics/node-selection.hpp"
+#include "ecole/exception.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::dynamics {
+
+auto NodeSelectionDynamics::action_set(scip::Model const& model) -> ActionSet {
+	nodes.clear();
+	if (model.get_stage() != SCIP_STAGE_SOLVING) {
+		return {};
+	}
+	for (auto const open_nodes : {model.leaves(), model.children(), model.siblings()}) {
+		nodes.insert(nodes.end(), open_nodes.begin(), open_nodes.end());
+	}
+	auto indices = xt::xtensor<std::size_t, 1>::from_shape({nodes.size()});
+	std::iota(indices.begin(), indices.end(), std::size_t{0});
+	return indices;
+}
+
+auto NodeSelectionDynamics::reset_dynamics(scip::Model& model) -> std::tuple<bool, ActionSet> {
+	model.solve_iter_nodesel();
+	auto const done = model.solve_iter_is_done();
+	if (done) {
+		nodes.clear();
+		return {done, {}};
+	}
+	return {done, action_set(model)};
+}
+
+auto NodeSelectionDynamics::step_dynamics(scip::Model& model, std::size_t const& action)
+	-> std::tuple<bool, ActionSet> {
+	if (action >= nodes.size()) {
+		throw Exception{"Node index is larger than the number of open nodes."};
+	}
+	model.solve_iter_select_node(nodes[action]);
+
+	auto const done = model.solve_iter_is_done();
+	if (done) {
+		nodes.clear();
+		return {done, {}};
+	}
+	return {done, action_set(model)};
+}
+
+}  // namespace ecole::dynamics
@@ -0,0 +1,131 @@
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "ecole/dynamics/configuring.hpp"
+#include "ecole/dynamics/parallel-configuring.hpp"
+#include "ecole/exception.hpp"
+#include "ecole/utility/thread-pool.hpp"
+
+namespace ecole::dynamics {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Seconds = std::chrono::duration<double>;
+
+/** How often overdue runs are interrupted again, in case they were not interruptible yet. */
+auto constexpr race_poll_interval = std::chrono::milliseconds{10};
+
+}  // namespace
+
+ParallelConfiguringDynamics::ParallelConfiguringDynamics(std::size_t n_threads, std::optional<double> race_factor_) :
+	thread_pool(std::make_unique<utility::ThreadPool>(n_threads)), the_race_factor(race_factor_) {
+	if (the_race_factor.has_value() && (the_race_factor.value() < 1.)) {
+		throw Exception(fmt::format("Race factor must be at least one, got {}", the_race_factor.value()));
+	}
+}
+
+ParallelConfiguringDynamics::ParallelConfiguringDynamics(ParallelConfiguringDynamics&&) noexcept = default;
+ParallelConfiguringDynamics::~ParallelConfiguringDynamics() = default;
+ParallelConfiguringDynamics& ParallelConfiguringDynamics::operator=(ParallelConfiguringDynamics&&) noexcept = default;
+
+void ParallelConfiguringDynamics::set_dynamics_random_state(scip::Model& model, RandomEngine& random_engine) {
+	ConfiguringDynamics{}.set_dynamics_random_state(model, random_engine);
+}
+
+std::vector<bool> ParallelConfiguringDynamics::solve_all(
+	std::vector<scip::Model*> const& models,
+	std::vector<scip::ParamSet> const& param_sets,
+	Hook const& before_solve,
+	Hook const& after_solve) {
+	if (models.size() != param_sets.size()) {
+		throw Exception(
+			fmt::format("Got {} models for {} parameter sets, expected the same number", models.size(), param_sets.size()));
+	}
+	auto const n_runs = models.size();
+
+	// State shared between the workers and the racing monitor, protected by the mutex
+	auto mutex = std::mutex{};
+	auto finished_cv = std::condition_variable{};
+	auto starts = std::vector<std::optional<Clock::time_point>>(n_runs);
+	auto finished = std::vector<bool>(n_runs, false);
+	auto raced_out = std::vector<bool>(n_runs, false);
+	auto n_finished = std::size_t{0};
+	auto fastest = std::optional<Seconds>{};
+
+	auto const mark_finished = [&](std::size_t i) {
+		{
+			auto const lk = std::lock_guard{mutex};
+			finished[i] = true;
+			++n_finished;
+			if (starts[i].has_value() && models[i]->is_solved() && !fastest.has_value()) {
+				fastest = Clock::now() - starts[i].value();
+			}
+		}
+		finished_cv.notify_all();
+	};
+
+	auto futures = std::vector<std::future<void>>{};
+	futures.reserve(n_runs);
+	for (std::size_t i = 0; i < n_runs; ++i) {
+		futures.push_back(thread_pool->submit([&, i] {
+			try {
+				if (before_solve) {
+					before_solve(i);
+				}
+				param_sets[i].apply(*models[i]);
+				{
+					auto const lk = std::lock_guard{mutex};
+					starts[i] = Clock::now();
+				}
+				models[i]->solve();
+			} catch (...) {
+				mark_finished(i);
+				throw;
+			}
+			mark_finished(i);
+			if (after_solve) {
+				after_solve(i);
+			}
+		}));
+	}
+
+	// Racing monitor, interrupting the runs that take too long compared to the fastest solved run
+	{
+		auto lk = std::unique_lock{mutex};
+		auto const racing = [&] { return the_race_factor.has_value() && fastest.has_value(); };
+		while (n_finished < n_runs) {
+			if (!racing()) {
+				finished_cv.wait(lk, [&] { return (n_finished == n_runs) || racing(); });
+				continue;
+			}
+			auto const deadline = fastest.value() * the_race_factor.value();
+			auto const now = Clock::now();
+			for (std::size_t i = 0; i < n_runs; ++i) {
+				if (starts[i].has_value() && !finished[i] && (now - starts[i].value() > deadline)) {
+					models[i]->interrupt_solve();
+					raced_out[i] = true;
+				}
+			}
+			finished_cv.wait_for(lk, race_poll_interval);
+		}
+	}
+
+	// Wait for all tasks (including the hooks) before rethrowing any exception
+	for (auto& future : futures) {
+		future.wait();
+	}
+	auto completed = std::vector<bool>(n_runs);
+	for (std::size_t i = 0; i < n_runs; ++i) {
+		futures[i].get();
+		completed[i] = !raced_out[i] || models[i]->is_solved();
+	}
+	return completed;
+}
+
+}  // namespace ecole::dynamics
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <string>
+
+#include <fmt/format.h>
+#include <scip/scip.h>
+
+#include "ecole/dynamics/primal-heuristic.hpp"
+#include "ecole/exception.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::dynamics {
+
+PrimalHeuristicDynamics::PrimalHeuristicDynamics(int frequency_) noexcept : frequency(frequency_) {}
+
+namespace {
+
+auto action_set(scip::Model const& model) -> PrimalHeuristicDynamics::ActionSet {
+	if (model.get_stage() != SCIP_STAGE_SOLVING) {
+		return {};
+	}
+	auto const heurs = model.heuristics();
+	auto names = std::vector<std::string>(heurs.size());
+	std::transform(heurs.begin(), heurs.end(), names.begin(), [](auto* heur) { return SCIPheurGetName(heur); });
+	return names;
+}
+
+bool has_param(scip::Model const& model, std::string const& name) {
+	return SCIPgetParam(model.get_scip_ptr(), name.c_str()) != nullptr;
+}
+
+/** Set the parameters of a heuristic for the given budget. */
+void schedule(scip::Model& model, std::string const& heur_name, double budget) {
+	auto const prefix = fmt::format("heuristics/{}/", heur_name);
+	if (budget <= 0) {
+		model.set_param(prefix + "freq", -1);
+		return;
+	}
+	model.set_param(prefix + "freq", 1);
+	model.set_param(prefix + "freqofs", 0);
+	model.set_param(prefix + "maxdepth", -1);
+	for (auto const* effort : {"maxlpiterquot", "nodesquot"}) {
+		if (has_param(model, prefix + effort)) {
+			model.set_param(prefix + effort, budget);
+		}
+	}
+}
+
+}  // namespace
+
+auto PrimalHeuristicDynamics::reset_dynamics(scip::Model& model) -> std::tuple<bool, ActionSet> {
+	model.solve_iter_heuristic(frequency);
+	auto const done = model.solve_iter_is_done();
+	if (done) {
+		return {done, {}};
+	}
+	return {done, action_set(model)};
+}
+
+auto PrimalHeuristicDynamics::step_dynamics(scip::Model& model, Action const& action) -> std::tuple<bool, ActionSet> {
+	auto const heurs = model.heuristics();
+	for (auto const& [name, budget] : action) {
+		auto const is_heur = [&name](auto* heur) { return name == SCIPheurGetName(heur); };
+		if (std::none_of(heurs.begin(), heurs.end(), is_heur)) {
+			throw Exception{fmt::format("Unknown primal heuristic '{}'.", name)};
+		}
+	}
+	for (auto* const heur : heurs) {
+		auto const name = std::string{SCIPheurGetName(heur)};
+		auto const iter = action.find(name);
+		schedule(model, name, (iter != action.end()) ? iter->second : 0.);
+	}
+	model.solve_iter_continue();
+
+	auto const done = model.solve_iter_is_done();
+	if (done) {
+		return {done, {}};
+	}
+	return {done, action_set(model)};
+}
+
+}  // namespace ecole::dynamics
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <future>
+#include <tuple>
+#include <utility>
+
+#include <fmt/format.h>
+#include <scip/scip.h>
+
+#include "ecole/dynamics/racing-configuring.hpp"
+#include "ecole/exception.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/utility/thread-pool.hpp"
+
+namespace ecole::dynamics {
+
+namespace {
+
+/** SCIP value for wall clock timing. */
+auto constexpr wall_clock_type = 2;
+
+struct Candidate {
+	std::size_t index;
+	scip::Model model;
+	scip::real time_limit;
+};
+
+/** A candidate is paused if it stopped on the time slice limit and not on its own time limit. */
+bool is_paused(Candidate const& candidate, scip::real slice_limit) {
+	auto* const scip = candidate.model.get_scip_ptr();
+	return (SCIPgetStatus(scip) == SCIP_STATUS_TIMELIMIT) && (slice_limit < candidate.time_limit);
+}
+
+/** Order candidates by gap, then by solving time, then by their position in the action. */
+bool is_better(Candidate const& first, Candidate const& second) {
+	auto* const first_scip = first.model.get_scip_ptr();
+	auto* const second_scip = second.model.get_scip_ptr();
+	return std::tuple{SCIPgetGap(first_scip), SCIPgetSolvingTime(first_scip), first.index} <
+				 std::tuple{SCIPgetGap(second_scip), SCIPgetSolvingTime(second_scip), second.index};
+}
+
+/** Solve all candidates concurrently until the given cumulative time limit. */
+void solve_until(utility::ThreadPool& thread_pool, std::vector<Candidate>& candidates, scip::real slice_limit) {
+	auto futures = std::vector<std::future<void>>{};
+	futures.reserve(candidates.size());
+	for (auto& candidate : candidates) {
+		futures.push_back(thread_pool.submit([&candidate, slice_limit] {
+			// Time limits are cumulative over calls to SCIPsolve
+			candidate.model.set_param("limits/time", std::min(slice_limit, candidate.time_limit));
+			candidate.model.solve();
+		}));
+	}
+	// Wait for all solves before rethrowing any exception
+	for (auto& future : futures) {
+		future.wait();
+	}
+	for (auto& future : futures) {
+		future.get();
+	}
+}
+
+}  // namespace
+
+RacingConfiguringDynamics::RacingConfiguringDynamics(
+	scip::real time_slice_,
+	scip::real keep_fraction_,
+	std::size_t n_threads) :
+	thread_pool(std::make_unique<utility::ThreadPool>(n_threads)),
+	the_time_slice(time_slice_),
+	the_keep_fraction(keep_fraction_) {
+	if (the_time_slice <= 0.) {
+		throw Exception(fmt::format("Time slice must be positive, got {}", the_time_slice));
+	}
+	if ((the_keep_fraction <= 0.) || (the_keep_fraction >= 1.)) {
+		throw Exception(fmt::format("Keep fraction must be in (0, 1), got {}", the_keep_fraction));
+	}
+}
+
+RacingConfiguringDynamics::RacingConfiguringDynamics(RacingConfiguringDynamics&&) noexcept = default;
+RacingConfiguringDynamics::~RacingConfiguringDynamics() = default;
+RacingConfiguringDynamics& RacingConfiguringDynamics::operator=(RacingConfiguringDynamics&&) noexcept = default;
+
+std::tuple<bool, NoneType> RacingConfiguringDynamics::reset_dynamics(scip::Model& /* model */) {
+	return {false, None};
+}
+
+std::tuple<bool, NoneType>
+RacingConfiguringDynamics::step_dynamics(scip::Model& model, std::vector<scip::ParamSet> const& param_sets) {
+	if (param_sets.empty()) {
+		throw Exception("Need at least one configuration to race");
+	}
+
+	auto candidates = std::vector<Candidate>{};
+	candidates.reserve(param_sets.size());
+	for (std::size_t i = 0; i < param_sets.size(); ++i) {
+		// Parameters, including the random state, are copied along with the problem
+		auto candidate_model = model.copy_orig();
+		param_sets[i].apply(candidate_model);
+		// Process time is meaningless with concurrent solves
+		candidate_model.set_param("timing/clocktype", wall_clock_type);
+		auto const time_limit = candidate_model.get_param<scip::real>("limits/time");
+		candidates.push_back({i, std::move(candidate_model), time_limit});
+	}
+
+	the_n_rounds = 0;
+	while (candidates.size() > 1) {
+		++the_n_rounds;
+		auto const slice_limit = static_cast<scip::real>(the_n_rounds) * the_time_slice;
+		solve_until(*thread_pool, candidates, slice_limit);
+
+		// Stop the race as soon as one candidate has finished
+		auto const paused_end = std::stable_partition(
+			candidates.begin(), candidates.end(), [slice_limit](auto const& c) { return is_paused(c, slice_limit); });
+		if (paused_end != candidates.end()) {
+			auto const best = std::min_element(paused_end, candidates.end(), is_better);
+			std::iter_swap(candidates.begin(), best);
+			candidates.erase(candidates.begin() + 1, candidates.end());
+			break;
+		}
+
+		// Prune the candidates with the largest gaps
+		std::sort(candidates.begin(), candidates.end(), is_better);
+		auto const n_candidates = static_cast<double>(candidates.size());
+		auto const n_keep = static_cast<std::ptrdiff_t>(std::ceil(the_keep_fraction * n_candidates));
+		candidates.erase(candidates.begin() + std::max(n_keep, std::ptrdiff_t{1}), candidates.end());
+	}
+
+	// Finish the solve of the winner, this does nothing if it is already solved
+	auto& winner = candidates.front();
+	winner.model.set_param("limits/time", winner.time_limit);
+	winner.model.solve();
+
+	the_winner = winner.index;
+	model = std::move(winner.model);
+	return {true, None};
+}
+
+}  // namespace ecole::dynamics
@@ -0,0 +1,137 @@
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <scip/scip.h>
+
+#include "ecole/instance/capacitated-facility-location.hpp"
+#include "ecole/scip/cons.hpp"
+#include "ecole/scip/var.hpp"
+
+namespace ecole::instance {
+
+namespace {
+
+template <typename Distribution>
+auto sample(std::size_t n_samples, Distribution distrib, RandomEngine& random_engine) {
+	auto samples = std::vector<typename Distribution::result_type>(n_samples);
+	for (auto& val : samples) {
+		val = distrib(random_engine);
+	}
+	return samples;
+}
+
+}  // namespace
+
+scip::Model
+CapacitatedFacilityLocationGenerator::generate_instance(Parameters parameters, RandomEngine& random_engine) {
+	auto const n_customers = parameters.n_customers;
+	auto const n_facilities = parameters.n_facilities;
+	using real_distrib = std::uniform_real_distribution<double>;
+	using int_distrib = std::uniform_int_distribution<int>;
+
+	auto const c_x = sample(n_customers, real_distrib{0., 1.}, random_engine);
+	auto const c_y = sample(n_customers, real_distrib{0., 1.}, random_engine);
+	auto const f_x = sample(n_facilities, real_distrib{0., 1.}, random_engine);
+	auto const f_y = sample(n_facilities, real_distrib{0., 1.}, random_engine);
+
+	auto const demands = sample(n_customers, int_distrib{5, 35}, random_engine);  // NOLINT(readability-magic-numbers)
+	auto capacities = sample(n_facilities, int_distrib{10, 160}, random_engine);  // NOLINT(readability-magic-numbers)
+	auto const fixed_cost_scale = sample(n_facilities, int_distrib{100, 110}, random_engine);  // NOLINT
+	auto const fixed_cost_shift = sample(n_facilities, int_distrib{0, 90}, random_engine);  // NOLINT
+
+	auto fixed_costs = std::vector<double>(n_facilities);
+	for (std::size_t j = 0; j < n_facilities; ++j) {
+		fixed_costs[j] = std::trunc(
+			fixed_cost_scale[j] * std::sqrt(static_cast<double>(capacities[j])) + fixed_cost_shift[j]);
+	}
+
+	// Adjust capacities according to ratio
+	auto const total_demand = static_cast<double>(std::accumulate(demands.begin(), demands.end(), 0));
+	auto const total_capacity = static_cast<double>(std::accumulate(capacities.begin(), capacities.end(), 0));
+	for (auto& capacity : capacities) {
+		capacity = static_cast<int>(capacity * parameters.ratio * total_demand / total_capacity);
+	}
+
+	auto model = scip::Model::prob_basic();
+	auto* const scip = model.get_scip_ptr();
+	SCIPsetObjsense(scip, SCIP_OBJSENSE_MINIMIZE);
+
+	// Transportation variables from facility to customers, with transportation costs
+	auto x_vars = std::vector<scip::unique_var>{};
+	x_vars.reserve(n_customers * n_facilities);
+	for (std::size_t i = 0; i < n_customers; ++i) {
+		for (std::size_t j = 0; j < n_facilities; ++j) {
+			auto const distance = std::hypot(c_x[i] - f_x[j], c_y[i] - f_y[j]);
+			auto const cost = distance * 10. * demands[i];  // NOLINT(readability-magic-numbers)
+			x_vars.push_back(
+				scip::add_var_basic(scip, fmt::format("x_{}_{}", i + 1, j + 1), 0., 1., cost, SCIP_VARTYPE_CONTINUOUS));
+		}
+	}
+	auto const x_var = [&x_vars, n_facilities](std::size_t i, std::size_t j) {
+		return x_vars[i * n_facilities + j].get();
+	};
+
+	// Facility opening variables, with fixed costs
+	auto y_vars = std::vector<scip::unique_var>{};
+	y_vars.reserve(n_facilities);
+	for (std::size_t j = 0; j < n_facilities; ++j) {
+		y_vars.push_back(
+			scip::add_var_basic(scip, fmt::format("y_{}", j + 1), 0., 1., fixed_costs[j], SCIP_VARTYPE_BINARY));
+	}
+
+	auto const inf = SCIPinfinity(scip);
+
+	// Demand of every customer must be met
+	for (std::size_t i = 0; i < n_customers; ++i) {
+		auto vars = std::vector<scip::Var*>(n_facilities);
+		for (std::size_t j = 0; j < n_facilities; ++j) {
+			vars[j] = x_var(i, j);
+		}
+		auto const coefs = std::vector<scip::real>(n_facilities, -1.);
+		scip::add_cons_basic_linear(scip, fmt::format("demand_{}", i + 1), vars, coefs, -inf, -1.);
+	}
+
+	// Demand served by every facility does not exceed its capacity
+	for (std::size_t j = 0; j < n_facilities; ++j) {
+		auto vars = std::vector<scip::Var*>(n_customers + 1);
+		auto coefs = std::vector<scip::real>(n_customers + 1);
+		for (std::size_t i = 0; i < n_customers; ++i) {
+			vars[i] = x_var(i, j);
+			coefs[i] = demands[i];
+		}
+		vars[n_customers] = y_vars[j].get();
+		coefs[n_customers] = -capacities[j];
+		scip::add_cons_basic_linear(scip, fmt::format("capacity_{}", j + 1), vars, coefs, -inf, 0.);
+	}
+
+	// Tightening of the LP relaxation
+	for (std::size_t i = 0; i < n_customers; ++i) {
+		for (std::size_t j = 0; j < n_facilities; ++j) {
+			auto const vars = std::array{x_var(i, j), y_vars[j].get()};
+			auto const coefs = std::array{1., -1.};
+			scip::add_cons_basic_linear(scip, fmt::format("tightening_{}_{}", i + 1, j + 1), vars, coefs, -inf, 0.);
+		}
+	}
+
+	return model;
+}
+
+CapacitatedFacilityLocationGenerator::CapacitatedFacilityLocationGenerator(
+	Parameters parameters_,
+	RandomEngine random_engine_) :
+	random_engine(random_engine_), parameters(parameters_) {}
+
+scip::Model CapacitatedFacilityLocationGenerator::next() {
+	return generate_instance(parameters, random_engine);
+}
+
+void CapacitatedFacilityLocationGenerator::seed(Seed seed) {
+	random_engine.seed(seed);
+}
+
+}  // namespace ecole::instance
@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <scip/scip.h>
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/combinatorial-auction.hpp"
+#include "ecole/scip/cons.hpp"
+#include "ecole/scip/var.hpp"
+
+namespace ecole::instance {
+
+namespace {
+
+/** Sorted indices of the items in a bundle. */
+using Bundle = std::vector<std::size_t>;
+
+struct Bid {
+	Bundle items;
+	double price;
+};
+
+/** Symmetric item compatibilities, normalized per item. */
+class Compatibilities {
+public:
+	Compatibilities(std::size_t n_items_, RandomEngine& random_engine) : n_items(n_items_), values(n_items * n_items, 0.) {
+		auto distrib = std::uniform_real_distribution<double>{0., 1.};
+		for (std::size_t i = 0; i < n_items; ++i) {
+			for (std::size_t j = i + 1; j < n_items; ++j) {
+				values[i * n_items + j] = values[j * n_items + i] = distrib(random_engine);
+			}
+		}
+		for (std::size_t j = 0; j < n_items; ++j) {
+			auto total = 0.;
+			for (std::size_t i = 0; i < n_items; ++i) {
+				total += values[i * n_items + j];
+			}
+			if (total > 0.) {
+				for (std::size_t i = 0; i < n_items; ++i) {
+					values[i * n_items + j] /= total;
+				}
+			}
+		}
+	}
+
+	[[nodiscard]] double operator()(std::size_t i, std::size_t j) const { return values[i * n_items + j]; }
+
+private:
+	std::size_t n_items;
+	std::vector<double> values;
+};
+
+/**
+ * Choose an item to add to the bundle, according to bidder interests and compatibility with the bundle.
+ */
+std::size_t choose_next_item(
+	Bundle const& bundle,
+	std::vector<bool> const& in_bundle,
+	std::vector<double> const& interests,
+	Compatibilities const& compats,
+	RandomEngine& random_engine) {
+	auto const n_items = interests.size();
+	auto weights = std::vector<double>(n_items, 0.);
+	for (std::size_t j = 0; j < n_items; ++j) {
+		if (!in_bundle[j]) {
+			auto compat = 0.;
+			for (auto const i : bundle) {
+				compat += compats(i, j);
+			}
+			weights[j] = interests[j] * compat / static_cast<double>(bundle.size());
+		}
+	}
+	return std::discrete_distribution<std::size_t>{weights.begin(), weights.end()}(random_engine);
+}
+
+/**
+ * Grow a bundle from an initial item until the stopping predicate is met or all items are in the bundle.
+ */
+template <typename Predicate>
+Bundle grow_bundle(
+	std::size_t first_item,
+	Predicate&& keep_growing,
+	std::vector<double> const& interests,
+	Compatibilities const& compats,
+	RandomEngine& random_engine) {
+	auto const n_items = interests.size();
+	auto bundle = Bundle{first_item};
+	auto in_bundle = std::vector<bool>(n_items, false);
+	in_bundle[first_item] = true;
+	while ((bundle.size() < n_items) && keep_growing(bundle)) {
+		auto const item = choose_next_item(bundle, in_bundle, interests, compats, random_engine);
+		in_bundle[item] = true;
+		bundle.push_back(item);
+	}
+	std::sort(bundle.begin(), bundle.end());
+	return bundle;
+}
+
+double sum_over(Bundle const& bundle, std::vector<double> const& item_values) {
+	return std::accumulate(
+		bundle.begin(), bundle.end(), 0., [&item_values](auto total, auto item) { return total + item_values[item]; });
+}
+
+/**
+ * Generate the bids of all bidders.
+ *
+ * @return The bids, where dummy items (indices after the real items) encode the XOR constraint of bidders.
+ * @return The total number of items, including dummy items.
+ */
+std::tuple<std::vector<Bid>, std::size_t>
+generate_bids(CombinatorialAuctionGenerator::Parameters const& params, RandomEngine& random_engine) {
+	auto const n_items = params.n_items;
+	auto unif = std::uniform_real_distribution<double>{0., 1.};
+
+	// Common item values (resale price)
+	auto values = std::vector<double>(n_items);
+	for (auto& value : values) {
+		value = params.min_value + (params.max_value - params.min_value) * unif(random_engine);
+	}
+
+	auto const compats = Compatibilities{n_items, random_engine};
+
+	auto const bundle_price = [&params](Bundle const& bundle, std::vector<double> const& item_values) {
+		auto const price = sum_over(bundle, item_values) + std::pow(bundle.size(), 1. + params.additivity);
+		return params.integers ? std::trunc(price) : price;
+	};
+
+	auto bids = std::vector<Bid>{};
+	auto n_dummy_items = std::size_t{0};
+
+	// Create bids, one bidder at a time
+	while (bids.size() < params.n_bids) {
+		// Bidder item values (buy price) and interests
+		auto interests = std::vector<double>(n_items);
+		auto private_values = std::vector<double>(n_items);
+		for (std::size_t i = 0; i < n_items; ++i) {
+			interests[i] = unif(random_engine);
+			private_values[i] = values[i] + params.max_value * params.value_deviation * (2. * interests[i] - 1.);
+		}
+
+		// Generate initial bundle, choose first item according to bidder interests
+		auto const first_item = std::discrete_distribution<std::size_t>{interests.begin(), interests.end()}(random_engine);
+		auto const add_item = [&](Bundle const& /*bundle*/) { return unif(random_engine) < params.add_item_prob; };
+		auto const bundle = grow_bundle(first_item, add_item, interests, compats, random_engine);
+		auto const price = bundle_price(bundle, private_values);
+
+		// Drop negatively priced bundles
+		if (price < 0) {
+			continue;
+		}
+
+		// Substitutable bids of this bidder, starting with the initial bundle
+		auto bidder_bids = std::vector<Bid>{{bundle, price}};
+		auto bidder_bundles = std::set<Bundle>{bundle};
+
+		// Generate candidates substitutable bundles, sharing at least one item with the initial bundle
+		auto sub_candidates = std::vector<Bid>{};
+		sub_candidates.reserve(bundle.size());
+		for (auto const item : bundle) {
+			auto const same_size = [n = bundle.size()](Bundle const& sub_bundle) { return sub_bundle.size() < n; };
+			auto sub_bundle = grow_bundle(item, same_size, interests, compats, random_engine);
+			auto const sub_price = bundle_price(sub_bundle, private_values);
+			sub_candidates.push_back({std::move(sub_bundle), sub_price});
+		}
+
+		// Filter valid candidates, higher priced candidates first
+		std::stable_sort(sub_candidates.begin(), sub_candidates.end(), [](auto const& bid1, auto const& bid2) {
+			return bid1.price > bid2.price;
+		});
+		auto const budget = params.budget_factor * price;
+		auto const min_resale_value = params.resale_factor * sum_over(bundle, values);
+		for (auto& candidate : sub_candidates) {
+			if ((bidder_bids.size() >= params.max_n_sub_bids + 1) || (bids.size() + bidder_bids.size() >= params.n_bids)) {
+				break;
+			}
+			auto const is_valid = (candidate.price >= 0) && (candidate.price <= budget) &&
+														(sum_over(candidate.items, values) >= min_resale_value) &&
+														(bidder_bundles.count(candidate.items) == 0);
+			if (is_valid) {
+				bidder_bundles.insert(candidate.items);
+				bidder_bids.push_back(std::move(candidate));
+			}
+		}
+
+		// Add XOR constraint if needed (dummy item)
+		auto const needs_dummy = bidder_bids.size() > 2;
+		auto const dummy_item = n_items + n_dummy_items;
+		if (needs_dummy) {
+			++n_dummy_items;
+		}
+
+		// Place bids
+		for (auto& bid : bidder_bids) {
+			if (needs_dummy) {
+				bid.items.push_back(dummy_item);
+			}
+			bids.push_back(std::move(bid));
+		}
+	}
+
+	return {std::move(bids), n_items + n_dummy_items};
+}
+
+}  // namespace
+
+scip::Model CombinatorialAuctionGenerator::generate_instance(Parameters parameters, RandomEngine& random_engine) {
+	if ((parameters.min_value < 0) || (parameters.max_value < parameters.min_value)) {
+		throw Exception(fmt::format(
+			"Item values must satisfy 0 <= min_value <= max_value, got {} and {}",
+			parameters.min_value,
+			parameters.max_value));
+	}
+	if ((parameters.add_item_prob < 0) || (parameters.add_item_prob > 1)) {
+		throw Exception(fmt::format("Add item probability must be in [0, 1], got {}", parameters.add_item_prob));
+	}
+
+	auto const [bids, n_all_items] = generate_bids(parameters, random_engine);
+
+	auto model = scip::Model::prob_basic();
+	auto* const scip = model.get_scip_ptr();
+	SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE);
+
+	auto bids_per_item = std::vector<std::vector<scip::Var*>>(n_all_items);
+	auto vars = std::vector<scip::unique_var>{};
+	vars.reserve(bids.size());
+	for (std::size_t i = 0; i < bids.size(); ++i) {
+		vars.push_back(
+			scip::add_var_basic(scip, fmt::format("x{}", i + 1), 0., 1., bids[i].price, SCIP_VARTYPE_BINARY));
+		for (auto const item : bids[i].items) {
+			bids_per_item[item].push_back(vars.back().get());
+		}
+	}
+
+	// Every item is sold at most once
+	auto const inf = SCIPinfinity(scip);
+	for (std::size_t item = 0; item < n_all_items; ++item) {
+		auto const& item_vars = bids_per_item[item];
+		if (!item_vars.empty()) {
+			auto const coefs = std::vector<scip::real>(item_vars.size(), 1.);
+			scip::add_cons_basic_linear(scip, fmt::format("c{}", item + 1), item_vars, coefs, -inf, 1.);
+		}
+	}
+
+	return model;
+}
+
+CombinatorialAuctionGenerator::CombinatorialAuctionGenerator(Parameters parameters_, RandomEngine random_engine_) :
+	random_engine(random_engine_), parameters(parameters_) {}
+
+scip::Model CombinatorialAuctionGenerator::next() {
+	return generate_instance(parameters, random_engine);
+}
+
+void CombinatorialAuctionGenerator::seed(Seed seed) {
+	random_engine.seed(seed);
+}
+
+}  // namespace ecole::instance
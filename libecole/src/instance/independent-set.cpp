@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <scip/scip.h>
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/independent-set.hpp"
+#include "ecole/scip/cons.hpp"
+#include "ecole/scip/var.hpp"
+
+#include "utility/random.hpp"
+
+namespace ecole::instance {
+
+namespace {
+
+/**
+ * An undirected graph stored as sorted adjacency lists.
+ */
+class Graph {
+public:
+	Graph(std::size_t n_nodes) : neighbors(n_nodes) {}
+
+	[[nodiscard]] std::size_t n_nodes() const noexcept { return neighbors.size(); }
+	[[nodiscard]] std::size_t n_edges() const noexcept { return the_n_edges; }
+	[[nodiscard]] std::size_t degree(std::size_t node) const noexcept { return neighbors[node].size(); }
+
+	[[nodiscard]] bool are_connected(std::size_t node1, std::size_t node2) const {
+		auto const& node1_neighbors = neighbors[node1];
+		return std::binary_search(node1_neighbors.begin(), node1_neighbors.end(), node2);
+	}
+
+	[[nodiscard]] std::vector<std::size_t> const& neighbors_of(std::size_t node) const { return neighbors[node]; }
+
+	void add_edge(std::size_t node1, std::size_t node2) {
+		insert_sorted(neighbors[node1], node2);
+		insert_sorted(neighbors[node2], node1);
+		++the_n_edges;
+	}
+
+	/**
+	 * Partition the nodes of the graph into cliques using a greedy algorithm.
+	 */
+	[[nodiscard]] std::vector<std::vector<std::size_t>> greedy_clique_partition() const;
+
+	static Graph erdos_renyi(std::size_t n_nodes, double edge_probability, RandomEngine& random_engine);
+	static Graph barabasi_albert(std::size_t n_nodes, std::size_t affinity, RandomEngine& random_engine);
+
+private:
+	std::vector<std::vector<std::size_t>> neighbors;
+	std::size_t the_n_edges = 0;
+
+	static void insert_sorted(std::vector<std::size_t>& nodes, std::size_t node) {
+		nodes.insert(std::upper_bound(nodes.begin(), nodes.end(), node), node);
+	}
+};
+
+std::vector<std::vector<std::size_t>> Graph::greedy_clique_partition() const {
+	// Nodes by decreasing degree
+	auto leftover_nodes = std::vector<std::size_t>(n_nodes());
+	std::iota(leftover_nodes.begin(), leftover_nodes.end(), std::size_t{0});
+	auto const by_decreasing_degree = [this](auto node1, auto node2) { return degree(node1) > degree(node2); };
+	std::stable_sort(leftover_nodes.begin(), leftover_nodes.end(), by_decreasing_degree);
+
+	auto is_leftover = std::vector<bool>(n_nodes(), true);
+	auto cliques = std::vector<std::vector<std::size_t>>{};
+	for (auto const center : leftover_nodes) {
+		if (!is_leftover[center]) {
+			continue;
+		}
+		auto clique = std::vector<std::size_t>{center};
+		is_leftover[center] = false;
+
+		auto candidates = std::vector<std::size_t>{};
+		for (auto const neighbor : neighbors_of(center)) {
+			if (is_leftover[neighbor]) {
+				candidates.push_back(neighbor);
+			}
+		}
+		std::stable_sort(candidates.begin(), candidates.end(), by_decreasing_degree);
+		for (auto const candidate : candidates) {
+			// Can the candidate be added to the clique and maintain cliqueness
+			auto const connected = [&](auto node) { return are_connected(candidate, node); };
+			if (std::all_of(clique.begin(), clique.end(), connected)) {
+				clique.push_back(candidate);
+				is_leftover[candidate] = false;
+			}
+		}
+		std::sort(clique.begin(), clique.end());
+		cliques.push_back(std::move(clique));
+	}
+	return cliques;
+}
+
+Graph Graph::erdos_renyi(std::size_t n_nodes, double edge_probability, RandomEngine& random_engine) {
+	if ((edge_probability < 0.) || (edge_probability > 1.)) {
+		throw Exception(fmt::format("Edge probability must be in [0, 1], got {}", edge_probability));
+	}
+	auto graph = Graph{n_nodes};
+	auto distrib = std::bernoulli_distribution{edge_probability};
+	for (std::size_t node1 = 0; node1 < n_nodes; ++node1) {
+		for (std::size_t node2 = node1 + 1; node2 < n_nodes; ++node2) {
+			if (distrib(random_engine)) {
+				graph.add_edge(node1, node2);
+			}
+		}
+	}
+	return graph;
+}
+
+Graph Graph::barabasi_albert(std::size_t n_nodes, std::size_t affinity, RandomEngine& random_engine) {
+	if ((affinity < 1) || (affinity >= n_nodes)) {
+		throw Exception(fmt::format("Affinity must be in [1, {}), got {}", n_nodes, affinity));
+	}
+	auto graph = Graph{n_nodes};
+	// First node is connected to all previous ones (star-shape)
+	for (std::size_t node = 0; node < affinity; ++node) {
+		graph.add_edge(node, affinity);
+	}
+	// Remaining nodes are picked stochastically, proportionally to their degree
+	auto degrees = std::vector<double>{};
+	for (auto new_node = affinity + 1; new_node < n_nodes; ++new_node) {
+		degrees.resize(new_node);
+		for (std::size_t node = 0; node < new_node; ++node) {
+			degrees[node] = static_cast<double>(graph.degree(node));
+		}
+		for (auto const node : utility::arg_choice(affinity, degrees, random_engine)) {
+			graph.add_edge(node, new_node);
+		}
+	}
+	return graph;
+}
+
+/**
+ * Compute the groups of nodes that cannot be selected together.
+ *
+ * Cliques of the greedy partition are used as groups, and remaining edges are added as groups of two nodes.
+ */
+std::vector<std::vector<std::size_t>> inequality_groups(Graph const& graph) {
+	auto const cliques = graph.greedy_clique_partition();
+	auto clique_of = std::vector<std::size_t>(graph.n_nodes());
+	for (std::size_t c = 0; c < cliques.size(); ++c) {
+		for (auto const node : cliques[c]) {
+			clique_of[node] = c;
+		}
+	}
+
+	auto groups = std::vector<std::vector<std::size_t>>{};
+	auto is_used = std::vector<bool>(graph.n_nodes(), false);
+	for (auto const& clique : cliques) {
+		if (clique.size() > 1) {
+			groups.push_back(clique);
+			for (auto const node : clique) {
+				is_used[node] = true;
+			}
+		}
+	}
+	for (std::size_t node1 = 0; node1 < graph.n_nodes(); ++node1) {
+		for (auto const node2 : graph.neighbors_of(node1)) {
+			if ((node1 < node2) && (clique_of[node1] != clique_of[node2])) {
+				groups.push_back({node1, node2});
+				is_used[node1] = true;
+				is_used[node2] = true;
+			}
+		}
+	}
+	// Put trivial inequalities for nodes that do not appear in the constraints, otherwise SCIP complains
+	for (std::size_t node = 0; node < graph.n_nodes(); ++node) {
+		if (!is_used[node]) {
+			groups.push_back({node});
+		}
+	}
+	return groups;
+}
+
+}  // namespace
+
+scip::Model IndependentSetGenerator::generate_instance(Parameters parameters, RandomEngine& random_engine) {
+	auto const graph = [&] {
+		switch (parameters.graph_type) {
+		case GraphType::erdos_renyi:
+			return Graph::erdos_renyi(parameters.n_nodes, parameters.edge_probability, random_engine);
+		case GraphType::barabasi_albert:
+			return Graph::barabasi_albert(parameters.n_nodes, parameters.affinity, random_engine);
+		default:
+			throw Exception("Unknown graph type");
+		}
+	}();
+
+	auto model = scip::Model::prob_basic();
+	auto* const scip = model.get_scip_ptr();
+	SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE);
+
+	auto vars = std::vector<scip::unique_var>{};
+	vars.reserve(graph.n_nodes());
+	for (std::size_t node = 0; node < graph.n_nodes(); ++node) {
+		vars.push_back(scip::add_var_basic(scip, fmt::format("x_{}", node + 1), 0., 1., 1., SCIP_VARTYPE_BINARY));
+	}
+
+	// No two connected nodes are both selected
+	auto const inf = SCIPinfinity(scip);
+	auto const groups = inequality_groups(graph);
+	for (std::size_t g = 0; g < groups.size(); ++g) {
+		auto group_vars = std::vector<scip::Var*>{};
+		group_vars.reserve(groups[g].size());
+		for (auto const node : groups[g]) {
+			group_vars.push_back(vars[node].get());
+		}
+		auto const coefs = std::vector<scip::real>(group_vars.size(), 1.);
+		scip::add_cons_basic_linear(scip, fmt::format("c{}", g + 1), group_vars, coefs, -inf, 1.);
+	}
+
+	return model;
+}
+
+IndependentSetGenerator::IndependentSetGenerator(Parameters parameters_, RandomEngine random_engine_) :
+	random_engine(random_engine_), parameters(parameters_) {}
+
+scip::Model IndependentSetGenerator::next() {
+	return generate_instance(parameters, random_engine);
+}
+
+void IndependentSetGenerator::seed(Seed seed) {
+	random_engine.seed(seed);
+}
+
+}  // namespace ecole::instance
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <utility>
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/pipeline.hpp"
+
+namespace ecole::instance {
+
+InstancePipeline::InstancePipeline(Generate generate_, Options options_, Seed seed_) :
+	generate{std::move(generate_)}, options{options_}, the_seed{seed_} {
+	if (options.buffer_size == 0) {
+		throw Exception("The buffer size of the pipeline must be at least one");
+	}
+	if (options.n_threads == 0) {
+		options.n_threads = std::max(std::thread::hardware_concurrency(), 1U);
+	}
+	start();
+}
+
+InstancePipeline::~InstancePipeline() {
+	stop();
+}
+
+scip::Model InstancePipeline::next() {
+	auto slot = Slot{};
+	{
+		auto lk = std::unique_lock{mutex};
+		produced_cv.wait(lk, [this] { return buffer.count(next_to_consume) > 0; });
+		auto node = buffer.extract(next_to_consume);
+		slot = std::move(node.mapped());
+		++next_to_consume;
+	}
+	// Make room for one more instance
+	consumed_cv.notify_all();
+	if (slot.error) {
+		std::rethrow_exception(slot.error);
+	}
+	return std::move(slot.model).value();
+}
+
+void InstancePipeline::seed(Seed seed_) {
+	stop();
+	buffer.clear();
+	next_to_produce = 0;
+	next_to_consume = 0;
+	the_seed = seed_;
+	start();
+}
+
+void InstancePipeline::start() {
+	stopping = false;
+	workers.reserve(options.n_threads);
+	for (std::size_t i = 0; i < options.n_threads; ++i) {
+		workers.emplace_back([this] { run_worker(); });
+	}
+}
+
+void InstancePipeline::stop() {
+	{
+		auto const lk = std::lock_guard{mutex};
+		stopping = true;
+	}
+	consumed_cv.notify_all();
+	for (auto& worker : workers) {
+		worker.join();
+	}
+	workers.clear();
+}
+
+void InstancePipeline::run_worker() {
+	while (true) {
+		auto index = std::size_t{0};
+		{
+			auto lk = std::unique_lock{mutex};
+			consumed_cv.wait(
+				lk, [this] { return stopping || (next_to_produce < next_to_consume + options.buffer_size); });
+			if (stopping) {
+				return;
+			}
+			index = next_to_produce++;
+		}
+
+		auto slot = Slot{};
+		try {
+			slot.model = make_instance(index);
+		} catch (...) {
+			slot.error = std::current_exception();
+		}
+
+		{
+			auto const lk = std::lock_guard{mutex};
+			buffer.emplace(index, std::move(slot));
+		}
+		produced_cv.notify_all();
+	}
+}
+
+scip::Model InstancePipeline::make_instance(std::size_t index) const {
+	// The random engine only depends on the seed and the instance index to be independent of the scheduling
+	auto random_engine = RandomEngine{the_seed}.split(index);
+
+	auto model = generate(random_engine);
+	if (options.copy_orig) {
+		model = model.copy_orig();
+	}
+	if (options.presolve) {
+		model.presolve();
+	}
+	return model;
+}
+
+}  // namespace ecole::instance
@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <scip/scip.h>
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/set-cover.hpp"
+#include "ecole/scip/cons.hpp"
+#include "ecole/scip/var.hpp"
+
+#include "utility/random.hpp"
+
+namespace ecole::instance {
+
+namespace {
+
+/**
+ * Sample the rows of every column, returned as the row indices of every column (CSC format without data).
+ */
+std::vector<std::vector<std::size_t>>
+sample_columns_rows(SetCoverGenerator::Parameters const& parameters, RandomEngine& random_engine) {
+	auto const n_rows = parameters.n_rows;
+	auto const n_cols = parameters.n_cols;
+	auto const density = parameters.density;
+	if ((density <= 0.) || (density > 1.)) {
+		throw Exception(fmt::format("Density must be in (0, 1], got {}", density));
+	}
+	auto const nnzrs = static_cast<std::size_t>(static_cast<double>(n_rows * n_cols) * density);
+	if ((nnzrs < n_rows) || (nnzrs < 2 * n_cols)) {
+		throw Exception(fmt::format(
+			"Density {} is too low to have one column per row and two rows per column, with {} rows and {} columns",
+			density,
+			n_rows,
+			n_cols));
+	}
+
+	// Count the number of rows in every column, at least two per column and the rest at random
+	auto col_n_rows = std::vector<std::size_t>(n_cols, 2);
+	for (auto const idx : utility::arg_choice(nnzrs - 2 * n_cols, n_cols * (n_rows - 2), random_engine)) {
+		++col_n_rows[idx % n_cols];
+	}
+
+	// Pre-fill rows to force at least one column per row
+	auto indices = std::vector<std::size_t>(nnzrs);
+	std::iota(indices.begin(), indices.begin() + static_cast<std::ptrdiff_t>(n_rows), std::size_t{0});
+	std::shuffle(indices.begin(), indices.begin() + static_cast<std::ptrdiff_t>(n_rows), random_engine);
+
+	auto cols_rows = std::vector<std::vector<std::size_t>>(n_cols);
+	auto i = std::size_t{0};
+	for (std::size_t col = 0; col < n_cols; ++col) {
+		auto const n = col_n_rows[col];
+		if (i >= n_rows) {
+			// Column is empty, fill with random rows
+			auto const rows = utility::arg_choice(n, n_rows, random_engine);
+			std::copy(rows.begin(), rows.end(), indices.begin() + static_cast<std::ptrdiff_t>(i));
+		} else if (i + n > n_rows) {
+			// Column is partially filled, complete with random rows among remaining ones
+			auto is_in_col = std::vector<bool>(n_rows, false);
+			for (auto k = i; k < n_rows; ++k) {
+				is_in_col[indices[k]] = true;
+			}
+			auto remaining_rows = std::vector<std::size_t>{};
+			for (std::size_t row = 0; row < n_rows; ++row) {
+				if (!is_in_col[row]) {
+					remaining_rows.push_back(row);
+				}
+			}
+			auto pos = n_rows;
+			for (auto const k : utility::arg_choice(i + n - n_rows, remaining_rows.size(), random_engine)) {
+				indices[pos++] = remaining_rows[k];
+			}
+		}
+		// Otherwise the column is already filled
+		cols_rows[col].assign(
+			indices.begin() + static_cast<std::ptrdiff_t>(i), indices.begin() + static_cast<std::ptrdiff_t>(i + n));
+		i += n;
+	}
+	return cols_rows;
+}
+
+}  // namespace
+
+scip::Model SetCoverGenerator::generate_instance(Parameters parameters, RandomEngine& random_engine) {
+	auto const cols_rows = sample_columns_rows(parameters, random_engine);
+
+	// Transpose to get the columns of every row
+	auto rows_cols = std::vector<std::vector<scip::Var*>>(parameters.n_rows);
+
+	auto model = scip::Model::prob_basic();
+	auto* const scip = model.get_scip_ptr();
+	SCIPsetObjsense(scip, SCIP_OBJSENSE_MINIMIZE);
+
+	auto obj_distrib = std::uniform_int_distribution<std::size_t>{1, parameters.max_coef};
+	auto vars = std::vector<scip::unique_var>{};
+	vars.reserve(parameters.n_cols);
+	for (std::size_t col = 0; col < parameters.n_cols; ++col) {
+		auto const obj = static_cast<scip::real>(obj_distrib(random_engine));
+		vars.push_back(scip::add_var_basic(scip, fmt::format("x{}", col + 1), 0., 1., obj, SCIP_VARTYPE_BINARY));
+		for (auto const row : cols_rows[col]) {
+			rows_cols[row].push_back(vars.back().get());
+		}
+	}
+
+	auto const inf = SCIPinfinity(scip);
+	for (std::size_t row = 0; row < parameters.n_rows; ++row) {
+		auto const& row_vars = rows_cols[row];
+		auto const coefs = std::vector<scip::real>(row_vars.size(), 1.);
+		scip::add_cons_basic_linear(scip, fmt::format("c{}", row + 1), row_vars, coefs, 1., inf);
+	}
+
+	return model;
+}
+
+SetCoverGenerator::SetCoverGenerator(Parameters parameters_, RandomEngine random_engine_) :
+	random_engine(random_engine_), parameters(parameters_) {}
+
+scip::Model SetCoverGenerator::next() {
+	return generate_instance(parameters, random_engine);
+}
+
+void SetCoverGenerator::seed(Seed seed) {
+	random_engine.seed(seed);
+}
+
+}  // namespace ecole::instance
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "ecole/exception.hpp"
+#include "ecole/instrumentation.hpp"
+
+namespace ecole::instrumentation {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<bool> detail::tracing_active{false};
+
+namespace {
+
+thread_local EpisodeStats* current_stats = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * Ring buffer of the events of one thread.
+ *
+ * Only the owning thread writes events, the number of events written is published for readers.
+ */
+struct TraceBuffer {
+	std::vector<TraceEvent> events;
+	std::atomic<std::size_t> n_written{0};
+	std::size_t thread_id = 0;
+};
+
+/**
+ * The buffers of all the threads for the current tracing session.
+ *
+ * Buffers are shared with their thread so that events remain after the thread exits.
+ */
+struct TraceRegistry {
+	std::mutex mutex;
+	std::vector<std::shared_ptr<TraceBuffer>> buffers;
+	std::size_t capacity = default_trace_capacity;
+	std::size_t session = 0;
+	Clock::time_point start;
+};
+
+TraceRegistry& registry() {
+	static auto the_registry = TraceRegistry{};
+	return the_registry;
+}
+
+/** Current tracing session, read without lock when recording events. */
+std::atomic<std::size_t> current_session{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct LocalBuffer {
+	std::shared_ptr<TraceBuffer> buffer;
+	std::size_t session = 0;
+};
+
+thread_local LocalBuffer local_buffer;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/** Return the buffer of the current thread for the current session, creating it on first use. */
+TraceBuffer& get_local_buffer() {
+	auto& reg = registry();
+	auto const lk = std::lock_guard{reg.mutex};
+	if ((local_buffer.buffer == nullptr) || (local_buffer.session != reg.session)) {
+		auto buffer = std::make_shared<TraceBuffer>();
+		buffer->events.resize(reg.capacity);
+		buffer->thread_id = reg.buffers.size();
+		reg.buffers.push_back(buffer);
+		local_buffer = {std::move(buffer), reg.session};
+	}
+	return *local_buffer.buffer;
+}
+
+}  // namespace
+
+std::string_view stage_name(Stage stage) noexcept {
+	switch (stage) {
+	case Stage::reset:
+		return "reset";
+	case Stage::step:
+		return "step";
+	case Stage::solve:
+		return "solve";
+	case Stage::handoff:
+		return "handoff";
+	case Stage::observation:
+		return "observation";
+	case Stage::reward:
+		return "reward";
+	case Stage::information:
+		return "information";
+	case Stage::python_conversion:
+		return "python_conversion";
+	}
+	return "";
+}
+
+EpisodeStats* current() noexcept {
+	return current_stats;
+}
+
+void record(Stage stage, Clock::duration duration) noexcept {
+	if (current_stats != nullptr) {
+		current_stats->add(stage, duration);
+	}
+}
+
+ScopedRecording::ScopedRecording(EpisodeStats& stats) noexcept : previous{current_stats} {
+	current_stats = &stats;
+}
+
+ScopedRecording::~ScopedRecording() {
+	current_stats = previous;
+}
+
+/*******************************
+ *  Implementation of tracing  *
+ ******************************/
+
+void start_tracing(std::size_t capacity) {
+	if (capacity == 0) {
+		throw Exception("The capacity of the trace buffers must be at least one");
+	}
+	auto& reg = registry();
+	auto const lk = std::lock_guard{reg.mutex};
+	reg.buffers.clear();
+	reg.capacity = capacity;
+	reg.session = current_session.fetch_add(1) + 1;
+	reg.start = Clock::now();
+	detail::tracing_active.store(true);
+}
+
+void stop_tracing() noexcept {
+	detail::tracing_active.store(false);
+}
+
+void trace(char const* name, bool begin) noexcept {
+	if (!tracing()) {
+		return;
+	}
+	auto* buffer = local_buffer.buffer.get();
+	if ((buffer == nullptr) || (local_buffer.session != current_session.load(std::memory_order_relaxed))) {
+		try {
+			buffer = &get_local_buffer();
+		} catch (...) {
+			return;
+		}
+	}
+	auto const n_written = buffer->n_written.load(std::memory_order_relaxed);
+	buffer->events[n_written % buffer->events.size()] = {name, Clock::now(), begin};
+	buffer->n_written.store(n_written + 1, std::memory_order_release);
+}
+
+void write_trace(std::ostream& out) {
+	auto& reg = registry();
+	auto const lk = std::lock_guard{reg.mutex};
+	out << R"({"displayTimeUnit": "ms", "traceEvents": [)";
+	auto first = true;
+	for (auto const& buffer : reg.buffers) {
+		auto const n_written = buffer->n_written.load(std::memory_order_acquire);
+		auto const capacity = buffer->events.size();
+		for (auto i = n_written - std::min(n_written, capacity); i < n_written; ++i) {
+			auto const& event = buffer->events[i % capacity];
+			auto const timestamp = std::chrono::duration<double, std::micro>{event.time - reg.start}.count();
+			out << fmt::format(
+				R"({}{{"name": "{}", "ph": "{}", "ts": {:.3f}, "pid": 0, "tid": {}}})",
+				first ? "\n" : ",\n",
+				event.name,
+				event.begin ? 'B' : 'E',
+				timestamp,
+				buffer->thread_id);
+			first = false;
+		}
+	}
+	out << "\n]}\n";
+}
+
+void write_trace(std::string const& filename) {
+	auto file = std::ofstream{filename};
+	if (!file) {
+		throw Exception(fmt::format("Could not open file {}", filename));
+	}
+	write_trace(file);
+}
+
+}  // namespace ecole::instrumentation
@@ -0,0 +1,85 @@
+#include <cstddef>
+#include <optional>
+
+#include <nonstd/span.hpp>
+#include <scip/scip.h>
+#include <xtensor/xview.hpp>
+
+#include "ecole/observation/cutpool.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/type.hpp"
+
+namespace ecole::observation {
+
+namespace {
+
+using tensor = decltype(CutPoolObs::cut_features);
+using value_type = tensor::value_type;
+using CutFeatures = CutPoolObs::CutFeatures;
+
+/** Columns of the cut that are in the LP, with their coefficients. */
+template <typename Func> void for_each_lp_coef(scip::Row* const cut, Func&& func) {
+	auto* const cols = SCIProwGetCols(cut);
+	auto const* const vals = SCIProwGetVals(cut);
+	auto const n_nonz = SCIProwGetNNonz(cut);
+	for (int k = 0; k < n_nonz; ++k) {
+		auto const lp_pos = SCIPcolGetLPPos(cols[k]);
+		if (lp_pos >= 0) {
+			func(static_cast<std::size_t>(lp_pos), vals[k]);
+		}
+	}
+}
+
+tensor extract_cut_feat(Scip* const scip, nonstd::span<scip::Row*> const cuts) {
+	auto feat = tensor::from_shape({cuts.size(), CutPoolObs::n_cut_features});
+	auto const n_cols = static_cast<value_type>(SCIPgetNLPCols(scip));
+	for (std::size_t i = 0; i < cuts.size(); ++i) {
+		auto* const cut = cuts[i];
+		auto const nnz = static_cast<value_type>(SCIProwGetNNonz(cut));
+		auto const n_int_cols = static_cast<value_type>(SCIPgetRowNumIntCols(scip, cut));
+		auto row = xt::row(feat, static_cast<std::ptrdiff_t>(i));
+		row[static_cast<std::size_t>(CutFeatures::efficacy)] = SCIPgetCutEfficacy(scip, nullptr, cut);
+		row[static_cast<std::size_t>(CutFeatures::objective_parallelism)] = SCIPgetRowObjParallelism(scip, cut);
+		row[static_cast<std::size_t>(CutFeatures::density)] = (n_cols > 0) ? nnz / n_cols : 0.;
+		row[static_cast<std::size_t>(CutFeatures::integral_support)] = (nnz > 0) ? n_int_cols / nnz : 0.;
+		row[static_cast<std::size_t>(CutFeatures::is_local)] = static_cast<value_type>(SCIProwIsLocal(cut));
+		row[static_cast<std::size_t>(CutFeatures::rank)] = static_cast<value_type>(SCIProwGetRank(cut));
+	}
+	return feat;
+}
+
+utility::coo_matrix<value_type> extract_coefficients(Scip* const scip, nonstd::span<scip::Row*> const cuts) {
+	using coo_matrix = utility::coo_matrix<value_type>;
+	std::size_t nnz = 0;
+	for (auto* const cut : cuts) {
+		for_each_lp_coef(cut, [&nnz](auto /*col*/, auto /*val*/) { ++nnz; });
+	}
+	auto values = decltype(coo_matrix::values)::from_shape({nnz});
+	auto indices = decltype(coo_matrix::indices)::from_shape({2, nnz});
+
+	std::size_t j = 0;
+	for (std::size_t i = 0; i < cuts.size(); ++i) {
+		for_each_lp_coef(cuts[i], [&](std::size_t col, value_type val) {
+			indices(0, j) = i;
+			indices(1, j) = col;
+			values[j] = val;
+			++j;
+		});
+	}
+
+	auto const n_cols = static_cast<std::size_t>(SCIPgetNLPCols(scip));
+	return {values, indices, {cuts.size(), n_cols}};
+}
+
+}  // namespace
+
+std::optional<CutPoolObs> CutPool::extract(scip::Model& model, bool /* done */) {
+	if (model.get_stage() != SCIP_STAGE_SOLVING) {
+		return {};
+	}
+	auto* const scip = model.get_scip_ptr();
+	auto const cuts = model.cuts();
+	return CutPoolObs{extract_cut_feat(scip, cuts), extract_coefficients(scip, cuts)};
+}
+
+}  // namespace ecole::observation
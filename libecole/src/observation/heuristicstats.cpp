@@ -0,0 +1,42 @@
+#include <cstddef>
+#include <optional>
+
+#include <scip/scip.h>
+#include <xtensor/xtensor.hpp>
+#include <xtensor/xview.hpp>
+
+#include "ecole/observation/heuristicstats.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::observation {
+
+namespace {
+
+using Features = HeuristicStats::Features;
+
+template <typename Tensor> void set_features(Tensor&& out, SCIP_HEUR* heur) {
+	auto const n_calls = static_cast<double>(SCIPheurGetNCalls(heur));
+	auto const n_best_sols = static_cast<double>(SCIPheurGetNBestSolsFound(heur));
+	out[static_cast<std::size_t>(Features::n_calls)] = n_calls;
+	out[static_cast<std::size_t>(Features::n_solutions_found)] = static_cast<double>(SCIPheurGetNSolsFound(heur));
+	out[static_cast<std::size_t>(Features::n_best_solutions_found)] = n_best_sols;
+	out[static_cast<std::size_t>(Features::success_rate)] = (n_calls > 0) ? n_best_sols / n_calls : 0.;
+	out[static_cast<std::size_t>(Features::solving_time)] = SCIPheurGetTime(heur);
+	out[static_cast<std::size_t>(Features::is_scheduled)] = (SCIPheurGetFreq(heur) > 0) ? 1. : 0.;
+}
+
+}  // namespace
+
+std::optional<xt::xtensor<double, 2>> HeuristicStats::extract(scip::Model& model, bool /* done */) {
+	if (model.get_stage() != SCIP_STAGE_SOLVING) {
+		return {};
+	}
+	auto const heurs = model.heuristics();
+	auto stats = xt::xtensor<double, 2>::from_shape({heurs.size(), n_features});
+	for (std::size_t i = 0; i < heurs.size(); ++i) {
+		set_features(xt::row(stats, static_cast<std::ptrdiff_t>(i)), heurs[i]);
+	}
+	return stats;
+}
+
+}  // namespace ecole::observation
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 #include <set>
@@ -15,6 +17,7 @@
 #include <xtensor/xview.hpp>
 
 #include "ecole/observation/khalil-2016.hpp"
+#include "ecole/scip/lp-snapshot.hpp"
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/type.hpp"
 
@@ -27,6 +30,8 @@ namespace views = ranges::views;
 using Feature = Khalil2016::Feature;
 using Static = Khalil2016::Feature::Static;
 using Dynamic = Khalil2016::Feature::Dynamic;
+using Group = Khalil2016::Feature::Group;
+using FeatureGroups = Khalil2016::FeatureGroups;
 using value_type = Khalil2016Obs::value_type;
 
 /*************************
@@ -225,6 +230,70 @@ template <typename... Features, typename Tuple = std::tuple<Features...>> conste
 	return static_cast<std::size_t>(std::tuple_element_t<last_index, Tuple>::name);
 }
 
+/********************
+ *  Feature groups  *
+ ********************/
+
+/** Number of features in every group, in the order of the groups. */
+std::array<std::size_t, Feature::n_groups> constexpr group_sizes = {3, 1, 4, 5, 5, 2, 5, 4, 7, 4, 8, 24};
+
+constexpr auto group_index(Group group) noexcept -> std::size_t {
+	return static_cast<std::size_t>(group);
+}
+
+/** Index of the first feature of a group in the complete observation. */
+constexpr auto group_begin(Group group) noexcept -> std::size_t {
+	auto begin = std::size_t{0};
+	for (std::size_t i = 0; i < group_index(group); ++i) {
+		begin += group_sizes[i];
+	}
+	return begin;
+}
+
+static_assert(group_begin(Group::slack_ceil_dist) == Feature::n_static, "Static groups do not match static features");
+static_assert(
+	group_begin(Group::active_coefs) + group_sizes[group_index(Group::active_coefs)] == Feature::n_features,
+	"Groups do not match features");
+
+using GroupOffsets = std::array<std::size_t, Feature::n_groups>;
+
+/** Index of the first feature of every group in an observation with only the given groups. */
+auto group_offsets(FeatureGroups const& groups) noexcept -> GroupOffsets {
+	auto offsets = GroupOffsets{};
+	auto offset = std::size_t{0};
+	for (std::size_t i = 0; i < Feature::n_groups; ++i) {
+		offsets[i] = offset;
+		if (groups[i]) {
+			offset += group_sizes[i];
+		}
+	}
+	return offsets;
+}
+
+auto n_features_of(FeatureGroups const& groups) noexcept -> std::size_t {
+	auto n_features = std::size_t{0};
+	for (std::size_t i = 0; i < Feature::n_groups; ++i) {
+		if (groups[i]) {
+			n_features += group_sizes[i];
+		}
+	}
+	return n_features;
+}
+
+/**
+ * Write the features of a group at its offset in a row of the observation.
+ *
+ * Features are checked at compile time to be exactly those of the group.
+ */
+template <Group group, typename Tuple>
+void write_group(value_type* const row, GroupOffsets const& offsets, Tuple const& features) {
+	static_assert(is_contiguous(Tuple{}), "Features are permuted");
+	static_assert(first_index(Tuple{}) == group_begin(group), "Features do not start at their group");
+	static_assert(std::tuple_size_v<Tuple> == group_sizes[group_index(group)], "Missing features in group");
+	auto const values = features_tuple_to_tensor(features);
+	std::copy(values.begin(), values.end(), row + offsets[group_index(group)]);
+}
+
 /******************************************
  *  Static features extraction functions  *
  ******************************************/
@@ -338,7 +407,7 @@ auto extract_static_features(scip::Col* const col) {
  * Extract the static features for all LP columns in a Model.
  */
 auto extract_static_features(scip::Model const& model) {
-	auto const columns = model.lp_columns();
+	auto const& columns = model.lp_snapshot().cols;
 	xt::xtensor<value_type, 2> static_features{{columns.size(), Feature::n_static}, 0.};
 
 	// Similar to the following but slice iteration not working on xt::xtensor
@@ -363,20 +432,27 @@ auto extract_static_features(scip::Model const& model) {
  */
 
 /**
- * Slack, ceil distances, and Pseudocosts.
- *
- * This function combines two feature sets from Khalil et al.
+ * Slack and ceil distances.
  *
- * Slack and ceil distance:
  *     min{xij−floor(xij),ceil(xij) −xij} and ceil(xij) −xij
+ */
+auto slack_and_ceil_distances(Scip* const scip, scip::Col* const col) noexcept {
+	auto const floor_distance = SCIPfeasFrac(scip, SCIPcolGetPrimsol(col));
+	auto const ceil_distance = 1. - floor_distance;
+	return std::tuple{
+		FeatureValue<Dynamic::slack>{std::min(floor_distance, ceil_distance)},
+		FeatureValue<Dynamic::ceil_dist>{ceil_distance},
+	};
+}
+
+/**
+ * Pseudocosts.
  *
- * Pseudocosts:
- *     Upwards and downwards values, and their corresponding ratio, sum and product, weighted by the
- *     fractionality of xj.
+ * Upwards and downwards values, and their corresponding ratio, sum and product, weighted by the
+ * fractionality of xj.
  */
-auto slack_ceil_and_pseudocosts(Scip* const scip, scip::Var* const var, scip::Col* const col) noexcept {
-	auto const solval = SCIPcolGetPrimsol(col);
-	auto const floor_distance = SCIPfeasFrac(scip, solval);
+auto pseudocosts(Scip* const scip, scip::Var* const var, scip::Col* const col) noexcept {
+	auto const floor_distance = SCIPfeasFrac(scip, SCIPcolGetPrimsol(col));
 	auto const ceil_distance = 1. - floor_distance;
 	auto const weighted_pseudocost_up = ceil_distance * SCIPgetVarPseudocost(scip, var, SCIP_BRANCHDIR_UPWARDS);
 	auto const weighted_pseudocost_down = floor_distance * SCIPgetVarPseudocost(scip, var, SCIP_BRANCHDIR_DOWNWARDS);
@@ -385,8 +461,6 @@ auto slack_ceil_and_pseudocosts(Scip* const scip, scip::Var* const var, scip::Co
 	auto const wpd_approx = std::max(weighted_pseudocost_down, epsilon);
 	auto const weighted_pseudocost_ratio = safe_div(std::min(wpu_approx, wpd_approx), std::max(wpu_approx, wpd_approx));
 	return std::tuple{
-		FeatureValue<Dynamic::slack>{std::min(floor_distance, ceil_distance)},
-		FeatureValue<Dynamic::ceil_dist>{ceil_distance},
 		FeatureValue<Dynamic::pseudocost_up>{weighted_pseudocost_up},
 		FeatureValue<Dynamic::pseudocost_down>{weighted_pseudocost_down},
 		FeatureValue<Dynamic::pseudocost_ratio>{weighted_pseudocost_ratio},
@@ -545,12 +619,22 @@ auto min_max_for_one_to_all_coefficient_ratios(
 
 /**
  * Return if a row in the constraints is active in the LP.
+ *
+ * As with SCIPgetRowActivity, the activity is the LP activity when the current node has an LP, read from the
+ * snapshot, and the pseudo activity otherwise.
+ * Rows that are not in the LP are not active, as they have no weights.
  */
-auto row_is_active(Scip* const scip, scip::Row* const row) noexcept -> bool {
-	auto const activity = SCIPgetRowActivity(scip, row);
-	auto const lhs = SCIProwGetLhs(row);
-	auto const rhs = SCIProwGetRhs(row);
-	return SCIPisEQ(scip, activity, rhs) || SCIPisEQ(scip, activity, lhs);
+auto row_is_active(SCIP* const scip, scip::LpSnapshot const& lp, scip::Row* const row) noexcept -> bool {
+	auto const lp_pos = SCIProwGetLPPos(row);
+	if (lp_pos < 0) {
+		return false;
+	}
+	if (SCIPhasCurrentNodeLP(scip)) {
+		auto const row_idx = static_cast<std::size_t>(lp_pos);
+		return lp.row_at_rhs[row_idx] || lp.row_at_lhs[row_idx];
+	}
+	auto const activity = SCIPgetRowPseudoActivity(scip, row);
+	return SCIPisEQ(scip, activity, SCIProwGetRhs(row)) || SCIPisEQ(scip, activity, SCIProwGetLhs(row));
 }
 
 /**
@@ -565,9 +649,7 @@ auto row_is_active(Scip* const scip, scip::Row* const row) noexcept -> bool {
  * Weights for non activate rows are left as NaN and ununsed.
  * This is equivalent to an unsafe/unchecked masked tensor.
  */
-auto stats_for_active_constraint_coefficients_weights(scip::Model const& model) {
-	auto* const scip = model.get_scip_ptr();
-	auto const lp_rows = model.lp_rows();
+auto stats_for_active_constraint_coefficients_weights(scip::Model const& model, scip::LpSnapshot const& lp) {
 	auto const branch_candidates = model.pseudo_branch_cands() | ranges::to<std::set>();
 
 	/** Check if a column is a branching candidate. */
@@ -592,16 +674,17 @@ auto stats_for_active_constraint_coefficients_weights(scip::Model const& model)
 	/** Compute the inverse of a number or 1 if the number is zero. */
 	auto safe_inv = [](auto const x) { return x != 0. ? 1. / x : 1.; };
 
-	xt::xtensor<value_type, 2> weights{{lp_rows.size(), 4}, std::nan("")};
+	xt::xtensor<value_type, 2> weights{{lp.n_rows(), 4}, std::nan("")};
 	auto* weights_iter = weights.begin();
 
-	for (auto* const row : lp_rows) {
-		if (row_is_active(scip, row)) {
+	for (std::size_t row_idx = 0; row_idx < lp.n_rows(); ++row_idx) {
+		auto* const row = lp.rows[row_idx];
+		if (row_is_active(model.get_scip_ptr(), lp, row)) {
 			auto const row_cols_vals = scip_row_get_vals(row);
 			*(weights_iter++) = 1.;
 			*(weights_iter++) = safe_inv(sum_abs(row_cols_vals));
 			*(weights_iter++) = safe_inv(sum_abs_if_candidate(scip_row_get_cols(row), row_cols_vals));
-			*(weights_iter++) = std::abs(SCIProwGetDualsol(row));
+			*(weights_iter++) = std::abs(lp.row_dualsols[row_idx]);
 		} else {
 			weights_iter += 4;
 		}
@@ -625,7 +708,8 @@ auto stats_for_active_constraint_coefficients_weights(scip::Model const& model)
  * compute the weighted number of active constraints that xj is in, with the same 4 weightings.
  */
 auto stats_for_active_constraint_coefficients(
-	Scip* const scip,
+	SCIP* const scip,
+	scip::LpSnapshot const& lp,
 	nonstd::span<scip::Row*> const rows,
 	nonstd::span<scip::real> const coefficients,
 	xt::xtensor<value_type, 2> active_rows_weights) noexcept {
@@ -640,7 +724,7 @@ auto stats_for_active_constraint_coefficients(
 	for (auto const [row, coef] : views::zip(rows, coefficients)) {
 		auto const row_lp_idx = SCIProwGetLPPos(row);
 
-		if (row_is_active(scip, row)) {
+		if (row_is_active(scip, lp, row)) {
 			n_active_rows++;
 
 			for (std::size_t weight_idx = 0; weight_idx < weights_stats.size(); ++weight_idx) {
@@ -664,7 +748,7 @@ auto stats_for_active_constraint_coefficients(
 
 		for (auto const [row, coef] : views::zip(rows, coefficients)) {
 			auto const row_lp_idx = SCIProwGetLPPos(row);
-			if (row_is_active(scip, row)) {
+			if (row_is_active(scip, lp, row)) {
 				for (std::size_t weight_idx = 0; weight_idx < weights_stats.size(); ++weight_idx) {
 					auto const weight = active_rows_weights(row_lp_idx, weight_idx);
 					assert(!std::isnan(weight));  // If NaN likely hit a maked value
@@ -715,35 +799,50 @@ auto stats_for_active_constraint_coefficients(
 }
 
 /**
- * Extract the dynamic features for a single branching candidate variable.
+ * Write the dynamic features of the given groups for a single branching candidate variable.
  *
  * The precomputed static features given as input parameters are wrapped in their strong type to
  * avoid passing the wrong ones.
  */
 template <typename... FeatVal>
-auto extract_dynamic_features(
+void extract_dynamic_features(
+	value_type* const row,
+	FeatureGroups const& groups,
+	GroupOffsets const& offsets,
 	Scip* const scip,
+	scip::LpSnapshot const& lp,
 	scip::Var* const var,
 	xt::xtensor<value_type, 2> const& active_rows_weights,
 	std::tuple<FeatVal...> const& root_deg_stats) {
 	auto* const col = SCIPvarGetCol(var);
 	auto const rows = scip_col_get_rows(col);
 	auto const coefficients = scip_col_get_vals(col);
+	auto const enabled = [&groups](Group group) { return groups[group_index(group)]; };
 
-	auto features = std::tuple_cat(
-		slack_ceil_and_pseudocosts(scip, var, col),
-		infeasibility_statistics(var),
-		dynamic_stats_for_constraint_degree(rows, root_deg_stats),
-		min_max_for_ratios_constraint_coeffs_rhs(scip, rows, coefficients),
-		min_max_for_one_to_all_coefficient_ratios(rows, coefficients),
-		stats_for_active_constraint_coefficients(scip, rows, coefficients, active_rows_weights));
-	return features_tuple_to_tensor(features);
-
-	// Make sure at compile time that features are returned in correct order
-	using Tuple = decltype(features);
-	static_assert(is_contiguous(Tuple{}), "Dynammic features are permuted");
-	static_assert(first_index(Tuple{}) == Feature::n_static, "Dynamic features start at n_static");
-	static_assert(last_index(Tuple{}) == Feature::n_features - 1, "Missing dynamic features");
+	if (enabled(Group::slack_ceil_dist)) {
+		write_group<Group::slack_ceil_dist>(row, offsets, slack_and_ceil_distances(scip, col));
+	}
+	if (enabled(Group::pseudocosts)) {
+		write_group<Group::pseudocosts>(row, offsets, pseudocosts(scip, var, col));
+	}
+	if (enabled(Group::infeasibility)) {
+		write_group<Group::infeasibility>(row, offsets, infeasibility_statistics(var));
+	}
+	if (enabled(Group::dynamic_rows_deg)) {
+		write_group<Group::dynamic_rows_deg>(row, offsets, dynamic_stats_for_constraint_degree(rows, root_deg_stats));
+	}
+	if (enabled(Group::coef_rhs_ratios)) {
+		write_group<Group::coef_rhs_ratios>(
+			row, offsets, min_max_for_ratios_constraint_coeffs_rhs(scip, rows, coefficients));
+	}
+	if (enabled(Group::coef_coef_ratios)) {
+		write_group<Group::coef_coef_ratios>(
+			row, offsets, min_max_for_one_to_all_coefficient_ratios(rows, coefficients));
+	}
+	if (enabled(Group::active_coefs)) {
+		write_group<Group::active_coefs>(
+			row, offsets, stats_for_active_constraint_coefficients(scip, lp, rows, coefficients, active_rows_weights));
+	}
 }
 
 /******************************
@@ -758,28 +857,39 @@ template <typename Tensor> auto extract_reused_static_features(Tensor const& ten
 	};
 }
 
-auto extract_all_features(scip::Model const& model, xt::xtensor<value_type, 2> const& static_features) {
-
-	xt::xtensor<value_type, 2> observation{
-		{model.pseudo_branch_cands().size(), Feature::n_static + Feature::n_dynamic},
-		std::nan(""),
-	};
+auto extract_all_features(
+	scip::Model const& model,
+	xt::xtensor<value_type, 2> const& static_features,
+	FeatureGroups const& groups) {
+	auto const pseudo_branch_cands = model.pseudo_branch_cands();
+	auto const n_pseudo_branch_cands = pseudo_branch_cands.size();
+	xt::xtensor<value_type, 2> observation{{n_pseudo_branch_cands, n_features_of(groups)}, std::nan("")};
+	auto const offsets = group_offsets(groups);
 
 	auto* const scip = model.get_scip_ptr();
-	auto const active_rows_weights = stats_for_active_constraint_coefficients_weights(model);
+	auto const& lp = model.lp_snapshot();
+	// The weights are only needed by the (costly) active constraint statistics
+	auto active_rows_weights = xt::xtensor<value_type, 2>{};
+	if (groups[group_index(Group::active_coefs)]) {
+		active_rows_weights = stats_for_active_constraint_coefficients_weights(model, lp);
+	}
 
-	auto const pseudo_branch_cands = model.pseudo_branch_cands();
-	auto const n_pseudo_branch_cands = pseudo_branch_cands.size();
 	for (std::size_t var_idx = 0; var_idx < n_pseudo_branch_cands; ++var_idx) {
 		auto* const var = pseudo_branch_cands[var_idx];
-		auto const col_idx = static_cast<std::ptrdiff_t>(SCIPcolGetIndex(SCIPvarGetCol(var)));
+		auto const col_idx = static_cast<std::size_t>(SCIPcolGetIndex(SCIPvarGetCol(var)));
+		auto const* const static_row = static_features.data() + col_idx * Feature::n_static;
+		auto* const row = observation.data() + var_idx * observation.shape(1);
 
-		using namespace xt::placeholders;
 		// Static features are precomputed
-		xt::view(observation, var_idx, xt::range(_, Feature::n_static)) = xt::row(static_features, col_idx);
+		for (std::size_t i = 0; i < group_index(Group::slack_ceil_dist); ++i) {
+			if (groups[i]) {
+				auto const* const begin = static_row + group_begin(static_cast<Group>(i));
+				std::copy(begin, begin + group_sizes[i], row + offsets[i]);
+			}
+		}
 		// Dynamic features
-		xt::view(observation, var_idx, xt::range(Feature::n_static, _)) = extract_dynamic_features(
-			scip, var, active_rows_weights, extract_reused_static_features(xt::row(static_features, col_idx)));
+		extract_dynamic_features(
+			row, groups, offsets, scip, lp, var, active_rows_weights, extract_reused_static_features(static_row));
 	}
 
 	return observation;
@@ -796,6 +906,29 @@ auto is_on_root_node(scip::Model const& model) -> bool {
  *  Observation extracting function  *
  *************************************/
 
+Khalil2016::Khalil2016() noexcept {
+	groups.set();
+}
+
+Khalil2016::Khalil2016(std::vector<Feature::Group> const& groups_) {
+	for (auto const group : groups_) {
+		groups.set(group_index(group));
+	}
+}
+
+auto Khalil2016::features() const -> std::vector<std::size_t> {
+	auto indices = std::vector<std::size_t>{};
+	for (std::size_t i = 0; i < Feature::n_groups; ++i) {
+		if (groups[i]) {
+			auto const begin = group_begin(static_cast<Group>(i));
+			for (auto feature = begin; feature < begin + group_sizes[i]; ++feature) {
+				indices.push_back(feature);
+			}
+		}
+	}
+	return indices;
+}
+
 void Khalil2016::before_reset(scip::Model& /* model */) {
 	static_features = decltype(static_features){};
 }
@@ -805,7 +938,7 @@ auto Khalil2016::extract(scip::Model& model, bool /* done */) -> std::optional<K
 		if (is_on_root_node(model)) {
 			static_features = extract_static_features(model);
 		}
-		return extract_all_features(model, static_features);
+		return extract_all_features(model, static_features, groups);
 	}
 	return {};
 }
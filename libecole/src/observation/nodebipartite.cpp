@@ -8,8 +8,8 @@
 #include <xtensor/xview.hpp>
 
 #include "ecole/observation/nodebipartite.hpp"
+#include "ecole/scip/lp-snapshot.hpp"
 #include "ecole/scip/model.hpp"
-#include "ecole/scip/row.hpp"
 #include "ecole/scip/type.hpp"
 
 namespace ecole::observation {
@@ -26,47 +26,44 @@ using value_type = tensor::value_type;
 value_type constexpr cste = 5.;
 value_type constexpr nan = std::numeric_limits<value_type>::quiet_NaN();
 
-scip::real obj_l2_norm(Scip* const scip) noexcept {
-	auto const norm = SCIPgetObjNorm(scip);
+scip::real obj_l2_norm(scip::LpSnapshot const& lp) noexcept {
+	auto const norm = lp.obj_norm;
 	return norm > 0 ? norm : 1.;
 }
 
-/******************************************
- *  Column features extraction functions  *
- ******************************************/
+/***************************
+ *  Column feature groups  *
+ ***************************/
 
-std::optional<scip::real> upper_bound(Scip* const scip, scip::Col* const col) noexcept {
-	auto const ub_val = SCIPcolGetUb(col);
-	if (SCIPisInfinity(scip, std::abs(ub_val))) {
-		return {};
-	}
-	return ub_val;
-}
+using Group = NodeBipartiteObs::ColumnFeatureGroup;
 
-std::optional<scip::real> lower_bound(Scip* const scip, scip::Col* const col) noexcept {
-	auto const lb_val = SCIPcolGetLb(col);
-	if (SCIPisInfinity(scip, std::abs(lb_val))) {
-		return {};
-	}
-	return lb_val;
-}
+/** Number of features in every group of column features, in the order of the groups. */
+std::array<std::size_t, NodeBipartiteObs::n_column_feature_groups> constexpr column_group_sizes = {
+	2, 1, 1, 4, 1, scip::enum_size_v<scip::base_stat>, 1, 1, scip::enum_size_v<scip::var_type>};
 
-bool is_prim_sol_at_lb(Scip* const scip, scip::Col* const col) noexcept {
-	auto const lb_val = lower_bound(scip, col);
-	if (lb_val) {
-		return SCIPisEQ(scip, SCIPcolGetPrimsol(col), lb_val.value());
+constexpr auto n_all_column_features() noexcept {
+	auto n_features = std::size_t{0};
+	for (auto const size : column_group_sizes) {
+		n_features += size;
 	}
-	return false;
+	return n_features;
 }
+static_assert(n_all_column_features() == NodeBipartiteObs::n_column_features, "Groups do not match features");
 
-bool is_prim_sol_at_ub(Scip* const scip, scip::Col* const col) noexcept {
-	auto const ub_val = upper_bound(scip, col);
-	if (ub_val) {
-		return SCIPisEQ(scip, SCIPcolGetPrimsol(col), ub_val.value());
+std::size_t n_column_features_of(NodeBipartite::ColumnFeatureGroups const& groups) noexcept {
+	auto n_features = std::size_t{0};
+	for (std::size_t i = 0; i < column_group_sizes.size(); ++i) {
+		if (groups[i]) {
+			n_features += column_group_sizes[i];
+		}
 	}
-	return false;
+	return n_features;
 }
 
+/******************************************
+ *  Column features extraction functions  *
+ ******************************************/
+
 std::optional<scip::real> best_sol_val(Scip* const scip, scip::Var* const var) noexcept {
 	auto* const sol = SCIPgetBestSol(scip);
 	if (sol != nullptr) {
@@ -82,39 +79,64 @@ std::optional<scip::real> avg_sol(Scip* const scip, scip::Var* const var) noexce
 	return {};
 }
 
-std::optional<scip::real> feas_frac(Scip* const scip, scip::Var* const var, scip::Col* const col) noexcept {
+std::optional<scip::real> feas_frac(Scip* const scip, scip::Var* const var, scip::real const primsol) noexcept {
 	if (SCIPvarGetType(var) == SCIP_VARTYPE_CONTINUOUS) {
 		return {};
 	}
-	return SCIPfeasFrac(scip, SCIPcolGetPrimsol(col));
+	return SCIPfeasFrac(scip, primsol);
 }
 
-auto extract_col_feat(scip::Model const& model) {
-	auto constexpr n_col_feat = 11 + scip::enum_size_v<scip::var_type> + scip::enum_size_v<scip::base_stat>;
+auto extract_col_feat(
+	scip::Model const& model,
+	scip::LpSnapshot const& lp,
+	NodeBipartite::ColumnFeatureGroups const& groups) {
+	auto const enabled = [&groups](Group group) { return groups[static_cast<std::size_t>(group)]; };
 	auto* const scip = model.get_scip_ptr();
-	tensor col_feat{{model.lp_columns().size(), n_col_feat}, 0.};
+	tensor col_feat{{lp.n_cols(), n_column_features_of(groups)}, 0.};
 
 	auto const n_lps = static_cast<value_type>(SCIPgetNLPs(scip));
-	value_type const obj_norm = obj_l2_norm(scip);
+	value_type const obj_norm = obj_l2_norm(lp);
 
+	// Features of disabled groups are skipped, so that enabled groups are written contiguously
 	auto* iter = col_feat.begin();
-	for (auto* const col : model.lp_columns()) {
-		auto* const var = SCIPcolGetVar(col);
-		*(iter++) = static_cast<value_type>(lower_bound(scip, col).has_value());
-		*(iter++) = static_cast<value_type>(upper_bound(scip, col).has_value());
-		*(iter++) = SCIPgetColRedcost(scip, col) / obj_norm;
-		*(iter++) = SCIPcolGetObj(col) / obj_norm;
-		*(iter++) = SCIPcolGetPrimsol(col);
-		*(iter++) = feas_frac(scip, var, col).value_or(0.);
-		*(iter++) = static_cast<value_type>(is_prim_sol_at_lb(scip, col));
-		*(iter++) = static_cast<value_type>(is_prim_sol_at_ub(scip, col));
-		*(iter++) = static_cast<value_type>(col->age) / (n_lps + cste);
-		iter[static_cast<std::size_t>(SCIPcolGetBasisStatus(col))] = 1.;
-		iter += scip::enum_size_v<scip::base_stat>;
-		*(iter++) = best_sol_val(scip, var).value_or(nan);
-		*(iter++) = avg_sol(scip, var).value_or(nan);
-		iter[static_cast<std::size_t>(SCIPvarGetType(var))] = 1.;
-		iter += scip::enum_size_v<scip::var_type>;
+	for (std::size_t i = 0; i < lp.n_cols(); ++i) {
+		auto* const var = lp.col_vars[i];
+		auto const primsol = lp.col_primsols[i];
+		auto const has_lb = !SCIPisInfinity(scip, std::abs(lp.col_lbs[i]));
+		auto const has_ub = !SCIPisInfinity(scip, std::abs(lp.col_ubs[i]));
+		if (enabled(Group::bounds)) {
+			*(iter++) = static_cast<value_type>(has_lb);
+			*(iter++) = static_cast<value_type>(has_ub);
+		}
+		if (enabled(Group::reduced_cost)) {
+			*(iter++) = lp.col_redcosts[i] / obj_norm;
+		}
+		if (enabled(Group::objective)) {
+			*(iter++) = lp.col_objs[i] / obj_norm;
+		}
+		if (enabled(Group::solution)) {
+			*(iter++) = primsol;
+			*(iter++) = feas_frac(scip, var, primsol).value_or(0.);
+			*(iter++) = static_cast<value_type>(has_lb && SCIPisEQ(scip, primsol, lp.col_lbs[i]));
+			*(iter++) = static_cast<value_type>(has_ub && SCIPisEQ(scip, primsol, lp.col_ubs[i]));
+		}
+		if (enabled(Group::age)) {
+			*(iter++) = static_cast<value_type>(lp.cols[i]->age) / (n_lps + cste);
+		}
+		if (enabled(Group::basis)) {
+			iter[static_cast<std::size_t>(lp.col_basis_statuses[i])] = 1.;
+			iter += scip::enum_size_v<scip::base_stat>;
+		}
+		if (enabled(Group::incumbent)) {
+			*(iter++) = best_sol_val(scip, var).value_or(nan);
+		}
+		if (enabled(Group::average_incumbent)) {
+			*(iter++) = avg_sol(scip, var).value_or(nan);
+		}
+		if (enabled(Group::type)) {
+			iter[static_cast<std::size_t>(SCIPvarGetType(var))] = 1.;
+			iter += scip::enum_size_v<scip::var_type>;
+		}
 	}
 
 	// Make sure we iterated over as many element as there are in the tensor
@@ -127,15 +149,15 @@ auto extract_col_feat(scip::Model const& model) {
  *  Row features extraction functions  *
  ***************************************/
 
-scip::real row_l2_norm(scip::Row* const row) noexcept {
-	auto const norm = SCIProwGetNorm(row);
+scip::real row_l2_norm(scip::LpSnapshot const& lp, std::size_t row) noexcept {
+	auto const norm = lp.row_norms[row];
 	return norm > 0 ? norm : 1.;
 }
 
-scip::real obj_cos_sim(Scip* const scip, scip::Row* const row) noexcept {
-	auto const norm_prod = SCIProwGetNorm(row) * SCIPgetObjNorm(scip);
+scip::real obj_cos_sim(Scip* const scip, scip::LpSnapshot const& lp, std::size_t row) noexcept {
+	auto const norm_prod = lp.row_norms[row] * lp.obj_norm;
 	if (SCIPisPositive(scip, norm_prod)) {
-		return row->objprod / norm_prod;
+		return lp.rows[row]->objprod / norm_prod;
 	}
 	return 0.;
 }
@@ -145,47 +167,46 @@ scip::real obj_cos_sim(Scip* const scip, scip::Row* const row) noexcept {
  *
  * Row are counted once per right hand side and once per left hand side.
  */
-std::size_t n_ineq_rows(scip::Model const& model) {
-	auto* const scip = model.get_scip_ptr();
+std::size_t n_ineq_rows(scip::LpSnapshot const& lp) {
 	std::size_t count = 0;
-	for (auto* row : model.lp_rows()) {
-		count += static_cast<std::size_t>(scip::get_unshifted_lhs(scip, row).has_value());
-		count += static_cast<std::size_t>(scip::get_unshifted_rhs(scip, row).has_value());
+	for (std::size_t row = 0; row < lp.n_rows(); ++row) {
+		count += static_cast<std::size_t>(lp.row_has_lhs[row]);
+		count += static_cast<std::size_t>(lp.row_has_rhs[row]);
 	}
 	return count;
 }
 
-auto extract_row_feat(scip::Model const& model) {
+auto extract_row_feat(scip::Model const& model, scip::LpSnapshot const& lp) {
 	auto constexpr n_row_feat = 5;
 	auto* const scip = model.get_scip_ptr();
-	tensor row_feat{{n_ineq_rows(model), n_row_feat}, 0.};
+	tensor row_feat{{n_ineq_rows(lp), n_row_feat}, 0.};
 
 	auto const n_lps = static_cast<value_type>(SCIPgetNLPs(scip));
-	value_type const obj_norm = obj_l2_norm(scip);
+	value_type const obj_norm = obj_l2_norm(lp);
 
-	auto extract_row = [n_lps, obj_norm, scip](auto& iter, auto const row, bool const lhs) {
+	auto extract_row = [n_lps, obj_norm, scip, &lp](auto& iter, std::size_t const row, bool const lhs) {
 		value_type const sign = lhs ? -1. : 1.;
-		auto row_norm = static_cast<value_type>(row_l2_norm(row));
+		auto row_norm = static_cast<value_type>(row_l2_norm(lp, row));
 		if (lhs) {
-			*(iter++) = sign * scip::get_unshifted_lhs(scip, row).value() / row_norm;
-			*(iter++) = static_cast<value_type>(scip::is_at_lhs(scip, row));
+			*(iter++) = sign * lp.unshifted_lhs(row) / row_norm;
+			*(iter++) = static_cast<value_type>(lp.row_at_lhs[row]);
 		} else {
-			*(iter++) = sign * scip::get_unshifted_rhs(scip, row).value() / row_norm;
-			*(iter++) = static_cast<value_type>(scip::is_at_rhs(scip, row));
+			*(iter++) = sign * lp.unshifted_rhs(row) / row_norm;
+			*(iter++) = static_cast<value_type>(lp.row_at_rhs[row]);
 		}
-		*(iter++) = static_cast<value_type>(SCIProwGetAge(row)) / (n_lps + cste);
-		*(iter++) = sign * obj_cos_sim(scip, row);
-		*(iter++) = sign * SCIProwGetDualsol(row) / (row_norm * obj_norm);
+		*(iter++) = static_cast<value_type>(SCIProwGetAge(lp.rows[row])) / (n_lps + cste);
+		*(iter++) = sign * obj_cos_sim(scip, lp, row);
+		*(iter++) = sign * lp.row_dualsols[row] / (row_norm * obj_norm);
 	};
 
 	auto* iter_ = row_feat.begin();
-	for (auto* const row_ : model.lp_rows()) {
+	for (std::size_t row = 0; row < lp.n_rows(); ++row) {
 		// Rows are counted once per rhs and once per lhs
-		if (scip::get_unshifted_lhs(scip, row_).has_value()) {
-			extract_row(iter_, row_, true);
+		if (lp.row_has_lhs[row]) {
+			extract_row(iter_, row, true);
 		}
-		if (scip::get_unshifted_rhs(scip, row_).has_value()) {
-			extract_row(iter_, row_, false);
+		if (lp.row_has_rhs[row]) {
+			extract_row(iter_, row, false);
 		}
 	}
 
@@ -204,36 +225,28 @@ auto extract_row_feat(scip::Model const& model) {
  *
  * Row are counted once per right hand side and once per left hand side.
  */
-auto matrix_nnz(scip::Model const& model) {
-	auto* const scip = model.get_scip_ptr();
+auto matrix_nnz(scip::LpSnapshot const& lp) {
 	std::size_t nnz = 0;
-	for (auto* row : model.lp_rows()) {
-		auto const row_size = static_cast<std::size_t>(SCIProwGetNLPNonz(row));
-		if (scip::get_unshifted_lhs(scip, row).has_value()) {
-			nnz += row_size;
-		}
-		if (scip::get_unshifted_rhs(scip, row).has_value()) {
-			nnz += row_size;
-		}
+	for (std::size_t row = 0; row < lp.n_rows(); ++row) {
+		auto const n_sides = static_cast<std::size_t>(lp.row_has_lhs[row]) + static_cast<std::size_t>(lp.row_has_rhs[row]);
+		nnz += n_sides * lp.row_n_lp_nonzs[row];
 	}
 	return nnz;
 }
 
-utility::coo_matrix<value_type> extract_edge_feat(scip::Model const& model) {
-	auto* const scip = model.get_scip_ptr();
-
+utility::coo_matrix<value_type> extract_edge_feat(scip::LpSnapshot const& lp) {
 	using coo_matrix = utility::coo_matrix<value_type>;
-	auto const nnz = matrix_nnz(model);
+	auto const nnz = matrix_nnz(lp);
 	auto values = decltype(coo_matrix::values)::from_shape({nnz});
 	auto indices = decltype(coo_matrix::indices)::from_shape({2, nnz});
 
 	std::size_t i = 0;
 	std::size_t j = 0;
-	for (auto* const row : model.lp_rows()) {
-		auto* const row_cols = SCIProwGetCols(row);
-		auto const* const row_vals = SCIProwGetVals(row);
-		auto const row_nnz = static_cast<std::size_t>(SCIProwGetNLPNonz(row));
-		if (scip::get_unshifted_lhs(scip, row).has_value()) {
+	for (std::size_t row = 0; row < lp.n_rows(); ++row) {
+		auto* const row_cols = SCIProwGetCols(lp.rows[row]);
+		auto const* const row_vals = SCIProwGetVals(lp.rows[row]);
+		auto const row_nnz = lp.row_n_lp_nonzs[row];
+		if (lp.row_has_lhs[row]) {
 			for (std::size_t k = 0; k < row_nnz; ++k) {
 				indices(0, j + k) = i;
 				indices(1, j + k) = static_cast<std::size_t>(SCIPcolGetLPPos(row_cols[k]));
@@ -242,7 +255,7 @@ utility::coo_matrix<value_type> extract_edge_feat(scip::Model const& model) {
 			j += row_nnz;
 			i++;
 		}
-		if (scip::get_unshifted_rhs(scip, row).has_value()) {
+		if (lp.row_has_rhs[row]) {
 			for (std::size_t k = 0; k < row_nnz; ++k) {
 				indices(0, j + k) = i;
 				indices(1, j + k) = static_cast<std::size_t>(SCIPcolGetLPPos(row_cols[k]));
@@ -253,9 +266,7 @@ utility::coo_matrix<value_type> extract_edge_feat(scip::Model const& model) {
 		}
 	}
 
-	auto const n_rows = n_ineq_rows(model);
-	auto const n_cols = static_cast<std::size_t>(SCIPgetNLPCols(scip));
-	return {values, indices, {n_rows, n_cols}};
+	return {values, indices, {i, lp.n_cols()}};
 }
 
 }  // namespace
@@ -264,9 +275,35 @@ utility::coo_matrix<value_type> extract_edge_feat(scip::Model const& model) {
  *  Observation extracting function  *
  *************************************/
 
+NodeBipartite::NodeBipartite() noexcept {
+	column_groups.set();
+}
+
+NodeBipartite::NodeBipartite(std::vector<NodeBipartiteObs::ColumnFeatureGroup> const& column_groups_) {
+	for (auto const group : column_groups_) {
+		column_groups.set(static_cast<std::size_t>(group));
+	}
+}
+
+auto NodeBipartite::column_features() const -> std::vector<NodeBipartiteObs::ColumnFeatures> {
+	auto features = std::vector<NodeBipartiteObs::ColumnFeatures>{};
+	auto begin = std::size_t{0};
+	for (std::size_t i = 0; i < column_group_sizes.size(); ++i) {
+		if (column_groups[i]) {
+			for (auto feature = begin; feature < begin + column_group_sizes[i]; ++feature) {
+				features.push_back(static_cast<NodeBipartiteObs::ColumnFeatures>(feature));
+			}
+		}
+		begin += column_group_sizes[i];
+	}
+	return features;
+}
+
 auto NodeBipartite::extract(scip::Model& model, bool /* done */) -> std::optional<NodeBipartiteObs> {
 	if (model.get_stage() == SCIP_STAGE_SOLVING) {
-		return NodeBipartiteObs{extract_col_feat(model), extract_row_feat(model), extract_edge_feat(model)};
+		auto const& lp = model.lp_snapshot();
+		return NodeBipartiteObs{
+			extract_col_feat(model, lp, column_groups), extract_row_feat(model, lp), extract_edge_feat(lp)};
 	}
 	return {};
 }
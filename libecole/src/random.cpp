@@ -1,8 +1,53 @@
-#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <random>
 
 #include "ecole/random.hpp"
 
 namespace ecole {
+
+/******************************
+ *  Definition of Philox4x32  *
+ ******************************/
+
+auto Philox4x32::split(std::uint64_t id) const noexcept -> Philox4x32 {
+	// The key is changed so that the blocks used for splitting are never values generated by the engine
+	constexpr auto split_key = Key{0x5BD1E995, 0x1B873593};
+	auto const derived = block(
+		{static_cast<std::uint32_t>(stream),
+		 static_cast<std::uint32_t>(stream >> 32U),
+		 static_cast<std::uint32_t>(id),
+		 static_cast<std::uint32_t>(id >> 32U)},
+		{key[0] ^ split_key[0], key[1] ^ split_key[1]});
+	auto engine = Philox4x32{};
+	engine.key = {derived[0], derived[1]};
+	return engine;
+}
+
+auto operator<<(std::ostream& os, Philox4x32 const& engine) -> std::ostream& {
+	return os << engine.key[0] << ' ' << engine.key[1] << ' ' << engine.stream << ' ' << engine.position;
+}
+
+auto operator>>(std::istream& is, Philox4x32& engine) -> std::istream& {
+	auto key = Philox4x32::Key{};
+	auto stream = std::uint64_t{0};
+	auto position = std::uint64_t{0};
+	if (is >> key[0] >> key[1] >> stream >> position) {
+		engine.key = key;
+		engine.stream = stream;
+		engine.position = position;
+		engine.buffer_valid = false;
+	}
+	return is;
+}
+
+/********************************************
+ *  Management of the source of randomness  *
+ ********************************************/
+
 namespace {
 
 class RandomEngineManager {
@@ -11,15 +56,16 @@ public:
 
 	auto seed(Seed val) -> void;
 	auto spawn() -> RandomEngine;
+	auto spawn(std::uint64_t id) -> RandomEngine;
 
 private:
-	std::mutex m;
-	Seed user_seed = 0;
-	Seed spawn_seed = 0;
+	/** Engines spawned without id are split from a dedicated engine, so that they differ from the ones with an id. */
+	static constexpr auto anonymous_id = std::numeric_limits<std::uint64_t>::max();
 
-	RandomEngineManager();
+	std::atomic<Seed> user_seed;
+	std::atomic<std::uint64_t> n_spawned{0};
 
-	auto new_seed_seq() -> std::seed_seq;
+	RandomEngineManager();
 };
 
 }  // namespace
@@ -32,6 +78,10 @@ auto spawn_random_engine() -> RandomEngine {
 	return RandomEngineManager::get().spawn();
 }
 
+auto spawn_random_engine(std::uint64_t id) -> RandomEngine {
+	return RandomEngineManager::get().spawn(id);
+}
+
 namespace {
 
 auto RandomEngineManager::get() -> RandomEngineManager& {
@@ -40,22 +90,19 @@ auto RandomEngineManager::get() -> RandomEngineManager& {
 }
 
 auto RandomEngineManager::seed(Seed val) -> void {
-	auto const lk = std::unique_lock{m};
-	user_seed = val;
-	spawn_seed = 0;
+	user_seed.store(val);
+	n_spawned.store(0);
 }
 
 auto RandomEngineManager::spawn() -> RandomEngine {
-	auto seeds = new_seed_seq();
-	return RandomEngine{seeds};
+	return RandomEngine{user_seed.load()}.split(anonymous_id).split(n_spawned.fetch_add(1));
 }
 
-RandomEngineManager::RandomEngineManager() : user_seed{std::random_device{}()} {}
-
-auto RandomEngineManager::new_seed_seq() -> std::seed_seq {
-	auto const lk = std::unique_lock{m};
-	return {user_seed, ++spawn_seed};
+auto RandomEngineManager::spawn(std::uint64_t id) -> RandomEngine {
+	return RandomEngine{user_seed.load()}.split(id);
 }
 
+RandomEngineManager::RandomEngineManager() : user_seed{std::random_device{}()} {}
+
 }  // namespace
 }  // namespace ecole
@@ -0,0 +1,23 @@
+#include "ecole/reward/bound.hpp"
+#include "ecole/scip/bound-tracker.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::reward {
+
+void PrimalBound::before_reset(scip::Model& model) {
+	model.track_bounds();
+}
+
+Reward PrimalBound::extract(scip::Model& model, bool /* done */) {
+	return model.update_bound_tracker().primal_bound;
+}
+
+void DualBound::before_reset(scip::Model& model) {
+	model.track_bounds();
+}
+
+Reward DualBound::extract(scip::Model& model, bool /* done */) {
+	return model.update_bound_tracker().dual_bound;
+}
+
+}  // namespace ecole::reward
@@ -0,0 +1,19 @@
+#include "ecole/reward/primaldualintegral.hpp"
+#include "ecole/scip/bound-tracker.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::reward {
+
+void PrimalDualIntegral::before_reset(scip::Model& model) {
+	model.track_bounds();
+	last_integral = 0.;
+}
+
+Reward PrimalDualIntegral::extract(scip::Model& model, bool /* done */) {
+	auto const integral = model.update_bound_tracker().primal_dual_integral;
+	auto const integral_diff = integral - last_integral;
+	last_integral = integral;
+	return integral_diff;
+}
+
+}  // namespace ecole::reward
@@ -0,0 +1,38 @@
+#include <algorithm>
+#include <cmath>
+
+#include "ecole/scip/bound-tracker.hpp"
+
+namespace ecole::scip {
+
+BoundTracker::BoundTracker(real infinity_, bool minimize) noexcept :
+	infinity{infinity_}, primal_bound{minimize ? infinity_ : -infinity_}, dual_bound{-primal_bound} {}
+
+void BoundTracker::seed(real primal_bound_, real dual_bound_, real time) noexcept {
+	last_time = time;
+	primal_bound = primal_bound_;
+	dual_bound = dual_bound_;
+	last_gap = gap(primal_bound, dual_bound);
+	++n_updates;
+}
+
+void BoundTracker::update(real primal_bound_, real dual_bound_, real time) noexcept {
+	primal_dual_integral = primal_dual_integral_at(time);
+	last_time = time;
+	primal_bound = primal_bound_;
+	dual_bound = dual_bound_;
+	last_gap = gap(primal_bound, dual_bound);
+	++n_updates;
+}
+
+real BoundTracker::gap(real primal, real dual) const noexcept {
+	if (primal == dual) {
+		return 0.;
+	}
+	if (std::abs(primal) >= infinity || std::abs(dual) >= infinity || primal * dual < 0.) {
+		return 1.;
+	}
+	return std::abs(primal - dual) / std::max(std::abs(primal), std::abs(dual));
+}
+
+}  // namespace ecole::scip
@@ -0,0 +1,47 @@
+#include <cassert>
+
+#include "ecole/scip/cons.hpp"
+
+#include "scip/utils.hpp"
+
+namespace ecole::scip {
+
+void ConsReleaser::operator()(SCIP_CONS* ptr) {
+	scip::call(SCIPreleaseCons, scip, &ptr);
+}
+
+auto create_cons_basic_linear(
+	SCIP* scip,
+	std::string const& name,
+	nonstd::span<Var* const> vars,
+	nonstd::span<real const> vals,
+	real lhs,
+	real rhs) -> unique_cons {
+	assert(vars.size() == vals.size());
+	SCIP_CONS* cons = nullptr;
+	// SCIP does not modify the arrays but is not const correct
+	scip::call(
+		SCIPcreateConsBasicLinear,
+		scip,
+		&cons,
+		name.c_str(),
+		static_cast<int>(vars.size()),
+		const_cast<Var**>(vars.data()),  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+		const_cast<real*>(vals.data()),  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+		lhs,
+		rhs);
+	return {cons, ConsReleaser{scip}};
+}
+
+void add_cons_basic_linear(
+	SCIP* scip,
+	std::string const& name,
+	nonstd::span<Var* const> vars,
+	nonstd::span<real const> vals,
+	real lhs,
+	real rhs) {
+	auto cons = create_cons_basic_linear(scip, name, vars, vals, lhs, rhs);
+	scip::call(SCIPaddCons, scip, cons.get());
+}
+
+}  // namespace ecole::scip
@@ -0,0 +1,92 @@
+#include <cmath>
+
+#include <scip/scip.h>
+
+#include "ecole/scip/lp-snapshot.hpp"
+
+#include "scip/utils.hpp"
+
+namespace ecole::scip {
+
+auto LpSnapshot::current_key(SCIP* scip) noexcept -> Key {
+	auto* const node = SCIPgetCurrentNode(scip);
+	return {
+		node != nullptr ? SCIPnodeGetNumber(node) : -1,
+		SCIPgetNLPs(scip),
+		SCIPgetNLPCols(scip),
+		SCIPgetNLPRows(scip),
+	};
+}
+
+void LpSnapshot::gather(SCIP* scip) {
+	// Invalid until fully gathered
+	key.reset();
+
+	auto const n_lp_cols = static_cast<std::size_t>(SCIPgetNLPCols(scip));
+	auto* const* const lp_cols = SCIPgetLPCols(scip);
+	cols.assign(lp_cols, lp_cols + n_lp_cols);
+	col_vars.resize(n_lp_cols);
+	col_lbs.resize(n_lp_cols);
+	col_ubs.resize(n_lp_cols);
+	col_objs.resize(n_lp_cols);
+	col_primsols.resize(n_lp_cols);
+	col_redcosts.resize(n_lp_cols);
+	col_basis_statuses.resize(n_lp_cols);
+	for (std::size_t i = 0; i < n_lp_cols; ++i) {
+		auto* const col = cols[i];
+		col_vars[i] = SCIPcolGetVar(col);
+		col_lbs[i] = SCIPcolGetLb(col);
+		col_ubs[i] = SCIPcolGetUb(col);
+		col_objs[i] = SCIPcolGetObj(col);
+		col_primsols[i] = SCIPcolGetPrimsol(col);
+		col_redcosts[i] = SCIPgetColRedcost(scip, col);
+		col_basis_statuses[i] = SCIPcolGetBasisStatus(col);
+	}
+
+	auto const n_lp_rows = static_cast<std::size_t>(SCIPgetNLPRows(scip));
+	auto* const* const lp_rows = SCIPgetLPRows(scip);
+	rows.assign(lp_rows, lp_rows + n_lp_rows);
+	row_lhss.resize(n_lp_rows);
+	row_rhss.resize(n_lp_rows);
+	row_constants.resize(n_lp_rows);
+	row_activities.resize(n_lp_rows);
+	row_dualsols.resize(n_lp_rows);
+	row_norms.resize(n_lp_rows);
+	row_n_lp_nonzs.resize(n_lp_rows);
+	row_has_lhs.resize(n_lp_rows);
+	row_has_rhs.resize(n_lp_rows);
+	row_at_lhs.resize(n_lp_rows);
+	row_at_rhs.resize(n_lp_rows);
+	for (std::size_t i = 0; i < n_lp_rows; ++i) {
+		auto* const row = rows[i];
+		row_lhss[i] = SCIProwGetLhs(row);
+		row_rhss[i] = SCIProwGetRhs(row);
+		row_constants[i] = SCIProwGetConstant(row);
+		row_activities[i] = SCIPgetRowLPActivity(scip, row);
+		row_dualsols[i] = SCIProwGetDualsol(row);
+		row_norms[i] = SCIProwGetNorm(row);
+		row_n_lp_nonzs[i] = static_cast<std::size_t>(SCIProwGetNLPNonz(row));
+		row_has_lhs[i] = !SCIPisInfinity(scip, std::abs(row_lhss[i]));
+		row_has_rhs[i] = !SCIPisInfinity(scip, std::abs(row_rhss[i]));
+		row_at_lhs[i] = SCIPisEQ(scip, row_activities[i], row_lhss[i]);
+		row_at_rhs[i] = SCIPisEQ(scip, row_activities[i], row_rhss[i]);
+	}
+
+	obj_norm = SCIPgetObjNorm(scip);
+
+	lp_branch_cands.clear();
+	lp_branch_cand_sols.clear();
+	auto const lp_solstat = SCIPgetLPSolstat(scip);
+	if ((lp_solstat == SCIP_LPSOLSTAT_OPTIMAL) || (lp_solstat == SCIP_LPSOLSTAT_UNBOUNDEDRAY)) {
+		SCIP_VAR** cands = nullptr;
+		SCIP_Real* cand_sols = nullptr;
+		int n_cands = 0;
+		scip::call(SCIPgetLPBranchCands, scip, &cands, &cand_sols, nullptr, &n_cands, nullptr, nullptr);
+		lp_branch_cands.assign(cands, cands + n_cands);
+		lp_branch_cand_sols.assign(cand_sols, cand_sols + n_cands);
+	}
+
+	key = current_key(scip);
+}
+
+}  // namespace ecole::scip
@@ -6,13 +6,16 @@
 #include <exception>
 #include <iterator>
 #include <string>
+#include <string_view>
 
 #include <fmt/format.h>
 #include <range/v3/view/move.hpp>
 #include <scip/scip.h>
 #include <scip/scipdefplugins.h>
 
+#include "ecole/scip/bound-tracker.hpp"
 #include "ecole/scip/exception.hpp"
+#include "ecole/scip/lp-snapshot.hpp"
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/scimpl.hpp"
 
@@ -174,10 +177,18 @@ void Model::solve() const {
 	scip::call(SCIPsolve, get_scip_ptr());
 }
 
+void Model::presolve() const {
+	scip::call(SCIPpresolve, get_scip_ptr());
+}
+
 bool Model::is_solved() const noexcept {
 	return SCIPgetStage(get_scip_ptr()) == SCIP_STAGE_SOLVED;
 }
 
+void Model::interrupt_solve() const noexcept {
+	scip::interrupt_solve(get_scip_ptr());
+}
+
 void Model::solve_iter() {
 	scimpl->solve_iter();
 }
@@ -186,6 +197,30 @@ void Model::solve_iter_branch(Var* var) {
 	scimpl->solve_iter_branch(var);
 }
 
+void Model::solve_iter_nodesel() {
+	scimpl->solve_iter_nodesel();
+}
+
+void Model::solve_iter_select_node(Node* node) {
+	scimpl->solve_iter_select_node(node);
+}
+
+void Model::solve_iter_heuristic(int frequency) {
+	scimpl->solve_iter_heur(frequency);
+}
+
+void Model::solve_iter_continue() {
+	scimpl->solve_iter_continue();
+}
+
+void Model::solve_iter_cut_selection() {
+	scimpl->solve_iter_sepa();
+}
+
+void Model::solve_iter_select_cuts(std::vector<Row*> cuts) {
+	scimpl->solve_iter_select_cuts(std::move(cuts));
+}
+
 void Model::solve_iter_stop() {
 	scimpl->solve_iter_stop();
 }
@@ -236,6 +271,73 @@ nonstd::span<Row*> Model::lp_rows() const {
 	return {SCIPgetLPRows(scip_ptr), static_cast<std::size_t>(SCIPgetNLPRows(scip_ptr))};
 }
 
+LpSnapshot const& Model::lp_snapshot() const {
+	if (SCIPgetStage(get_scip_ptr()) != SCIP_STAGE_SOLVING) {
+		throw Exception("LP snapshots are only available during solving");
+	}
+	return scimpl->lp_snapshot();
+}
+
+void Model::track_bounds() {
+	scimpl->track_bounds();
+}
+
+BoundTracker const& Model::bound_tracker() const {
+	auto const* const tracker = scimpl->bound_tracker();
+	if (tracker == nullptr) {
+		throw Exception("Bounds are not tracked, track_bounds must be called first");
+	}
+	return *tracker;
+}
+
+BoundTracker const& Model::update_bound_tracker() {
+	auto const& tracker = bound_tracker();
+	scimpl->update_bound_tracker();
+	return tracker;
+}
+
+nonstd::span<Node*> Model::leaves() const {
+	int n_nodes = 0;
+	SCIP_NODE** nodes = nullptr;
+	scip::call(SCIPgetLeaves, get_scip_ptr(), &nodes, &n_nodes);
+	return {nodes, static_cast<std::size_t>(n_nodes)};
+}
+
+nonstd::span<Node*> Model::children() const {
+	int n_nodes = 0;
+	SCIP_NODE** nodes = nullptr;
+	scip::call(SCIPgetChildren, get_scip_ptr(), &nodes, &n_nodes);
+	return {nodes, static_cast<std::size_t>(n_nodes)};
+}
+
+nonstd::span<Node*> Model::siblings() const {
+	int n_nodes = 0;
+	SCIP_NODE** nodes = nullptr;
+	scip::call(SCIPgetSiblings, get_scip_ptr(), &nodes, &n_nodes);
+	return {nodes, static_cast<std::size_t>(n_nodes)};
+}
+
+nonstd::span<Row*> Model::cuts() const {
+	auto* const scip_ptr = get_scip_ptr();
+	if (SCIPgetStage(scip_ptr) != SCIP_STAGE_SOLVING) {
+		throw Exception("Cuts are only available during solving");
+	}
+	return {SCIPgetCuts(scip_ptr), static_cast<std::size_t>(SCIPgetNCuts(scip_ptr))};
+}
+
+std::vector<Heur*> Model::heuristics() const {
+	auto* const scip_ptr = get_scip_ptr();
+	auto const all_heurs = nonstd::span<Heur*>{SCIPgetHeurs(scip_ptr), static_cast<std::size_t>(SCIPgetNHeurs(scip_ptr))};
+	auto heurs = std::vector<Heur*>{};
+	std::copy_if(all_heurs.begin(), all_heurs.end(), std::back_inserter(heurs), [](auto* heur) {
+		return std::string_view{SCIPheurGetName(heur)}.rfind("ecole::", 0) != 0;
+	});
+	std::sort(heurs.begin(), heurs.end(), [](auto* heur1, auto* heur2) {
+		return std::string_view{SCIPheurGetName(heur1)} < std::string_view{SCIPheurGetName(heur2)};
+	});
+	return heurs;
+}
+
 namespace internal {
 
 template <> std::string Caster<std::string, char>::cast(char val) {
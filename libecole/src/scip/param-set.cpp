@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include <fmt/format.h>
+#include <scip/scip.h>
+
+#include "ecole/scip/exception.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/param-set.hpp"
+
+namespace ecole::scip {
+
+namespace {
+
+template <typename T> void check_bounds(std::string const& name, T value, T min, T max) {
+	if ((value < min) || (value > max)) {
+		throw Exception(fmt::format("value {} for parameter <{}> is not in [{}, {}]", value, name, min, max));
+	}
+}
+
+/**
+ * Cast the value to the exact type of the SCIP parameter and check it is a valid value.
+ */
+Param resolve(Model const& model, std::string const& name, Param const& value) {
+	using internal::cast;
+	auto* const scip_param = SCIPgetParam(model.get_scip_ptr(), name.c_str());
+	switch (model.get_param_type(name)) {
+	case ParamType::Bool:
+		return cast<bool>(value);
+	case ParamType::Int: {
+		auto const int_value = cast<int>(value);
+		check_bounds(name, int_value, SCIPparamGetIntMin(scip_param), SCIPparamGetIntMax(scip_param));
+		return int_value;
+	}
+	case ParamType::LongInt: {
+		auto const long_value = cast<long_int>(value);
+		check_bounds(name, long_value, SCIPparamGetLongintMin(scip_param), SCIPparamGetLongintMax(scip_param));
+		return long_value;
+	}
+	case ParamType::Real: {
+		auto const real_value = cast<real>(value);
+		check_bounds(name, real_value, SCIPparamGetRealMin(scip_param), SCIPparamGetRealMax(scip_param));
+		return real_value;
+	}
+	case ParamType::Char: {
+		auto const char_value = cast<char>(value);
+		auto const* const allowed = SCIPparamGetCharAllowedValues(scip_param);
+		if ((allowed != nullptr) && (std::strchr(allowed, char_value) == nullptr)) {
+			throw Exception(fmt::format("value '{}' for parameter <{}> is not in {{{}}}", char_value, name, allowed));
+		}
+		return char_value;
+	}
+	case ParamType::String:
+		return cast<std::string>(value);
+	default:
+		assert(false);  // All enum value should be handled
+		// Non void return for optimized build
+		throw Exception(fmt::format("Could not find type for parameter '{}'", name));
+	}
+}
+
+std::vector<ParamSet::value_type> resolve_all(std::map<std::string, Param> const& name_values, Model const& model) {
+	auto resolved = std::vector<ParamSet::value_type>{};
+	resolved.reserve(name_values.size());
+	// Map iteration order keeps the resolved parameters sorted by name
+	for (auto const& [name, value] : name_values) {
+		resolved.emplace_back(name, resolve(model, name, value));
+	}
+	return resolved;
+}
+
+/**
+ * A Model with SCIP default plugins, created once and only read to resolve parameters.
+ *
+ * Never freed, so that it does not depend on the destruction order of static objects.
+ */
+Model const& default_model() {
+	static auto const* const model = new Model{};  // NOLINT(cppcoreguidelines-owning-memory)
+	return *model;
+}
+
+}  // namespace
+
+ParamSet::ParamSet(std::map<std::string, Param> const& name_values_) : ParamSet(name_values_, default_model()) {}
+
+ParamSet::ParamSet(std::map<std::string, Param> const& name_values_, Model const& model) :
+	ParamSet(from_resolved(resolve_all(name_values_, model))) {}
+
+ParamSet ParamSet::from_resolved(std::vector<value_type>&& resolved_name_values) noexcept {
+	auto param_set = ParamSet{};
+	param_set.name_values = std::move(resolved_name_values);
+	for (auto const& [name, value] : param_set.name_values) {
+		// Same combination as boost::hash_combine
+		auto constexpr magic = std::size_t{0x9e3779b9};
+		auto& seed = param_set.the_hash;
+		seed ^= std::hash<std::string>{}(name) + magic + (seed << 6U) + (seed >> 2U);
+		seed ^= std::hash<Param>{}(value) + magic + (seed << 6U) + (seed >> 2U);
+	}
+	return param_set;
+}
+
+void ParamSet::apply(Model& model) const {
+	for (auto const& [name, value] : name_values) {
+		// Values are stored with their exact SCIP type so the variant index matches the ParamType
+		switch (static_cast<ParamType>(value.index())) {
+		case ParamType::Bool:
+			model.set_param<ParamType::Bool>(name, std::get<bool>(value));
+			break;
+		case ParamType::Int:
+			model.set_param<ParamType::Int>(name, std::get<int>(value));
+			break;
+		case ParamType::LongInt:
+			model.set_param<ParamType::LongInt>(name, std::get<long_int>(value));
+			break;
+		case ParamType::Real:
+			model.set_param<ParamType::Real>(name, std::get<real>(value));
+			break;
+		case ParamType::Char:
+			model.set_param<ParamType::Char>(name, std::get<char>(value));
+			break;
+		case ParamType::String:
+			model.set_param<ParamType::String>(name, std::get<std::string>(value));
+			break;
+		default:
+			assert(false);  // All enum value should be handled
+		}
+	}
+}
+
+ParamSet ParamSet::diff(ParamSet const& other) const {
+	auto different = std::vector<value_type>{};
+	// Both sets are sorted by name
+	std::set_difference(
+		name_values.begin(), name_values.end(), other.begin(), other.end(), std::back_inserter(different));
+	return from_resolved(std::move(different));
+}
+
+std::map<std::string, Param> ParamSet::to_dict() const {
+	return {name_values.begin(), name_values.end()};
+}
+
+bool ParamSet::operator==(ParamSet const& other) const {
+	return (the_hash == other.the_hash) && (name_values == other.name_values);
+}
+
+bool ParamSet::operator!=(ParamSet const& other) const {
+	return !(*this == other);
+}
+
+}  // namespace ecole::scip
@@ -1,9 +1,15 @@
 #include <mutex>
+#include <vector>
 
 #include <objscip/objbranchrule.h>
+#include <objscip/objeventhdlr.h>
+#include <objscip/objheur.h>
+#include <objscip/objnodesel.h>
+#include <objscip/objsepa.h>
 #include <scip/scip.h>
 #include <scip/scipdefplugins.h>
 
+#include "ecole/instrumentation.hpp"
 #include "ecole/scip/scimpl.hpp"
 
 #include "scip/utils.hpp"
@@ -31,6 +37,95 @@ private:
 	std::weak_ptr<utility::Controller::Executor> weak_executor;
 };
 
+/***************************************
+ *  Declaration of the ReverseNodesel  *
+ ***************************************/
+
+class ReverseNodesel : public ::scip::ObjNodesel {
+public:
+	static constexpr int max_priority = 536870911;
+	static constexpr char const* name = "ecole::ReverseNodesel";
+
+	ReverseNodesel(SCIP* scip, std::weak_ptr<utility::Controller::Executor> /*weak_executor_*/);
+
+	auto scip_select(SCIP* scip, SCIP_NODESEL* nodesel, SCIP_NODE** selnode) -> SCIP_RETCODE override;
+	auto scip_comp(SCIP* scip, SCIP_NODESEL* nodesel, SCIP_NODE* node1, SCIP_NODE* node2) -> int override;
+
+	/** Set by the action function to the node to select. */
+	SCIP_NODE* selected_node = nullptr;
+
+private:
+	std::weak_ptr<utility::Controller::Executor> weak_executor;
+};
+
+/************************************
+ *  Declaration of the ReverseHeur  *
+ ************************************/
+
+class ReverseHeur : public ::scip::ObjHeur {
+public:
+	static constexpr int max_priority = 536870911;
+	static constexpr int no_maxdepth = -1;
+	static constexpr char dispchar = 'E';
+
+	ReverseHeur(SCIP* scip, int freq, std::weak_ptr<utility::Controller::Executor> /*weak_executor_*/);
+
+	auto scip_exec(SCIP* scip, SCIP_HEUR* heur, SCIP_HEURTIMING heurtiming, SCIP_Bool nodeinfeasible, SCIP_RESULT* result)
+		-> SCIP_RETCODE override;
+
+private:
+	std::weak_ptr<utility::Controller::Executor> weak_executor;
+};
+
+/************************************
+ *  Declaration of the ReverseSepa  *
+ ************************************/
+
+class ReverseSepa : public ::scip::ObjSepa {
+public:
+	static constexpr int min_priority = -536870912;
+	static constexpr int every_node = 1;
+	static constexpr double no_maxbounddist = 1.0;
+
+	ReverseSepa(SCIP* scip, std::weak_ptr<utility::Controller::Executor> /*weak_executor_*/);
+
+	auto scip_execlp(SCIP* scip, SCIP_SEPA* sepa, SCIP_RESULT* result, SCIP_Bool allowlocal) -> SCIP_RETCODE override;
+
+private:
+	std::weak_ptr<utility::Controller::Executor> weak_executor;
+};
+
+/***************************************
+ *  Declaration of the BoundEventhdlr  *
+ ***************************************/
+
+/**
+ * Event handler updating a bound tracker.
+ *
+ * It is included with the SCIP model, when plugins can still be included, but only catches events once a tracker is
+ * given, which can be done in any stage.
+ */
+class BoundEventhdlr : public ::scip::ObjEventhdlr {
+public:
+	static constexpr char const* name = "ecole::BoundEventhdlr";
+	static constexpr SCIP_EVENTTYPE event_type =
+		SCIP_EVENTTYPE_BESTSOLFOUND | SCIP_EVENTTYPE_NODESOLVED | SCIP_EVENTTYPE_LPSOLVED;
+
+	BoundEventhdlr(SCIP* scip);
+
+	/** Start updating the tracker, catching events now if the problem is already transformed. */
+	auto track(SCIP* scip, std::shared_ptr<BoundTracker> tracker_) -> SCIP_RETCODE;
+
+	auto scip_init(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) -> SCIP_RETCODE override;
+	auto scip_exit(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) -> SCIP_RETCODE override;
+	auto scip_exec(SCIP* scip, SCIP_EVENTHDLR* eventhdlr, SCIP_EVENT* event, SCIP_EVENTDATA* eventdata)
+		-> SCIP_RETCODE override;
+
+private:
+	std::shared_ptr<BoundTracker> tracker = nullptr;
+	bool catching = false;
+};
+
 }  // namespace
 
 /****************************
@@ -65,11 +160,24 @@ static std::unique_ptr<SCIP, ScipDeleter> copy_orig(SCIP const* const source) {
 	return dest;
 }
 
+/** Include the BoundEventhdlr, as long as plugins can be included. */
+static void include_bound_eventhdlr(SCIP* scip_ptr) {
+	auto const stage = SCIPgetStage(scip_ptr);
+	if ((stage == SCIP_STAGE_INIT) || (stage == SCIP_STAGE_PROBLEM)) {
+		scip::call(SCIPincludeObjEventhdlr, scip_ptr, new BoundEventhdlr(scip_ptr), true);  // NOLINT
+	}
+}
+
 scip::Scimpl::Scimpl() : m_scip(create_scip()) {
 	scip::call(SCIPincludeDefaultPlugins, get_scip_ptr());
+	include_bound_eventhdlr(get_scip_ptr());
 }
 
-Scimpl::Scimpl(std::unique_ptr<SCIP, ScipDeleter>&& scip_ptr) noexcept : m_scip(std::move(scip_ptr)) {}
+Scimpl::Scimpl(std::unique_ptr<SCIP, ScipDeleter>&& scip_ptr) : m_scip(std::move(scip_ptr)) {
+	if (m_scip != nullptr) {
+		include_bound_eventhdlr(get_scip_ptr());
+	}
+}
 
 SCIP* scip::Scimpl::get_scip_ptr() noexcept {
 	return m_scip.get();
@@ -80,6 +188,7 @@ scip::Scimpl scip::Scimpl::copy_orig() {
 }
 
 void Scimpl::solve_iter() {
+	ECOLE_TIME_SCOPE(instrumentation::Stage::solve);
 	auto* const scip_ptr = get_scip_ptr();
 	m_controller =
 		std::make_unique<utility::Controller>([scip_ptr](std::weak_ptr<utility::Controller::Executor> weak_executor) {
@@ -95,6 +204,7 @@ void Scimpl::solve_iter() {
 }
 
 void scip::Scimpl::solve_iter_branch(SCIP_VAR* var) {
+	ECOLE_TIME_SCOPE(instrumentation::Stage::solve);
 	m_controller->resume_thread([var](SCIP* scip_ptr, SCIP_RESULT* result) {
 		if (var == nullptr) {
 			*result = SCIP_DIDNOTRUN;
@@ -107,6 +217,99 @@ void scip::Scimpl::solve_iter_branch(SCIP_VAR* var) {
 	m_controller->wait_thread();
 }
 
+void Scimpl::solve_iter_nodesel() {
+	ECOLE_TIME_SCOPE(instrumentation::Stage::solve);
+	auto* const scip_ptr = get_scip_ptr();
+	m_controller =
+		std::make_unique<utility::Controller>([scip_ptr](std::weak_ptr<utility::Controller::Executor> weak_executor) {
+			scip::call(
+				SCIPincludeObjNodesel,
+				scip_ptr,
+				new ReverseNodesel(scip_ptr, std::move(weak_executor)),  // NOLINT
+				true);
+			scip::call(SCIPsolve, scip_ptr);  // NOLINT
+		});
+
+	m_controller->wait_thread();
+}
+
+void scip::Scimpl::solve_iter_select_node(SCIP_NODE* node) {
+	ECOLE_TIME_SCOPE(instrumentation::Stage::solve);
+	m_controller->resume_thread([node](SCIP* scip_ptr, SCIP_RESULT* result) {
+		auto* const nodesel = static_cast<ReverseNodesel*>(SCIPfindObjNodesel(scip_ptr, ReverseNodesel::name));
+		nodesel->selected_node = node;
+		*result = (node == nullptr) ? SCIP_DIDNOTRUN : SCIP_SUCCESS;
+		return SCIP_OKAY;
+	});
+	m_controller->wait_thread();
+}
+
+void Scimpl::solve_iter_heur(int freq) {
+	ECOLE_TIME_SCOPE(instrumentation::Stage::solve);
+	auto* const scip_ptr = get_scip_ptr();
+	m_controller =
+		std::make_unique<utility::Controller>([scip_ptr, freq](std::weak_ptr<utility::Controller::Executor> weak_executor) {
+			scip::call(
+				SCIPincludeObjHeur,
+				scip_ptr,
+				new ReverseHeur(scip_ptr, freq, std::move(weak_executor)),  // NOLINT
+				true);
+			scip::call(SCIPsolve, scip_ptr);  // NOLINT
+		});
+
+	m_controller->wait_thread();
+}
+
+void scip::Scimpl::solve_iter_continue() {
+	ECOLE_TIME_SCOPE(instrumentation::Stage::solve);
+	m_controller->resume_thread([](SCIP* /*scip_ptr*/, SCIP_RESULT* result) {
+		*result = SCIP_DIDNOTRUN;
+		return SCIP_OKAY;
+	});
+	m_controller->wait_thread();
+}
+
+void Scimpl::solve_iter_sepa() {
+	ECOLE_TIME_SCOPE(instrumentation::Stage::solve);
+	auto* const scip_ptr = get_scip_ptr();
+	m_controller =
+		std::make_unique<utility::Controller>([scip_ptr](std::weak_ptr<utility::Controller::Executor> weak_executor) {
+			scip::call(
+				SCIPincludeObjSepa,
+				scip_ptr,
+				new ReverseSepa(scip_ptr, std::move(weak_executor)),  // NOLINT
+				true);
+			scip::call(SCIPsolve, scip_ptr);  // NOLINT
+		});
+
+	m_controller->wait_thread();
+}
+
+void scip::Scimpl::solve_iter_select_cuts(std::vector<SCIP_ROW*> cuts) {
+	ECOLE_TIME_SCOPE(instrumentation::Stage::solve);
+	m_controller->resume_thread([cuts = std::move(cuts)](SCIP* scip_ptr, SCIP_RESULT* result) {
+		// Cuts are owned by the separation storage, they must outlive its clearing
+		for (auto* const cut : cuts) {
+			SCIP_CALL(SCIPcaptureRow(scip_ptr, cut));
+		}
+		SCIP_CALL(SCIPclearCuts(scip_ptr));
+		auto infeasible = SCIP_Bool{false};
+		for (auto* cut : cuts) {
+			if (!infeasible) {
+				SCIP_CALL(SCIPaddRow(scip_ptr, cut, true, &infeasible));
+			}
+			SCIP_CALL(SCIPreleaseRow(scip_ptr, &cut));
+		}
+		if (infeasible) {
+			*result = SCIP_CUTOFF;
+		} else {
+			*result = cuts.empty() ? SCIP_DIDNOTFIND : SCIP_SEPARATED;
+		}
+		return SCIP_OKAY;
+	});
+	m_controller->wait_thread();
+}
+
 void scip::Scimpl::solve_iter_stop() {
 	m_controller = nullptr;
 }
@@ -115,6 +318,44 @@ bool scip::Scimpl::solve_iter_is_done() {
 	return !(m_controller) || m_controller->is_done();
 }
 
+void Scimpl::track_bounds() {
+	if (m_bound_tracker != nullptr) {
+		return;
+	}
+	auto* const scip_ptr = get_scip_ptr();
+	auto* const eventhdlr = static_cast<BoundEventhdlr*>(SCIPfindObjEventhdlr(scip_ptr, BoundEventhdlr::name));
+	if (eventhdlr == nullptr) {
+		throw Exception("Bounds cannot be tracked on a model created after its problem stage");
+	}
+	auto tracker =
+		std::make_shared<BoundTracker>(SCIPinfinity(scip_ptr), SCIPgetObjsense(scip_ptr) == SCIP_OBJSENSE_MINIMIZE);
+	// Tracking started after transformation, e.g. on a presolved model, starts from the current bounds
+	auto const stage = SCIPgetStage(scip_ptr);
+	if ((stage >= SCIP_STAGE_TRANSFORMED) && (stage <= SCIP_STAGE_SOLVED)) {
+		tracker->seed(SCIPgetPrimalbound(scip_ptr), SCIPgetDualbound(scip_ptr), SCIPgetSolvingTime(scip_ptr));
+	}
+	scip::call([&] { return eventhdlr->track(scip_ptr, tracker); });
+	m_bound_tracker = std::move(tracker);
+}
+
+void Scimpl::update_bound_tracker() {
+	auto* const scip_ptr = get_scip_ptr();
+	auto const stage = SCIPgetStage(scip_ptr);
+	if ((m_bound_tracker != nullptr) && (stage >= SCIP_STAGE_TRANSFORMED) && (stage <= SCIP_STAGE_SOLVED)) {
+		m_bound_tracker->update(SCIPgetPrimalbound(scip_ptr), SCIPgetDualbound(scip_ptr), SCIPgetSolvingTime(scip_ptr));
+	}
+}
+
+LpSnapshot const& Scimpl::lp_snapshot() {
+	auto* const scip = get_scip_ptr();
+	auto const lk = std::lock_guard{*m_lp_snapshot_mutex};
+	if (m_lp_snapshot.key != LpSnapshot::current_key(scip)) {
+		ECOLE_TRACE_SCOPE("lp_snapshot");
+		m_lp_snapshot.gather(scip);
+	}
+	return m_lp_snapshot;
+}
+
 /*************************************
  *  Definition of ReverseBranchrule  *
  *************************************/
@@ -133,6 +374,75 @@ scip::ReverseBranchrule::ReverseBranchrule(SCIP* scip, std::weak_ptr<utility::Co
 
 auto ReverseBranchrule::scip_execlp(SCIP* scip, SCIP_BRANCHRULE* /*branchrule*/, SCIP_Bool, SCIP_RESULT* result)
 	-> SCIP_RETCODE {
+	ECOLE_TRACE_SCOPE("ReverseBranchrule::scip_execlp");
+	if (weak_executor.expired()) {
+		*result = SCIP_DIDNOTRUN;
+		return SCIP_OKAY;
+	}
+	auto action_func = weak_executor.lock()->hold_env();
+	return action_func(scip, result);
+}
+
+/**********************************
+ *  Definition of ReverseNodesel  *
+ **********************************/
+
+ReverseNodesel::ReverseNodesel(SCIP* scip, std::weak_ptr<utility::Controller::Executor> weak_executor_) :
+	::scip::ObjNodesel(
+		scip,
+		ReverseNodesel::name,
+		"Node selector that wait for another thread to select the node.",
+		ReverseNodesel::max_priority,
+		ReverseNodesel::max_priority),
+	weak_executor(std::move(weak_executor_)) {}
+
+auto ReverseNodesel::scip_select(SCIP* scip, SCIP_NODESEL* /*nodesel*/, SCIP_NODE** selnode) -> SCIP_RETCODE {
+	ECOLE_TRACE_SCOPE("ReverseNodesel::scip_select");
+	selected_node = nullptr;
+	// Nothing to ask when the tree is empty
+	if (!weak_executor.expired() && (SCIPgetNNodesLeft(scip) > 0)) {
+		auto action_func = weak_executor.lock()->hold_env();
+		auto result = SCIP_DIDNOTRUN;
+		SCIP_CALL(action_func(scip, &result));
+	}
+	// Fallback when no node was given (e.g. when the solve is being interrupted)
+	*selnode = (selected_node != nullptr) ? selected_node : SCIPgetBestboundNode(scip);
+	return SCIP_OKAY;
+}
+
+auto ReverseNodesel::scip_comp(SCIP* /*scip*/, SCIP_NODESEL* /*nodesel*/, SCIP_NODE* node1, SCIP_NODE* node2) -> int {
+	auto const lower_bound1 = SCIPnodeGetLowerbound(node1);
+	auto const lower_bound2 = SCIPnodeGetLowerbound(node2);
+	if (lower_bound1 < lower_bound2) {
+		return -1;
+	}
+	if (lower_bound1 > lower_bound2) {
+		return 1;
+	}
+	return 0;
+}
+
+/*******************************
+ *  Definition of ReverseHeur  *
+ *******************************/
+
+ReverseHeur::ReverseHeur(SCIP* scip, int freq, std::weak_ptr<utility::Controller::Executor> weak_executor_) :
+	::scip::ObjHeur(
+		scip,
+		"ecole::ReverseHeur",
+		"Primal heuristic that wait for another thread to schedule the other heuristics.",
+		ReverseHeur::dispchar,
+		ReverseHeur::max_priority,
+		freq,
+		0,
+		ReverseHeur::no_maxdepth,
+		SCIP_HEURTIMING_BEFORENODE,
+		false),
+	weak_executor(std::move(weak_executor_)) {}
+
+auto ReverseHeur::scip_exec(SCIP* scip, SCIP_HEUR* /*heur*/, SCIP_HEURTIMING, SCIP_Bool, SCIP_RESULT* result)
+	-> SCIP_RETCODE {
+	ECOLE_TRACE_SCOPE("ReverseHeur::scip_exec");
 	if (weak_executor.expired()) {
 		*result = SCIP_DIDNOTRUN;
 		return SCIP_OKAY;
@@ -141,5 +451,78 @@ auto ReverseBranchrule::scip_execlp(SCIP* scip, SCIP_BRANCHRULE* /*branchrule*/,
 	return action_func(scip, result);
 }
 
+/*******************************
+ *  Definition of ReverseSepa  *
+ *******************************/
+
+ReverseSepa::ReverseSepa(SCIP* scip, std::weak_ptr<utility::Controller::Executor> weak_executor_) :
+	::scip::ObjSepa(
+		scip,
+		"ecole::ReverseSepa",
+		"Separator that wait for another thread to select the cuts found by the other separators.",
+		ReverseSepa::min_priority,
+		ReverseSepa::every_node,
+		ReverseSepa::no_maxbounddist,
+		false,
+		false),
+	weak_executor(std::move(weak_executor_)) {}
+
+auto ReverseSepa::scip_execlp(SCIP* scip, SCIP_SEPA* /*sepa*/, SCIP_RESULT* result, SCIP_Bool /*allowlocal*/)
+	-> SCIP_RETCODE {
+	ECOLE_TRACE_SCOPE("ReverseSepa::scip_execlp");
+	// Only pause when there are cuts to select
+	if (weak_executor.expired() || (SCIPgetNCuts(scip) == 0)) {
+		*result = SCIP_DIDNOTRUN;
+		return SCIP_OKAY;
+	}
+	auto action_func = weak_executor.lock()->hold_env();
+	return action_func(scip, result);
+}
+
+/**********************************
+ *  Definition of BoundEventhdlr  *
+ **********************************/
+
+BoundEventhdlr::BoundEventhdlr(SCIP* scip) :
+	::scip::ObjEventhdlr(scip, name, "Event handler tracking the primal and dual bounds.") {}
+
+auto BoundEventhdlr::track(SCIP* scip, std::shared_ptr<BoundTracker> tracker_) -> SCIP_RETCODE {
+	tracker = std::move(tracker_);
+	auto const stage = SCIPgetStage(scip);
+	if (catching || (stage < SCIP_STAGE_TRANSFORMED) || (stage > SCIP_STAGE_SOLVED)) {
+		// Events are caught when the problem is transformed
+		return SCIP_OKAY;
+	}
+	SCIP_CALL(SCIPcatchEvent(scip, event_type, SCIPfindEventhdlr(scip, name), nullptr, nullptr));
+	catching = true;
+	return SCIP_OKAY;
+}
+
+auto BoundEventhdlr::scip_init(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) -> SCIP_RETCODE {
+	if ((tracker == nullptr) || catching) {
+		return SCIP_OKAY;
+	}
+	SCIP_CALL(SCIPcatchEvent(scip, event_type, eventhdlr, nullptr, nullptr));
+	catching = true;
+	return SCIP_OKAY;
+}
+
+auto BoundEventhdlr::scip_exit(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) -> SCIP_RETCODE {
+	if (!catching) {
+		return SCIP_OKAY;
+	}
+	catching = false;
+	return SCIPdropEvent(scip, event_type, eventhdlr, nullptr, -1);
+}
+
+auto BoundEventhdlr::scip_exec(
+	SCIP* scip,
+	SCIP_EVENTHDLR* /*eventhdlr*/,
+	SCIP_EVENT* /*event*/,
+	SCIP_EVENTDATA* /*eventdata*/) -> SCIP_RETCODE {
+	tracker->update(SCIPgetPrimalbound(scip), SCIPgetDualbound(scip), SCIPgetSolvingTime(scip));
+	return SCIP_OKAY;
+}
+
 }  // namespace
 }  // namespace ecole::scip
@@ -14,4 +14,22 @@ template <typename Func, typename... Arguments> inline void call(Func func, Argu
 	}
 }
 
+/**
+ * Ask SCIP to stop solving at the next possible point, if it is presolving or solving.
+ *
+ * Only sets a flag that is checked by SCIP, hence it can be called from another thread.
+ */
+inline void interrupt_solve(SCIP* scip) noexcept {
+	switch (SCIPgetStage(scip)) {
+	case SCIP_STAGE_PRESOLVING:
+	case SCIP_STAGE_PRESOLVED:
+	case SCIP_STAGE_SOLVING:
+		// Only sets a flag that is checked by SCIP, there is nothing to recover from
+		SCIPinterruptSolve(scip);
+		break;
+	default:
+		break;
+	}
+}
+
 }  // namespace ecole::scip
@@ -0,0 +1,25 @@
+#include "ecole/scip/var.hpp"
+
+#include "scip/utils.hpp"
+
+namespace ecole::scip {
+
+void VarReleaser::operator()(Var* ptr) {
+	scip::call(SCIPreleaseVar, scip, &ptr);
+}
+
+auto create_var_basic(SCIP* scip, std::string const& name, real lb, real ub, real obj, SCIP_VARTYPE vtype)
+	-> unique_var {
+	Var* var = nullptr;
+	scip::call(SCIPcreateVarBasic, scip, &var, name.c_str(), lb, ub, obj, vtype);
+	return {var, VarReleaser{scip}};
+}
+
+auto add_var_basic(SCIP* scip, std::string const& name, real lb, real ub, real obj, SCIP_VARTYPE vtype)
+	-> unique_var {
+	auto var = create_var_basic(scip, name, lb, ub, obj, vtype);
+	scip::call(SCIPaddVar, scip, var.get());
+	return var;
+}
+
+}  // namespace ecole::scip
@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <utility>
+
+#include "ecole/scip/watchdog.hpp"
+
+#include "scip/utils.hpp"
+
+namespace ecole::scip {
+
+/********************************
+ *  Implementation of Watchdog  *
+ ********************************/
+
+Watchdog::Deadline::Deadline(Watchdog* watchdog_, std::shared_ptr<Entry> entry_) noexcept :
+	watchdog{watchdog_}, entry{std::move(entry_)} {}
+
+Watchdog::Deadline::~Deadline() {
+	// Moved from handles have no entry
+	if (entry != nullptr) {
+		watchdog->unwatch(entry.get());
+	}
+}
+
+bool Watchdog::Deadline::expired() const noexcept {
+	// Moved from handles no longer watch anything
+	return (entry != nullptr) && entry->expired;
+}
+
+Watchdog::Watchdog() : monitor{[this] { run_monitor(); }} {}
+
+Watchdog::~Watchdog() {
+	{
+		auto const lk = std::lock_guard{mutex};
+		stopping = true;
+	}
+	cv.notify_all();
+	monitor.join();
+}
+
+auto Watchdog::watch(Model const& model, Clock::duration time_limit) -> Deadline {
+	auto entry = std::make_shared<Deadline::Entry>();
+	entry->scip = model.get_scip_ptr();
+	entry->deadline = Clock::now() + time_limit;
+	{
+		auto const lk = std::lock_guard{mutex};
+		entries.push_back(entry);
+	}
+	// The monitor may need to wake up earlier than planned
+	cv.notify_all();
+	return {this, std::move(entry)};
+}
+
+void Watchdog::unwatch(Deadline::Entry const* entry) {
+	// Under the lock, so that the monitor never interrupts a model that is not watched anymore
+	auto const lk = std::lock_guard{mutex};
+	auto const iter = std::find_if(entries.begin(), entries.end(), [entry](auto const& e) { return e.get() == entry; });
+	if (iter != entries.end()) {
+		entries.erase(iter);
+	}
+}
+
+void Watchdog::run_monitor() {
+	auto lk = std::unique_lock{mutex};
+	while (!stopping) {
+		auto const now = Clock::now();
+		auto wake_up = Clock::time_point::max();
+		for (auto const& entry : entries) {
+			if (now >= entry->deadline) {
+				// Interrupted on every poll, as the model may not be interruptible yet (e.g. still being reset)
+				entry->expired = true;
+				interrupt_solve(entry->scip);
+				wake_up = std::min(wake_up, now + poll_interval);
+			} else {
+				wake_up = std::min(wake_up, entry->deadline);
+			}
+		}
+		if (wake_up == Clock::time_point::max()) {
+			cv.wait(lk);
+		} else {
+			cv.wait_until(lk, wake_up);
+		}
+	}
+}
+
+}  // namespace ecole::scip
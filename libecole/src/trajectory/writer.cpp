@@ -0,0 +1,301 @@
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/format.h>
+#include <xtensor/xadapt.hpp>
+#include <xtensor/xmanipulation.hpp>
+
+#include "ecole/exception.hpp"
+#include "ecole/trajectory/writer.hpp"
+
+namespace ecole::trajectory {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+auto constexpr chunk_prefix = std::string_view{"chunk-"};
+auto constexpr tmp_suffix = std::string_view{".tmp"};
+
+template <typename T> char const* npy_descr() {
+	static_assert(sizeof(T) == 8, "Only 64 bits types are supported");  // NOLINT(readability-magic-numbers)
+	if constexpr (std::is_floating_point_v<T>) {
+		return "<f8";
+	} else if constexpr (std::is_signed_v<T>) {
+		return "<i8";
+	} else {
+		return "<u8";
+	}
+}
+
+/**
+ * Write a contiguous array in the NumPy ``.npy`` format (version 1.0).
+ */
+template <typename T> void write_npy(fs::path const& path, std::vector<std::size_t> const& shape, T const* data) {
+	auto shape_str = std::string{};
+	for (auto const dim : shape) {
+		shape_str += fmt::format("{},", dim);
+	}
+	if (shape.size() > 1) {
+		shape_str.pop_back();
+	}
+	auto header = fmt::format("{{'descr': '{}', 'fortran_order': False, 'shape': ({}), }}", npy_descr<T>(), shape_str);
+	// Magic string (6), version (2), and header length (2) followed by the header, aligned on 64 bytes
+	auto constexpr preamble_size = std::size_t{10};
+	auto constexpr alignment = std::size_t{64};
+	auto const total_size = ((preamble_size + header.size() + 1 + alignment - 1) / alignment) * alignment;
+	header.append(total_size - preamble_size - header.size() - 1, ' ');
+	header.push_back('\n');
+
+	auto file = std::ofstream{path, std::ios::binary};
+	if (!file) {
+		throw Exception(fmt::format("Could not open file {}", path.string()));
+	}
+	auto const header_size = static_cast<std::uint16_t>(header.size());
+	char const preamble[preamble_size] = {  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+		'\x93',
+		'N',
+		'U',
+		'M',
+		'P',
+		'Y',
+		1,
+		0,
+		static_cast<char>(header_size & 0xFFU),  // NOLINT(readability-magic-numbers)
+		static_cast<char>(header_size >> 8U),  // NOLINT(readability-magic-numbers)
+	};
+	file.write(preamble, preamble_size);
+	file << header;
+	auto n_elements = std::size_t{1};
+	for (auto const dim : shape) {
+		n_elements *= dim;
+	}
+	// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) writing raw bytes
+	file.write(reinterpret_cast<char const*>(data), static_cast<std::streamsize>(n_elements * sizeof(T)));
+	if (!file) {
+		throw Exception(fmt::format("Error while writing file {}", path.string()));
+	}
+}
+
+std::size_t find_next_chunk_id(fs::path const& directory) {
+	auto next_id = std::size_t{0};
+	for (auto const& entry : fs::directory_iterator{directory}) {
+		auto const name = entry.path().filename().string();
+		if (!entry.is_directory() || (name.rfind(chunk_prefix, 0) != 0)) {
+			continue;
+		}
+		// Temporary chunks and other directories whose suffix is not a number are skipped
+		auto const suffix = std::string_view{name}.substr(chunk_prefix.size());
+		auto const* const suffix_end = suffix.data() + suffix.size();
+		auto id = std::size_t{0};
+		auto const [parse_end, parse_error] = std::from_chars(suffix.data(), suffix_end, id);
+		if ((parse_error == std::errc{}) && (parse_end == suffix_end)) {
+			next_id = std::max(next_id, id + 1);
+		}
+	}
+	return next_id;
+}
+
+template <typename T> std::vector<std::size_t> trailing_shape_of(xt::xarray<T> const& array) {
+	auto const& shape = array.shape();
+	if (shape.empty()) {
+		return {};
+	}
+	return {shape.begin() + 1, shape.end()};
+}
+
+}  // namespace
+
+void add_columns(Record& record, std::string const& name, utility::coo_matrix<double> const& matrix) {
+	record[name + ".values"] = xt::xarray<double>(matrix.values);
+	record[name + ".indices"] = xt::xarray<std::size_t>(xt::transpose(matrix.indices));
+	record[name + ".shape"] = xt::xarray<std::size_t>(xt::adapt(matrix.shape));
+}
+
+void add_columns(Record& record, std::string const& name, observation::NodeBipartiteObs const& obs) {
+	record[name + ".column_features"] = xt::xarray<double>(obs.column_features);
+	record[name + ".row_features"] = xt::xarray<double>(obs.row_features);
+	add_columns(record, name + ".edge_features", obs.edge_features);
+}
+
+/****************************************
+ *  Implementation of TrajectoryWriter  *
+ ****************************************/
+
+TrajectoryWriter::TrajectoryWriter(std::string directory_, Options options_) :
+	the_directory{std::move(directory_)}, options{options_} {
+	if (options.chunk_size == 0 || options.queue_size == 0) {
+		throw Exception("The chunk and queue sizes of the trajectory writer must be at least one");
+	}
+	fs::create_directories(the_directory);
+	next_chunk_id = find_next_chunk_id(the_directory);
+	worker = std::thread{[this] { run_worker(); }};
+}
+
+TrajectoryWriter::~TrajectoryWriter() {
+	{
+		auto const lk = std::lock_guard{mutex};
+		stopping = true;
+	}
+	queue_cv.notify_all();
+	worker.join();
+}
+
+void TrajectoryWriter::write(Record record) {
+	auto lk = std::unique_lock{mutex};
+	queue_cv.wait(lk, [this] { return (records.size() < options.queue_size) || error; });
+	rethrow_error();
+	records.emplace(std::move(record));
+	lk.unlock();
+	queue_cv.notify_all();
+}
+
+void TrajectoryWriter::flush() {
+	auto lk = std::unique_lock{mutex};
+	records.emplace(std::nullopt);
+	auto const ticket = ++n_flush_requested;
+	queue_cv.notify_all();
+	queue_cv.wait(lk, [this, ticket] { return n_flush_done >= ticket; });
+	rethrow_error();
+}
+
+void TrajectoryWriter::rethrow_error() {
+	if (error) {
+		std::rethrow_exception(std::exchange(error, nullptr));
+	}
+}
+
+void TrajectoryWriter::run_worker() {
+	while (true) {
+		auto record = std::optional<Record>{};
+		{
+			auto lk = std::unique_lock{mutex};
+			queue_cv.wait(lk, [this] { return stopping || !records.empty(); });
+			if (records.empty()) {
+				break;
+			}
+			record = std::move(records.front());
+			records.pop();
+		}
+		// Room in the queue for writers
+		queue_cv.notify_all();
+
+		auto const is_flush = !record.has_value();
+		try {
+			if (is_flush) {
+				write_chunk();
+			} else {
+				append(record.value());
+				if (chunk_n_steps >= options.chunk_size) {
+					write_chunk();
+				}
+			}
+		} catch (...) {
+			auto const lk = std::lock_guard{mutex};
+			error = std::current_exception();
+		}
+
+		if (is_flush) {
+			{
+				auto const lk = std::lock_guard{mutex};
+				++n_flush_done;
+			}
+			queue_cv.notify_all();
+		}
+	}
+
+	// Errors cannot be reported in the destructor
+	try {
+		write_chunk();
+	} catch (...) {
+	}
+}
+
+void TrajectoryWriter::append(Record const& record) {
+	if (chunk_n_steps == 0) {
+		for (auto const& [name, column] : record) {
+			auto& buffer = chunk[name];
+			std::visit(
+				[&buffer](auto const& array) {
+					using value_type = typename std::decay_t<decltype(array)>::value_type;
+					buffer.data = std::vector<value_type>{};
+					buffer.trailing_shape = trailing_shape_of(array);
+					buffer.scalar = array.dimension() == 0;
+					buffer.offsets = {0};
+				},
+				column);
+		}
+	} else if (record.size() != chunk.size()) {
+		throw Exception(fmt::format("Record has {} columns but the chunk has {}", record.size(), chunk.size()));
+	}
+
+	// Check everything before modifying the chunk
+	for (auto const& [name, column] : record) {
+		auto const iter = chunk.find(name);
+		if (iter == chunk.end()) {
+			throw Exception(fmt::format("Record has an unknown column '{}'", name));
+		}
+		auto const& buffer = iter->second;
+		auto const valid = std::visit(
+			[&buffer](auto const& array) {
+				using value_type = typename std::decay_t<decltype(array)>::value_type;
+				return std::holds_alternative<std::vector<value_type>>(buffer.data) &&
+							 (buffer.scalar == (array.dimension() == 0)) && (buffer.trailing_shape == trailing_shape_of(array));
+			},
+			column);
+		if (!valid) {
+			throw Exception(fmt::format("Column '{}' does not have the type and shape of previous records", name));
+		}
+	}
+
+	for (auto const& [name, column] : record) {
+		auto& buffer = chunk[name];
+		std::visit(
+			[&buffer](auto const& array) {
+				using value_type = typename std::decay_t<decltype(array)>::value_type;
+				auto& data = std::get<std::vector<value_type>>(buffer.data);
+				data.insert(data.end(), array.data(), array.data() + array.size());
+				auto const n_rows = buffer.scalar ? std::size_t{1} : array.shape()[0];
+				buffer.offsets.push_back(buffer.offsets.back() + n_rows);
+			},
+			column);
+	}
+	++chunk_n_steps;
+}
+
+void TrajectoryWriter::write_chunk() {
+	if (chunk_n_steps == 0) {
+		return;
+	}
+
+	// Written under a temporary name so that readers never see incomplete chunks
+	auto const chunk_name = fmt::format("{}{:06d}", chunk_prefix, next_chunk_id);
+	auto const final_path = fs::path{the_directory} / chunk_name;
+	auto const tmp_path = fs::path{the_directory} / (chunk_name + std::string{tmp_suffix});
+	auto const n_steps = std::exchange(chunk_n_steps, 0);
+	// The chunk is dropped even if writing fails, to not fail again on every following record
+	auto const columns = std::exchange(chunk, {});
+	++next_chunk_id;
+
+	fs::create_directories(tmp_path);
+	for (auto const& [name, buffer] : columns) {
+		auto shape = std::vector<std::size_t>{buffer.scalar ? n_steps : buffer.offsets.back()};
+		shape.insert(shape.end(), buffer.trailing_shape.begin(), buffer.trailing_shape.end());
+		auto const data_path = tmp_path / (name + ".npy");
+		std::visit([&data_path, &shape](auto const& data) { write_npy(data_path, shape, data.data()); }, buffer.data);
+		if (!buffer.scalar) {
+			write_npy(tmp_path / (name + ".offsets.npy"), {buffer.offsets.size()}, buffer.offsets.data());
+		}
+	}
+	fs::rename(tmp_path, final_path);
+}
+
+}  // namespace ecole::trajectory
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "ecole/exception.hpp"
+#include "ecole/random.hpp"
+
+namespace ecole::utility {
+
+/**
+ * Sample indices in [0, n_elements) uniformly, without replacement, in a random order.
+ *
+ * Uses Robert Floyd's algorithm so that the cost is in the number of samples rather than the number of elements.
+ */
+inline auto arg_choice(std::size_t n_samples, std::size_t n_elements, RandomEngine& random_engine)
+	-> std::vector<std::size_t> {
+	if (n_samples > n_elements) {
+		throw Exception("Cannot sample more elements than available without replacement");
+	}
+	auto samples = std::vector<std::size_t>{};
+	samples.reserve(n_samples);
+	auto selected = std::unordered_set<std::size_t>{};
+	selected.reserve(n_samples);
+	for (auto j = n_elements - n_samples; j < n_elements; ++j) {
+		auto const t = std::uniform_int_distribution<std::size_t>{0, j}(random_engine);
+		auto const choice = selected.count(t) == 0 ? t : j;
+		selected.insert(choice);
+		samples.push_back(choice);
+	}
+	std::shuffle(samples.begin(), samples.end(), random_engine);
+	return samples;
+}
+
+/**
+ * Sample indices with probability proportional to the given weights, without replacement.
+ */
+inline auto arg_choice(std::size_t n_samples, std::vector<double> weights, RandomEngine& random_engine)
+	-> std::vector<std::size_t> {
+	auto const n_non_zero = static_cast<std::size_t>(
+		std::count_if(weights.begin(), weights.end(), [](auto weight) { return weight > 0.; }));
+	if (n_samples > n_non_zero) {
+		throw Exception("Cannot sample more elements than available without replacement");
+	}
+	auto samples = std::vector<std::size_t>{};
+	samples.reserve(n_samples);
+	for (std::size_t i = 0; i < n_samples; ++i) {
+		auto const choice = std::discrete_distribution<std::size_t>{weights.begin(), weights.end()}(random_engine);
+		samples.push_back(choice);
+		weights[choice] = 0.;
+	}
+	return samples;
+}
+
+}  // namespace ecole::utility
@@ -11,6 +11,11 @@ namespace ecole::utility {
 auto Controller::Synchronizer::env_wait_thread() -> lock_t {
 	lock_t lk{model_mutex};
 	model_avail_cv.wait(lk, [this] { return !thread_owns_model; });
+#ifdef ECOLE_INSTRUMENTATION
+	instrumentation::record(
+		instrumentation::Stage::handoff,
+		(instrumentation::Clock::now() - handoff_start) + std::exchange(resume_latency, {}));
+#endif
 	lk = maybe_throw(std::move(lk));
 	return lk;
 }
@@ -19,6 +24,9 @@ auto Controller::Synchronizer::env_resume_thread(lock_t&& lk, action_func_t&& ne
 	assert(is_valid_lock(lk));
 	action_func = std::move(new_action_func);
 	thread_owns_model = true;
+#ifdef ECOLE_INSTRUMENTATION
+	handoff_start = instrumentation::Clock::now();
+#endif
 	lk.unlock();
 	model_avail_cv.notify_one();
 }
@@ -49,10 +57,16 @@ auto Controller::Synchronizer::thread_start() -> lock_t {
 auto Controller::Synchronizer::thread_hold_env(lock_t&& lk) -> lock_t {
 	assert(is_valid_lock(lk));
 	thread_owns_model = false;
+#ifdef ECOLE_INSTRUMENTATION
+	handoff_start = instrumentation::Clock::now();
+#endif
 	lk.unlock();
 	model_avail_cv.notify_one();
 	lk.lock();
 	model_avail_cv.wait(lk, [this] { return thread_owns_model; });
+#ifdef ECOLE_INSTRUMENTATION
+	resume_latency = instrumentation::Clock::now() - handoff_start;
+#endif
 	return std::move(lk);
 }
 
@@ -60,6 +74,9 @@ auto Controller::Synchronizer::thread_terminate(lock_t&& lk) -> void {
 	assert(is_valid_lock(lk));
 	thread_owns_model = false;
 	thread_finished = true;
+#ifdef ECOLE_INSTRUMENTATION
+	handoff_start = instrumentation::Clock::now();
+#endif
 	lk.unlock();
 	model_avail_cv.notify_one();
 }
@@ -103,6 +120,7 @@ auto Controller::Executor::start() -> void {
 }
 
 auto Controller::Executor::hold_env() -> action_func_t {
+	ECOLE_TRACE_SCOPE("Controller::hold_env");
 	model_lock = synchronizer->thread_hold_env(std::move(model_lock));
 	return synchronizer->thread_action_function(model_lock);
 }
@@ -133,10 +151,12 @@ Controller::~Controller() noexcept {
 }
 
 auto Controller::wait_thread() -> void {
+	ECOLE_TRACE_SCOPE("Controller::wait_thread");
 	model_lock = synchronizer->env_wait_thread();
 }
 
 auto Controller::resume_thread(action_func_t&& action_func) -> void {
+	ECOLE_TRACE_SCOPE("Controller::resume_thread");
 	synchronizer->env_resume_thread(std::move(model_lock), std::move(action_func));
 }
 
@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <utility>
+
+#include "ecole/utility/thread-pool.hpp"
+
+namespace ecole::utility {
+
+ThreadPool::ThreadPool(std::size_t n_threads) {
+	if (n_threads == 0) {
+		n_threads = std::max(std::thread::hardware_concurrency(), 1U);
+	}
+	workers.reserve(n_threads);
+	for (std::size_t i = 0; i < n_threads; ++i) {
+		workers.emplace_back([this] { run_worker(); });
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		auto const lk = std::lock_guard{tasks_mutex};
+		stopping = true;
+	}
+	tasks_cv.notify_all();
+	for (auto& worker : workers) {
+		worker.join();
+	}
+}
+
+auto ThreadPool::enqueue(std::function<void()>&& task) -> void {
+	{
+		auto const lk = std::lock_guard{tasks_mutex};
+		tasks.push(std::move(task));
+	}
+	tasks_cv.notify_one();
+}
+
+auto ThreadPool::run_worker() -> void {
+	while (true) {
+		auto task = std::function<void()>{};
+		{
+			auto lk = std::unique_lock{tasks_mutex};
+			tasks_cv.wait(lk, [this] { return stopping || !tasks.empty(); });
+			if (tasks.empty()) {
+				return;
+			}
+			task = std::move(tasks.front());
+			tasks.pop();
+		}
+		// Exceptions are captured by the std::packaged_task
+		task();
+	}
+}
+
+}  // namespace ecole::utility
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "ecole/utility/work-stealing.hpp"
+
+namespace ecole::utility {
+
+namespace {
+
+/** The tasks of one thread, taken from the front by their owner, and from the back by thieves. */
+struct TaskQueue {
+	std::mutex mutex;
+	std::deque<std::size_t> tasks;
+
+	std::optional<std::size_t> pop_front() {
+		auto const lk = std::lock_guard{mutex};
+		if (tasks.empty()) {
+			return {};
+		}
+		auto const task = tasks.front();
+		tasks.pop_front();
+		return task;
+	}
+
+	std::optional<std::size_t> pop_back() {
+		auto const lk = std::lock_guard{mutex};
+		if (tasks.empty()) {
+			return {};
+		}
+		auto const task = tasks.back();
+		tasks.pop_back();
+		return task;
+	}
+};
+
+}  // namespace
+
+void run_work_stealing(
+	std::size_t n_tasks,
+	std::size_t n_threads,
+	std::function<void(std::size_t task, std::size_t thread)> const& func) {
+	if (n_threads == 0) {
+		n_threads = std::max(std::thread::hardware_concurrency(), 1U);
+	}
+	n_threads = std::max(std::min(n_threads, n_tasks), std::size_t{1});
+
+	auto queues = std::vector<std::unique_ptr<TaskQueue>>{};
+	for (std::size_t i = 0; i < n_threads; ++i) {
+		auto queue = std::make_unique<TaskQueue>();
+		for (auto task = i * n_tasks / n_threads; task < (i + 1) * n_tasks / n_threads; ++task) {
+			queue->tasks.push_back(task);
+		}
+		queues.push_back(std::move(queue));
+	}
+
+	auto error_mutex = std::mutex{};
+	auto error = std::exception_ptr{};
+	auto failed = std::atomic<bool>{false};
+
+	auto const next_task = [&queues, n_threads](std::size_t thread) -> std::optional<std::size_t> {
+		if (auto task = queues[thread]->pop_front(); task.has_value()) {
+			return task;
+		}
+		// Tasks are never added, so a full pass without success means that all tasks are started
+		for (std::size_t offset = 1; offset < n_threads; ++offset) {
+			if (auto task = queues[(thread + offset) % n_threads]->pop_back(); task.has_value()) {
+				return task;
+			}
+		}
+		return {};
+	};
+
+	auto const run_thread = [&](std::size_t thread) {
+		while (!failed) {
+			auto const task = next_task(thread);
+			if (!task.has_value()) {
+				return;
+			}
+			try {
+				func(task.value(), thread);
+			} catch (...) {
+				auto const lk = std::lock_guard{error_mutex};
+				if (!error) {
+					error = std::current_exception();
+				}
+				failed = true;
+			}
+		}
+	};
+
+	auto threads = std::vector<std::thread>{};
+	threads.reserve(n_threads - 1);
+	for (std::size_t thread = 1; thread < n_threads; ++thread) {
+		threads.emplace_back(run_thread, thread);
+	}
+	// The calling thread also runs tasks
+	run_thread(0);
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
+
+}  // namespace ecole::utility
@@ -0,0 +1,125 @@
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+#include <xtensor/xmath.hpp>
+
+#include "ecole/data/parallel.hpp"
+#include "ecole/data/tuple.hpp"
+#include "ecole/observation/khalil-2016.hpp"
+#include "ecole/observation/nodebipartite.hpp"
+#include "ecole/observation/pseudocosts.hpp"
+#include "ecole/traits.hpp"
+
+#include "conftest.hpp"
+#include "data/mock-function.hpp"
+#include "data/unit-tests.hpp"
+
+using namespace ecole::data;
+
+namespace {
+
+/** Record the thread extracting, and the number of read-only extractions finished before it. */
+struct ThreadRecord {
+	std::thread::id thread;
+	int n_finished_before;
+};
+
+template <bool read_only_> struct RecordingFunction : DataFunction<ThreadRecord> {
+	static constexpr bool read_only = read_only_;
+
+	std::atomic<int>* n_finished = nullptr;
+
+	RecordingFunction() = default;
+	RecordingFunction(std::atomic<int>* n_finished_) : n_finished{n_finished_} {}
+
+	ThreadRecord extract(ecole::scip::Model& /* model */, bool /* done */) override {
+		auto const record = ThreadRecord{std::this_thread::get_id(), n_finished->load()};
+		if constexpr (read_only) {
+			std::this_thread::sleep_for(std::chrono::milliseconds{10});
+			++(*n_finished);
+		}
+		return record;
+	}
+};
+
+using ReadOnlyFunc = RecordingFunction<true>;
+using MutatingFunc = RecordingFunction<false>;
+
+struct ThrowingFunction : DataFunction<int> {
+	static constexpr bool read_only = true;
+
+	int extract(ecole::scip::Model& /* model */, bool /* done */) override { throw std::runtime_error{"extract"}; }
+};
+
+}  // namespace
+
+TEST_CASE("Data ParallelTupleFunction unit tests", "[unit][data]") {
+	ecole::data::unit_tests(ParallelTupleFunction{IntDataFunc{}, DoubleDataFunc{}});
+}
+
+TEST_CASE("Detect read-only data functions", "[data]") {
+	STATIC_REQUIRE(ecole::trait::is_read_only_data_function_v<ReadOnlyFunc>);
+	STATIC_REQUIRE_FALSE(ecole::trait::is_read_only_data_function_v<MutatingFunc>);
+	STATIC_REQUIRE_FALSE(ecole::trait::is_read_only_data_function_v<IntDataFunc>);
+	STATIC_REQUIRE(ecole::trait::is_read_only_data_function_v<ecole::observation::NodeBipartite>);
+	STATIC_REQUIRE_FALSE(ecole::trait::is_read_only_data_function_v<ecole::observation::StrongBranchingScores>);
+}
+
+TEST_CASE("Combine data functions into a tuple in parallel", "[data]") {
+	auto model = get_model();
+
+	SECTION("Data is the same as with a TupleFunction") {
+		auto data_func = ParallelTupleFunction{IntDataFunc{0}, DoubleDataFunc{1}};
+		data_func.before_reset(model);
+		advance_to_root_node(model);
+		auto const data = data_func.extract(model, false);
+		STATIC_REQUIRE(std::is_same_v<std::remove_const_t<decltype(data)>, std::tuple<int, double>>);
+		REQUIRE(std::get<0>(data) == 1);
+		REQUIRE(std::get<1>(data) == 2.0);  // NOLINT(readability-magic-numbers)
+	}
+
+	SECTION("Read-only functions run on other threads, in between other functions") {
+		auto n_finished = std::atomic<int>{0};
+		auto data_func = ParallelTupleFunction{
+			ReadOnlyFunc{&n_finished}, ReadOnlyFunc{&n_finished}, MutatingFunc{&n_finished}, ReadOnlyFunc{&n_finished}};
+		STATIC_REQUIRE(decltype(data_func)::n_read_only == 3);
+		data_func.before_reset(model);
+		advance_to_root_node(model);
+		auto const [first, second, mutating, last] = data_func.extract(model, false);
+		REQUIRE(first.thread != std::this_thread::get_id());
+		REQUIRE(second.thread != std::this_thread::get_id());
+		REQUIRE(last.thread != std::this_thread::get_id());
+		REQUIRE(mutating.thread == std::this_thread::get_id());
+		REQUIRE(mutating.n_finished_before == 2);
+		REQUIRE(last.n_finished_before == 2);
+	}
+
+	SECTION("Observations are the same as with a TupleFunction") {
+		using namespace ecole::observation;
+		auto parallel_func = ParallelTupleFunction{NodeBipartite{}, Pseudocosts{}, Khalil2016{}};
+		auto tuple_func = TupleFunction{NodeBipartite{}, Pseudocosts{}, Khalil2016{}};
+		parallel_func.before_reset(model);
+		tuple_func.before_reset(model);
+		advance_to_root_node(model);
+		auto const [bipartite, pseudocosts, khalil] = parallel_func.extract(model, false);
+		auto const [expected_bipartite, expected_pseudocosts, expected_khalil] = tuple_func.extract(model, false);
+		REQUIRE(bipartite.value().column_features == expected_bipartite.value().column_features);
+		REQUIRE(bipartite.value().row_features == expected_bipartite.value().row_features);
+		auto constexpr rtol = 1e-5;
+		auto constexpr atol = 1e-8;
+		REQUIRE(xt::all(xt::isclose(pseudocosts.value(), expected_pseudocosts.value(), rtol, atol, true)));
+		REQUIRE(xt::all(xt::isclose(khalil.value(), expected_khalil.value(), rtol, atol, true)));
+	}
+
+	SECTION("Exceptions are rethrown on the calling thread") {
+		auto n_finished = std::atomic<int>{0};
+		auto data_func = ParallelTupleFunction{ReadOnlyFunc{&n_finished}, ThrowingFunction{}};
+		advance_to_root_node(model);
+		REQUIRE_THROWS_AS(data_func.extract(model, false), std::runtime_error);
+		REQUIRE(n_finished == 1);
+	}
+}
@@ -1,9 +1,11 @@
+#include <algorithm>
+#include <set>
 #include <stdexcept>
 #include <tuple>
+#include <vector>
 
 #include <catch2/catch.hpp>
-#include <xtensor/xmath.hpp>
-#include <xtensor/xsort.hpp>
+#include <xtensor/xbuilder.hpp>
 
 #include "ecole/dynamics/branching.hpp"
 #include "ecole/exception.hpp"
@@ -31,12 +33,42 @@ TEST_CASE("BranchingDynamics functional tests", "[dynamics]") {
 	SECTION("Return valid action set") {
 		auto const [done, action_set] = dyn.reset_dynamics(model);
 		REQUIRE(action_set.has_value());
-		auto const& branch_cands = action_set.value();
+		auto const branch_cands = std::vector<std::size_t>(action_set.value().begin(), action_set.value().end());
+		auto const n_cols = model.lp_columns().size();
 		REQUIRE(branch_cands.size() > 0);
-		REQUIRE(branch_cands.size() < model.lp_columns().size());
-		REQUIRE(xt::all(branch_cands >= 0));
-		REQUIRE(xt::all(branch_cands < model.lp_columns().size()));
-		REQUIRE(xt::unique(branch_cands).size() == branch_cands.size());
+		REQUIRE(branch_cands.size() < n_cols);
+		REQUIRE(std::all_of(branch_cands.begin(), branch_cands.end(), [n_cols](auto col) { return col < n_cols; }));
+		REQUIRE(std::set<std::size_t>(branch_cands.begin(), branch_cands.end()).size() == branch_cands.size());
+	}
+
+	SECTION("Candidates are available as indices and mask") {
+		auto const [done, action_set] = dyn.reset_dynamics(model);
+		auto const branch_cands = action_set.value();
+		auto const indices = dyn.candidate_indices();
+		REQUIRE(indices.data() == branch_cands.data());
+		REQUIRE(indices.size() == branch_cands.size());
+		auto const mask = dyn.candidate_mask();
+		REQUIRE(mask.size() == model.lp_columns().size());
+		auto n_lp_cands = std::size_t{0};
+		for (auto const col : branch_cands) {
+			// Pseudo candidates may not be in the LP
+			if (col < mask.size()) {
+				REQUIRE(mask[col] == 1);
+				++n_lp_cands;
+			}
+		}
+		REQUIRE(static_cast<std::size_t>(std::count(mask.begin(), mask.end(), 1)) == n_lp_cands);
+	}
+
+	SECTION("Mask only holds the candidates of the last transition") {
+		auto [done, action_set] = dyn.reset_dynamics(model);
+		std::tie(done, action_set) = dyn.step_dynamics(model, action_set.value()[0]);
+		if (!done) {
+			auto const mask = dyn.candidate_mask();
+			auto const cands = action_set.value();
+			auto const n_lp_cands = std::count_if(cands.begin(), cands.end(), [&mask](auto col) { return col < mask.size(); });
+			REQUIRE(std::count(mask.begin(), mask.end(), 1) == n_lp_cands);
+		}
 	}
 
 	SECTION("Solve instance") {
@@ -78,3 +110,48 @@ TEST_CASE("BranchingDynamics handles limits", "[dynamics]") {
 		std::tie(done, action_set) = dyn.step_dynamics(model, action_set.value()[0]);
 	}
 }
+
+TEST_CASE("BatchedBranchingDynamics unit tests", "[unit][dynamics]") {
+	bool const pseudo_candidates = GENERATE(true, false);
+	auto const refresh_interval = GENERATE(std::size_t{0}, std::size_t{1}, std::size_t{4});
+	auto const policy = [](auto const& action_set) { return action_set.value(); };
+	dynamics::unit_tests(dynamics::BatchedBranchingDynamics{pseudo_candidates, refresh_interval}, policy);
+}
+
+TEST_CASE("BatchedBranchingDynamics functional tests", "[dynamics]") {
+	bool const pseudo_candidates = GENERATE(true, false);
+	auto const refresh_interval = std::size_t{4};
+	auto dyn = dynamics::BatchedBranchingDynamics{pseudo_candidates, refresh_interval};
+	auto model = get_model();
+
+	SECTION("Branch on many nodes per transition") {
+		auto [done, action_set] = dyn.reset_dynamics(model);
+		auto n_transitions = std::size_t{0};
+		auto n_branchings = std::size_t{0};
+		while (!done) {
+			REQUIRE(action_set.has_value());
+			// Rank all columns, so that every following node can be branched
+			auto const ranking = xt::arange<std::size_t>(model.lp_columns().size());
+			std::tie(done, action_set) = dyn.step_dynamics(model, ranking);
+			REQUIRE(dyn.n_last_branchings() >= 1);
+			REQUIRE(dyn.n_last_branchings() <= refresh_interval);
+			n_branchings += dyn.n_last_branchings();
+			++n_transitions;
+		}
+		REQUIRE(model.is_solved());
+		REQUIRE(n_branchings >= n_transitions);
+	}
+
+	SECTION("Throw when no ranked column is a candidate") {
+		auto const [done, action_set] = dyn.reset_dynamics(model);
+		REQUIRE_FALSE(done);
+		REQUIRE_THROWS_AS(dyn.step_dynamics(model, xt::xtensor<std::size_t, 1>::from_shape({0})), Exception);
+	}
+
+	SECTION("Throw on invalid branching variable") {
+		auto const [done, action_set] = dyn.reset_dynamics(model);
+		REQUIRE_FALSE(done);
+		auto const action = xt::xtensor<std::size_t, 1>{model.lp_columns().size() + 1};
+		REQUIRE_THROWS_AS(dyn.step_dynamics(model, action), Exception);
+	}
+}
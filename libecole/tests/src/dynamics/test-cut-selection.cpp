@@ -0,0 +1,56 @@
+#include <stdexcept>
+#include <tuple>
+
+#include <catch2/catch.hpp>
+#include <xtensor/xbuilder.hpp>
+
+#include "ecole/dynamics/cut-selection.hpp"
+#include "ecole/exception.hpp"
+
+#include "conftest.hpp"
+#include "dynamics/unit-tests.hpp"
+
+using namespace ecole;
+
+namespace {
+
+auto cut_mask(dynamics::CutSelectionDynamics::ActionSet const& action_set, bool value) {
+	return dynamics::CutSelectionDynamics::Action(xt::full_like(action_set.value(), value));
+}
+
+}  // namespace
+
+TEST_CASE("CutSelectionDynamics unit tests", "[unit][dynamics]") {
+	bool const select_all = GENERATE(true, false);
+	auto const policy = [select_all](auto const& action_set) { return cut_mask(action_set, select_all); };
+	dynamics::unit_tests(dynamics::CutSelectionDynamics{}, policy);
+}
+
+TEST_CASE("CutSelectionDynamics functional tests", "[dynamics]") {
+	auto dyn = dynamics::CutSelectionDynamics{};
+	auto model = get_model();
+
+	SECTION("Return valid action set") {
+		auto const [done, action_set] = dyn.reset_dynamics(model);
+		REQUIRE_FALSE(done);
+		REQUIRE(action_set.has_value());
+		REQUIRE(action_set.value().size() > 0);
+		REQUIRE(action_set.value().size() == model.cuts().size());
+	}
+
+	SECTION("Solve instance") {
+		auto [done, action_set] = dyn.reset_dynamics(model);
+		while (!done) {
+			REQUIRE(action_set.has_value());
+			std::tie(done, action_set) = dyn.step_dynamics(model, cut_mask(action_set, true));
+		}
+		REQUIRE(model.is_solved());
+	}
+
+	SECTION("Throw on invalid mask size") {
+		auto const [done, action_set] = dyn.reset_dynamics(model);
+		REQUIRE_FALSE(done);
+		auto const action = dynamics::CutSelectionDynamics::Action::from_shape({action_set.value().size() + 1});
+		REQUIRE_THROWS_AS(dyn.step_dynamics(model, action), Exception);
+	}
+}
@@ -0,0 +1,67 @@
+#include <stdexcept>
+#include <tuple>
+
+#include <catch2/catch.hpp>
+#include <xtensor/xsort.hpp>
+
+#include "ecole/dynamics/node-selection.hpp"
+#include "ecole/exception.hpp"
+
+#include "conftest.hpp"
+#include "dynamics/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("NodeSelectionDynamics unit tests", "[unit][dynamics]") {
+	bool const select_first = GENERATE(true, false);
+	auto const policy = [select_first](auto const& action_set) {
+		return select_first ? action_set.value()[0] : action_set.value()[action_set.value().size() - 1];
+	};
+	dynamics::unit_tests(dynamics::NodeSelectionDynamics{}, policy);
+}
+
+TEST_CASE("NodeSelectionDynamics functional tests", "[dynamics]") {
+	auto dyn = dynamics::NodeSelectionDynamics{};
+	auto model = get_model();
+
+	SECTION("Return valid action set") {
+		auto const [done, action_set] = dyn.reset_dynamics(model);
+		REQUIRE_FALSE(done);
+		REQUIRE(action_set.has_value());
+		auto const& node_indices = action_set.value();
+		REQUIRE(node_indices.size() > 0);
+		REQUIRE(node_indices.size() == dyn.open_nodes().size());
+		REQUIRE(xt::unique(node_indices).size() == node_indices.size());
+	}
+
+	SECTION("Solve instance") {
+		auto [done, action_set] = dyn.reset_dynamics(model);
+		while (!done) {
+			REQUIRE(action_set.has_value());
+			auto const n_nodes = action_set.value().size();
+			std::tie(done, action_set) = dyn.step_dynamics(model, action_set.value()[n_nodes - 1]);
+		}
+		REQUIRE(model.is_solved());
+	}
+
+	SECTION("Throw on invalid node index") {
+		auto const [done, action_set] = dyn.reset_dynamics(model);
+		REQUIRE_FALSE(done);
+		REQUIRE(action_set.has_value());
+		auto const action = action_set.value().size();
+		REQUIRE_THROWS_AS(dyn.step_dynamics(model, action), std::exception);
+	}
+}
+
+TEST_CASE("NodeSelectionDynamics handles limits", "[dynamics]") {
+	auto dyn = dynamics::NodeSelectionDynamics{};
+	auto model = get_model();
+	auto const node_limit = GENERATE(0, 1, 2);
+	model.set_param("limits/totalnodes", node_limit);
+
+	auto [done, action_set] = dyn.reset_dynamics(model);
+	while (!done) {
+		REQUIRE(action_set.has_value());
+		std::tie(done, action_set) = dyn.step_dynamics(model, action_set.value()[0]);
+	}
+}
@@ -0,0 +1,91 @@
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/dynamics/parallel-configuring.hpp"
+#include "ecole/environment/parallel-configuring.hpp"
+#include "ecole/exception.hpp"
+#include "ecole/reward/nnodes.hpp"
+#include "ecole/scip/param-set.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("ParallelConfiguringDynamics solves all models", "[dynamics]") {
+	auto dyn = dynamics::ParallelConfiguringDynamics{2};
+	auto models = std::vector<scip::Model>{};
+	auto model_ptrs = std::vector<scip::Model*>{};
+	for (auto i = 0; i < 3; ++i) {
+		models.push_back(get_model());
+	}
+	for (auto& model : models) {
+		model_ptrs.push_back(&model);
+	}
+	auto const param_sets = std::vector<scip::ParamSet>{
+		scip::ParamSet{{{"branching/scorefunc", 's'}}},
+		scip::ParamSet{{{"branching/scorefunc", 'p'}}},
+		scip::ParamSet{{{"branching/scorefunc", 'q'}}},
+	};
+
+	SECTION("Apply parameters and solve") {
+		auto const completed = dyn.solve_all(model_ptrs, param_sets);
+		REQUIRE(completed == std::vector<bool>{true, true, true});
+		for (auto const& model : models) {
+			REQUIRE(model.is_solved());
+		}
+		REQUIRE(models[1].get_param<char>("branching/scorefunc") == 'p');
+	}
+
+	SECTION("Call hooks for every run") {
+		auto before = std::vector<int>(3, 0);
+		auto after = std::vector<int>(3, 0);
+		dyn.solve_all(model_ptrs, param_sets, [&](auto i) { ++before[i]; }, [&](auto i) { ++after[i]; });
+		REQUIRE(before == std::vector<int>{1, 1, 1});
+		REQUIRE(after == std::vector<int>{1, 1, 1});
+	}
+
+	SECTION("Throw on mismatched sizes") {
+		model_ptrs.pop_back();
+		REQUIRE_THROWS_AS(dyn.solve_all(model_ptrs, param_sets), Exception);
+	}
+}
+
+TEST_CASE("ParallelConfiguringDynamics racing", "[dynamics][slow]") {
+	REQUIRE_THROWS_AS(dynamics::ParallelConfiguringDynamics(1, 0.5), Exception);
+
+	auto dyn = dynamics::ParallelConfiguringDynamics{2, 1.};
+	// An empty problem is solved almost instantly, long before the other run could complete
+	auto fast_model = scip::Model::prob_basic();
+	auto slow_model = get_model();
+	auto const param_sets = std::vector<scip::ParamSet>{
+		scip::ParamSet{},
+		scip::ParamSet{{{"separating/maxroundsroot", 0}, {"presolving/maxrounds", 0}}},
+	};
+	auto const completed = dyn.solve_all({&fast_model, &slow_model}, param_sets);
+	REQUIRE(completed == std::vector<bool>{true, false});
+	REQUIRE(fast_model.is_solved());
+	// The slower run was interrupted, not left to complete
+	REQUIRE_FALSE(slow_model.is_solved());
+}
+
+TEST_CASE("ParallelConfiguring environment evaluates configurations", "[env]") {
+	auto env = environment::ParallelConfiguring<reward::NNodes>{{}, {}, 2};
+	env.seed(3);
+	auto const param_sets = std::vector<scip::ParamSet>{
+		scip::ParamSet{{{"branching/scorefunc", 's'}}},
+		scip::ParamSet{{{"branching/scorefunc", 'p'}}},
+	};
+	auto const [rewards, completed] = env.evaluate(get_model(), param_sets);
+	REQUIRE(rewards.size() == 2);
+	REQUIRE(completed == std::vector<bool>{true, true});
+	for (auto const reward : rewards) {
+		REQUIRE(reward > 0);
+	}
+
+	SECTION("Seeding makes evaluation deterministic") {
+		env.seed(3);
+		auto const [rewards_again, completed_again] = env.evaluate(get_model(), param_sets);
+		REQUIRE(rewards_again == rewards);
+	}
+}
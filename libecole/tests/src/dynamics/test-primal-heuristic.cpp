@@ -0,0 +1,55 @@
+#include <stdexcept>
+#include <tuple>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/dynamics/primal-heuristic.hpp"
+#include "ecole/exception.hpp"
+
+#include "conftest.hpp"
+#include "dynamics/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("PrimalHeuristicDynamics unit tests", "[unit][dynamics]") {
+	auto const frequency = GENERATE(1, 3);
+	auto const policy = [](auto const& action_set) {
+		return dynamics::PrimalHeuristicDynamics::Action{{action_set.value()[0], 0.1}};
+	};
+	dynamics::unit_tests(dynamics::PrimalHeuristicDynamics{frequency}, policy);
+}
+
+TEST_CASE("PrimalHeuristicDynamics functional tests", "[dynamics]") {
+	auto dyn = dynamics::PrimalHeuristicDynamics{};
+	auto model = get_model();
+
+	SECTION("Return valid action set") {
+		auto const [done, action_set] = dyn.reset_dynamics(model);
+		REQUIRE_FALSE(done);
+		REQUIRE(action_set.has_value());
+		REQUIRE(action_set.value().size() == model.heuristics().size());
+	}
+
+	SECTION("Unscheduled heuristics are disabled") {
+		auto [done, action_set] = dyn.reset_dynamics(model);
+		REQUIRE_FALSE(done);
+		auto const name = action_set.value()[0];
+		std::tie(done, action_set) = dyn.step_dynamics(model, {{name, 0.}});
+		REQUIRE(model.get_param<int>("heuristics/" + name + "/freq") == -1);
+	}
+
+	SECTION("Solve instance") {
+		auto [done, action_set] = dyn.reset_dynamics(model);
+		while (!done) {
+			REQUIRE(action_set.has_value());
+			std::tie(done, action_set) = dyn.step_dynamics(model, {});
+		}
+		REQUIRE(model.is_solved());
+	}
+
+	SECTION("Throw on unknown heuristic") {
+		auto const [done, action_set] = dyn.reset_dynamics(model);
+		REQUIRE_FALSE(done);
+		REQUIRE_THROWS_AS(dyn.step_dynamics(model, {{"not-a-heuristic", 1.}}), Exception);
+	}
+}
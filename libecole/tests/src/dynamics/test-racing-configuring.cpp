@@ -0,0 +1,61 @@
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/dynamics/racing-configuring.hpp"
+#include "ecole/exception.hpp"
+#include "ecole/scip/param-set.hpp"
+
+#include "conftest.hpp"
+#include "dynamics/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("RacingConfiguringDynamics unit tests", "[unit][dynamics]") {
+	auto const policy = [](auto const& /*action_set*/) -> trait::action_of_t<dynamics::RacingConfiguringDynamics> {
+		return {scip::ParamSet{{{"branching/scorefunc", 's'}}}, scip::ParamSet{{{"branching/scorefunc", 'p'}}}};
+	};
+	dynamics::unit_tests(dynamics::RacingConfiguringDynamics{}, policy);
+}
+
+TEST_CASE("RacingConfiguringDynamics functional tests", "[dynamics]") {
+	auto dyn = dynamics::RacingConfiguringDynamics{0.1, 0.5, 2};
+	auto model = get_model();
+	auto const original_model = model.get_scip_ptr();
+	auto const param_sets = std::vector<scip::ParamSet>{
+		scip::ParamSet{{{"branching/scorefunc", 's'}}},
+		scip::ParamSet{{{"branching/scorefunc", 'p'}}},
+		scip::ParamSet{{{"branching/scorefunc", 'q'}}},
+	};
+
+	SECTION("Episodes have length one and solve the winner") {
+		auto [done, action_set] = dyn.reset_dynamics(model);
+		REQUIRE_FALSE(done);
+		std::tie(done, std::ignore) = dyn.step_dynamics(model, param_sets);
+		REQUIRE(done);
+		REQUIRE(model.is_solved());
+		REQUIRE(model.get_scip_ptr() != original_model);
+		REQUIRE(dyn.winner() < param_sets.size());
+		auto const winner_score = param_sets[dyn.winner()].to_dict().at("branching/scorefunc");
+		REQUIRE(model.get_param<char>("branching/scorefunc") == std::get<char>(winner_score));
+	}
+
+	SECTION("A single candidate is solved without racing") {
+		dyn.reset_dynamics(model);
+		dyn.step_dynamics(model, {param_sets[1]});
+		REQUIRE(model.is_solved());
+		REQUIRE(dyn.winner() == 0);
+		REQUIRE(dyn.n_rounds() == 0);
+	}
+
+	SECTION("Throw on empty action") {
+		dyn.reset_dynamics(model);
+		REQUIRE_THROWS_AS(dyn.step_dynamics(model, {}), Exception);
+	}
+
+	SECTION("Throw on invalid options") {
+		REQUIRE_THROWS_AS(dynamics::RacingConfiguringDynamics(0.), Exception);
+		REQUIRE_THROWS_AS(dynamics::RacingConfiguringDynamics(1., 1.), Exception);
+	}
+}
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <cstddef>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/environment/branching.hpp"
+#include "ecole/environment/episode-runner.hpp"
+#include "ecole/observation/nothing.hpp"
+#include "ecole/reward/nnodes.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+namespace {
+
+using Env = environment::Branching<observation::Nothing, reward::NNodes>;
+using Runner = environment::EpisodeRunner<Env>;
+
+Runner::Action first_candidate(Runner::Observation const& /*obs*/, Runner::ActionSet const& action_set) {
+	return action_set.value()[0];
+}
+
+scip::Model instance(std::size_t /*episode*/) {
+	return get_model();
+}
+
+}  // namespace
+
+TEST_CASE("EpisodeRunner runs all episodes", "[env]") {
+	auto const n_episodes = std::size_t{4};
+	auto runner = Runner{[] { return Env{}; }, first_candidate, {2}};
+	// Assertions are not thread safe, the callback only records the results
+	auto results = std::vector<Runner::EpisodeResult>{};
+	runner.run(instance, n_episodes, [&results](Runner::EpisodeResult const& result) { results.push_back(result); });
+	REQUIRE(results.size() == n_episodes);
+	auto episodes = std::set<std::size_t>{};
+	for (auto const& result : results) {
+		REQUIRE(result.error == nullptr);
+		REQUIRE(result.done);
+		REQUIRE_FALSE(result.time_limit_reached);
+		REQUIRE(result.n_steps > 0);
+		REQUIRE(result.cumulative_reward > 0);
+		episodes.insert(result.episode);
+	}
+	REQUIRE(episodes.size() == n_episodes);
+}
+
+TEST_CASE("EpisodeRunner results do not depend on the number of threads", "[env]") {
+	auto const n_episodes = std::size_t{3};
+	auto const run = [n_episodes](std::size_t n_threads) {
+		auto runner = Runner{[] { return Env{}; }, first_candidate, {n_threads, {}, 3}};
+		return runner.run(instance, n_episodes);
+	};
+	auto const results_seq = run(1);
+	auto const results_par = run(3);
+	for (std::size_t i = 0; i < n_episodes; ++i) {
+		REQUIRE(results_seq[i].episode == i);
+		REQUIRE(results_seq[i].n_steps == results_par[i].n_steps);
+		REQUIRE(results_seq[i].cumulative_reward == results_par[i].cumulative_reward);
+	}
+}
+
+TEST_CASE("EpisodeRunner interrupts episodes past the time limit", "[env]") {
+	auto runner = Runner{[] { return Env{}; }, first_candidate, {2, std::chrono::milliseconds{1}}};
+	for (auto const& result : runner.run(instance, 2)) {
+		REQUIRE(result.error == nullptr);
+		REQUIRE(result.time_limit_reached);
+	}
+}
+
+TEST_CASE("EpisodeRunner reports errors in episodes", "[env]") {
+	auto const failing_instance = [](std::size_t episode) -> scip::Model {
+		if (episode == 1) {
+			throw std::runtime_error{"error"};
+		}
+		return get_model();
+	};
+	auto runner = Runner{[] { return Env{}; }, first_candidate, {2}};
+	auto const results = runner.run(failing_instance, 2);
+	REQUIRE(results[0].error == nullptr);
+	REQUIRE(results[1].error != nullptr);
+}
@@ -0,0 +1,26 @@
+#include <catch2/catch.hpp>
+#include <scip/scip.h>
+
+#include "ecole/instance/capacitated-facility-location.hpp"
+
+#include "instance/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("CapacitatedFacilityLocationGenerator unit tests", "[unit][instance]") {
+	// NOLINTNEXTLINE(readability-magic-numbers)
+	instance::unit_tests(instance::CapacitatedFacilityLocationGenerator{{60, 50}});
+}
+
+TEST_CASE("CapacitatedFacilityLocationGenerator functional tests", "[instance]") {
+	auto const params = instance::CapacitatedFacilityLocationGenerator::Parameters{60, 50};  // NOLINT
+	auto random_engine = RandomEngine{};
+	auto const model = instance::CapacitatedFacilityLocationGenerator::generate_instance(params, random_engine);
+	auto* const scip = model.get_scip_ptr();
+
+	auto const n_vars = params.n_customers * params.n_facilities + params.n_facilities;
+	auto const n_conss = params.n_customers + params.n_facilities + params.n_customers * params.n_facilities;
+	REQUIRE(static_cast<std::size_t>(SCIPgetNOrigVars(scip)) == n_vars);
+	REQUIRE(static_cast<std::size_t>(SCIPgetNOrigConss(scip)) == n_conss);
+	REQUIRE(SCIPgetObjsense(scip) == SCIP_OBJSENSE_MINIMIZE);
+}
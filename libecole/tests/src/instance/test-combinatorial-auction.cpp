@@ -0,0 +1,30 @@
+#include <catch2/catch.hpp>
+#include <scip/scip.h>
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/combinatorial-auction.hpp"
+
+#include "instance/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("CombinatorialAuctionGenerator unit tests", "[unit][instance]") {
+	instance::unit_tests(instance::CombinatorialAuctionGenerator{{50, 150}});  // NOLINT(readability-magic-numbers)
+}
+
+TEST_CASE("CombinatorialAuctionGenerator functional tests", "[instance]") {
+	auto params = instance::CombinatorialAuctionGenerator::Parameters{50, 150};  // NOLINT(readability-magic-numbers)
+	auto random_engine = RandomEngine{};
+
+	SECTION("Instance has one variable per bid") {
+		auto const model = instance::CombinatorialAuctionGenerator::generate_instance(params, random_engine);
+		auto* const scip = model.get_scip_ptr();
+		REQUIRE(static_cast<std::size_t>(SCIPgetNOrigVars(scip)) == params.n_bids);
+		REQUIRE(SCIPgetObjsense(scip) == SCIP_OBJSENSE_MAXIMIZE);
+	}
+
+	SECTION("Throw on invalid values") {
+		params.min_value = 2 * params.max_value;
+		REQUIRE_THROWS_AS(instance::CombinatorialAuctionGenerator::generate_instance(params, random_engine), Exception);
+	}
+}
@@ -0,0 +1,34 @@
+#include <catch2/catch.hpp>
+#include <scip/scip.h>
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/independent-set.hpp"
+
+#include "instance/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("IndependentSetGenerator unit tests", "[unit][instance]") {
+	using GraphType = instance::IndependentSetGenerator::GraphType;
+	auto const graph_type = GENERATE(GraphType::barabasi_albert, GraphType::erdos_renyi);
+	auto params = instance::IndependentSetGenerator::Parameters{};
+	params.graph_type = graph_type;
+	instance::unit_tests(instance::IndependentSetGenerator{params});
+}
+
+TEST_CASE("IndependentSetGenerator functional tests", "[instance]") {
+	auto params = instance::IndependentSetGenerator::Parameters{};
+	auto random_engine = RandomEngine{};
+
+	SECTION("Instance has one variable per node") {
+		auto const model = instance::IndependentSetGenerator::generate_instance(params, random_engine);
+		auto* const scip = model.get_scip_ptr();
+		REQUIRE(static_cast<std::size_t>(SCIPgetNOrigVars(scip)) == params.n_nodes);
+		REQUIRE(SCIPgetObjsense(scip) == SCIP_OBJSENSE_MAXIMIZE);
+	}
+
+	SECTION("Throw on invalid affinity") {
+		params.affinity = params.n_nodes;
+		REQUIRE_THROWS_AS(instance::IndependentSetGenerator::generate_instance(params, random_engine), Exception);
+	}
+}
@@ -0,0 +1,83 @@
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <scip/scip.h>
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/pipeline.hpp"
+#include "ecole/instance/set-cover.hpp"
+#include "ecole/scip/model.hpp"
+
+using namespace ecole;
+
+namespace {
+
+/** Summary of an instance used to compare instances from different pipelines. */
+std::vector<double> objective(scip::Model const& model) {
+	auto* const scip = model.get_scip_ptr();
+	auto* const* const vars = SCIPgetOrigVars(scip);
+	auto coefs = std::vector<double>(static_cast<std::size_t>(SCIPgetNOrigVars(scip)));
+	for (std::size_t i = 0; i < coefs.size(); ++i) {
+		coefs[i] = SCIPvarGetObj(vars[i]);
+	}
+	return coefs;
+}
+
+std::vector<std::vector<double>> objectives(instance::InstancePipeline& pipeline, std::size_t n_instances) {
+	auto result = std::vector<std::vector<double>>{};
+	for (std::size_t i = 0; i < n_instances; ++i) {
+		result.push_back(objective(pipeline.next()));
+	}
+	return result;
+}
+
+}  // namespace
+
+TEST_CASE("InstancePipeline generates instances in the background", "[instance]") {
+	auto const generator = instance::SetCoverGenerator{{100, 200}};  // NOLINT(readability-magic-numbers)
+	auto constexpr n_instances = std::size_t{6};
+	auto constexpr seed = Seed{42};
+
+	SECTION("Instances only depend on the seed") {
+		auto sequential = instance::InstancePipeline::from_generator(generator, {2, 1}, seed);
+		auto parallel = instance::InstancePipeline::from_generator(generator, {4, 3}, seed);
+		REQUIRE(objectives(sequential, n_instances) == objectives(parallel, n_instances));
+	}
+
+	SECTION("Seeding restarts the sequence") {
+		auto pipeline = instance::InstancePipeline::from_generator(generator, {2, 2}, seed);
+		auto const first = objectives(pipeline, n_instances);
+		pipeline.seed(seed);
+		REQUIRE(objectives(pipeline, n_instances) == first);
+	}
+
+	SECTION("Instances are presolved ahead of time") {
+		auto options = instance::InstancePipeline::Options{};
+		options.presolve = true;
+		auto pipeline = instance::InstancePipeline::from_generator(generator, options, seed);
+		auto const model = pipeline.next();
+		REQUIRE(model.get_stage() >= SCIP_STAGE_PRESOLVED);
+	}
+
+	SECTION("Generation errors are rethrown in order") {
+		auto n_calls = std::size_t{0};
+		auto pipeline = instance::InstancePipeline{
+			[&n_calls](RandomEngine& random_engine) -> scip::Model {
+				// Only one thread so there is no race on the counter
+				if (n_calls++ == 1) {
+					throw Exception("Generation failed");
+				}
+				return instance::SetCoverGenerator::generate_instance({100, 200}, random_engine);  // NOLINT
+			},
+			{1, 1},
+			seed};
+		REQUIRE_NOTHROW(pipeline.next());
+		REQUIRE_THROWS_AS(pipeline.next(), Exception);
+		REQUIRE_NOTHROW(pipeline.next());
+	}
+
+	SECTION("Throw on empty buffer") {
+		REQUIRE_THROWS_AS(instance::InstancePipeline::from_generator(generator, {0, 1}, seed), Exception);
+	}
+}
@@ -0,0 +1,32 @@
+#include <catch2/catch.hpp>
+#include <scip/scip.h>
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/set-cover.hpp"
+
+#include "instance/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("SetCoverGenerator unit tests", "[unit][instance]") {
+	instance::unit_tests(instance::SetCoverGenerator{{100, 200}});  // NOLINT(readability-magic-numbers)
+}
+
+TEST_CASE("SetCoverGenerator functional tests", "[instance]") {
+	auto const params = instance::SetCoverGenerator::Parameters{100, 200};  // NOLINT(readability-magic-numbers)
+	auto random_engine = RandomEngine{};
+
+	SECTION("Instance has the requested dimensions") {
+		auto const model = instance::SetCoverGenerator::generate_instance(params, random_engine);
+		auto* const scip = model.get_scip_ptr();
+		REQUIRE(static_cast<std::size_t>(SCIPgetNOrigVars(scip)) == params.n_cols);
+		REQUIRE(static_cast<std::size_t>(SCIPgetNOrigConss(scip)) == params.n_rows);
+		REQUIRE(SCIPgetObjsense(scip) == SCIP_OBJSENSE_MINIMIZE);
+	}
+
+	SECTION("Throw on invalid density") {
+		auto bad_params = params;
+		bad_params.density = 0.001;  // NOLINT(readability-magic-numbers)
+		REQUIRE_THROWS_AS(instance::SetCoverGenerator::generate_instance(bad_params, random_engine), Exception);
+	}
+}
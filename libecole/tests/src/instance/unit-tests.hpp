@@ -0,0 +1,43 @@
+#pragma once
+
+#include <catch2/catch.hpp>
+#include <scip/scip.h>
+
+#include "ecole/instance/abstract.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::instance {
+
+template <typename Generator> void unit_tests(Generator&& generator) {
+	SECTION("Has default constructor") { Generator{}; }
+
+	SECTION("Generate instances in a loop") {
+		for (auto i = 0; i < 3; ++i) {
+			auto model = generator.next();
+			REQUIRE(SCIPgetNOrigVars(model.get_scip_ptr()) > 0);
+			REQUIRE(SCIPgetNOrigConss(model.get_scip_ptr()) > 0);
+		}
+	}
+
+	SECTION("Same seed gives same instances") {
+		generator.seed(3);
+		auto const model1 = generator.next();
+		generator.seed(3);
+		auto const model2 = generator.next();
+		auto* const scip1 = model1.get_scip_ptr();
+		auto* const scip2 = model2.get_scip_ptr();
+		REQUIRE(SCIPgetNOrigVars(scip1) == SCIPgetNOrigVars(scip2));
+		REQUIRE(SCIPgetNOrigConss(scip1) == SCIPgetNOrigConss(scip2));
+		for (auto i = 0; i < SCIPgetNOrigVars(scip1); ++i) {
+			REQUIRE(SCIPvarGetObj(SCIPgetOrigVars(scip1)[i]) == SCIPvarGetObj(SCIPgetOrigVars(scip2)[i]));
+		}
+	}
+
+	SECTION("Generated instances are valid") {
+		auto model = generator.next();
+		model.solve();
+		REQUIRE(model.is_solved());
+	}
+}
+
+}  // namespace ecole::instance
@@ -0,0 +1,49 @@
+#include <catch2/catch.hpp>
+#include <xtensor/xmath.hpp>
+#include <xtensor/xview.hpp>
+
+#include "ecole/dynamics/cut-selection.hpp"
+#include "ecole/observation/cutpool.hpp"
+
+#include "conftest.hpp"
+#include "observation/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("CutPool unit tests", "[unit][obs]") {
+	observation::unit_tests(observation::CutPool{});
+}
+
+TEST_CASE("CutPool return cut features", "[obs]") {
+	auto obs_func = observation::CutPool{};
+	auto model = get_model();
+	obs_func.before_reset(model);
+	auto dyn = dynamics::CutSelectionDynamics{};
+	auto const [done, action_set] = dyn.reset_dynamics(model);
+	REQUIRE_FALSE(done);
+	auto const obs = obs_func.extract(model, false);
+
+	REQUIRE(obs.has_value());
+	auto const& cut_feat = obs.value().cut_features;
+	auto const& coefs = obs.value().coefficients;
+	auto const n_cuts = model.cuts().size();
+
+	SECTION("Cut features are not empty") {
+		REQUIRE(cut_feat.shape()[0] == n_cuts);
+		REQUIRE(cut_feat.shape()[1] == observation::CutPoolObs::n_cut_features);
+		REQUIRE(xt::all(xt::isfinite(cut_feat)));
+	}
+
+	SECTION("Cut density is a fraction") {
+		auto constexpr density_idx = static_cast<std::ptrdiff_t>(observation::CutPoolObs::CutFeatures::density);
+		auto const density = xt::col(cut_feat, density_idx);
+		REQUIRE(xt::all(density > 0));
+		REQUIRE(xt::all(density <= 1));
+	}
+
+	SECTION("Coefficient matrix has one row per cut") {
+		REQUIRE(coefs.shape[0] == n_cuts);
+		REQUIRE(coefs.shape[1] == model.lp_columns().size());
+		REQUIRE(xt::all(xt::row(coefs.indices, 0) < n_cuts));
+	}
+}
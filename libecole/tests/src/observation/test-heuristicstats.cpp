@@ -0,0 +1,31 @@
+#include <catch2/catch.hpp>
+#include <xtensor/xmath.hpp>
+#include <xtensor/xview.hpp>
+
+#include "ecole/observation/heuristicstats.hpp"
+
+#include "conftest.hpp"
+#include "observation/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("HeuristicStats unit tests", "[unit][obs]") {
+	observation::unit_tests(observation::HeuristicStats{});
+}
+
+TEST_CASE("HeuristicStats return statistics matrix", "[obs]") {
+	auto obs_func = observation::HeuristicStats{};
+	auto model = get_model();
+	obs_func.before_reset(model);
+	advance_to_root_node(model);
+	auto const obs = obs_func.extract(model, false);
+
+	REQUIRE(obs.has_value());
+	auto const& stats = obs.value();
+	REQUIRE(stats.shape()[0] == model.heuristics().size());
+	REQUIRE(stats.shape()[1] == observation::HeuristicStats::n_features);
+	REQUIRE(xt::all(stats >= 0));
+	auto constexpr success_rate_idx = static_cast<std::ptrdiff_t>(observation::HeuristicStats::Features::success_rate);
+	auto const success_rate = xt::col(stats, success_rate_idx);
+	REQUIRE(xt::all(success_rate <= 1));
+}
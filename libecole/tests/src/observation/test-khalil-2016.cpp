@@ -143,3 +143,23 @@ TEST_CASE("Khalil2016 return correct observation", "[obs]") {
 		}
 	}
 }
+
+TEST_CASE("Khalil2016 computes only the selected features", "[obs]") {
+	using Group = observation::Khalil2016::Feature::Group;
+	auto model = get_model();
+	advance_to_root_node(model);
+	auto const all_obs = observation::Khalil2016{}.extract(model, false).value();
+
+	auto obs_func = observation::Khalil2016{{Group::obj_coef, Group::pseudocosts, Group::active_coefs}};
+	auto const features = obs_func.features();
+	REQUIRE(features.size() == 3 + 5 + 24);
+	REQUIRE(features[3] == static_cast<std::size_t>(observation::Khalil2016::Feature::Dynamic::pseudocost_up));
+
+	auto const obs = obs_func.extract(model, false).value();
+	REQUIRE(obs.shape(0) == all_obs.shape(0));
+	REQUIRE(obs.shape(1) == features.size());
+	for (std::size_t i = 0; i < features.size(); ++i) {
+		auto const all_col = static_cast<std::ptrdiff_t>(features[i]);
+		REQUIRE(xt::col(obs, static_cast<std::ptrdiff_t>(i)) == xt::col(all_obs, all_col));
+	}
+}
@@ -53,3 +53,23 @@ TEST_CASE("NodeBipartite return correct observation", "[obs]") {
 		}
 	}
 }
+
+TEST_CASE("NodeBipartite computes only the selected column features", "[obs]") {
+	using Group = observation::NodeBipartiteObs::ColumnFeatureGroup;
+	auto model = get_model();
+	advance_to_root_node(model);
+	auto const all_obs = observation::NodeBipartite{}.extract(model, false).value();
+
+	auto obs_func = observation::NodeBipartite{{Group::objective, Group::basis}};
+	auto const features = obs_func.column_features();
+	REQUIRE(features.size() == 5);
+	REQUIRE(features[0] == observation::NodeBipartiteObs::ColumnFeatures::objective);
+
+	auto const obs = obs_func.extract(model, false).value();
+	REQUIRE(obs.column_features.shape()[1] == features.size());
+	REQUIRE(obs.row_features == all_obs.row_features);
+	for (std::size_t i = 0; i < features.size(); ++i) {
+		auto const all_col = static_cast<std::ptrdiff_t>(features[i]);
+		REQUIRE(xt::col(obs.column_features, static_cast<std::ptrdiff_t>(i)) == xt::col(all_obs.column_features, all_col));
+	}
+}
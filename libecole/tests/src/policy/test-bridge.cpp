@@ -0,0 +1,101 @@
+#include <chrono>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/exception.hpp"
+#include "ecole/policy/bridge.hpp"
+
+using namespace ecole;
+
+namespace {
+
+using Bridge = policy::PolicyBridge<int, int>;
+
+std::vector<int> double_all(std::vector<int>& requests) {
+	auto responses = requests;
+	for (auto& r : responses) {
+		r *= 2;
+	}
+	return responses;
+}
+
+}  // namespace
+
+TEST_CASE("PolicyBridge batches the requests of many threads", "[policy]") {
+	auto constexpr n_threads = 8;
+	auto bridge = Bridge{double_all, {4, std::chrono::seconds{1}}};
+	auto responses = std::vector<int>(n_threads);
+	{
+		auto threads = std::vector<std::thread>{};
+		for (auto i = 0; i < n_threads; ++i) {
+			threads.emplace_back([&bridge, &responses, i] { responses[static_cast<std::size_t>(i)] = bridge.query(i); });
+		}
+		for (auto& t : threads) {
+			t.join();
+		}
+	}
+	for (auto i = 0; i < n_threads; ++i) {
+		REQUIRE(responses[static_cast<std::size_t>(i)] == 2 * i);
+	}
+
+	auto const stats = bridge.stats();
+	REQUIRE(stats.batch_sizes.size() == 5);
+	auto n_requests = std::size_t{0};
+	for (std::size_t size = 0; size < stats.batch_sizes.size(); ++size) {
+		n_requests += size * stats.batch_sizes[size];
+	}
+	REQUIRE(n_requests == n_threads);
+	REQUIRE(std::accumulate(stats.queue_latencies.begin(), stats.queue_latencies.end(), std::size_t{0}) == n_threads);
+}
+
+TEST_CASE("PolicyBridge evaluates incomplete batches after the timeout", "[policy]") {
+	auto bridge = Bridge{double_all, {8, std::chrono::milliseconds{1}}};
+	REQUIRE(bridge.query(3) == 6);
+	REQUIRE(bridge.stats().batch_sizes[1] == 1);
+}
+
+TEST_CASE("PolicyBridge forwards policy errors", "[policy]") {
+	auto const throw_error = [](auto& /*requests*/) -> std::vector<int> { throw std::runtime_error{"error"}; };
+
+	SECTION("Exceptions thrown by the policy") {
+		auto bridge = Bridge{throw_error, {1}};
+		REQUIRE_THROWS_WITH(bridge.query(0), "error");
+	}
+
+	SECTION("Exceptions thrown by the policy in every thread of the batch") {
+		auto constexpr n_threads = 4;
+		auto bridge = Bridge{throw_error, {n_threads, std::chrono::seconds{1}}};
+		auto messages = std::vector<std::string>(n_threads);
+		{
+			auto threads = std::vector<std::thread>{};
+			for (auto i = 0; i < n_threads; ++i) {
+				threads.emplace_back([&bridge, &messages, i] {
+					try {
+						bridge.query(i);
+					} catch (Exception const& error) {
+						messages[static_cast<std::size_t>(i)] = error.what();
+					}
+				});
+			}
+			for (auto& t : threads) {
+				t.join();
+			}
+		}
+		for (auto const& message : messages) {
+			REQUIRE(message == "error");
+		}
+	}
+
+	SECTION("Wrong number of responses") {
+		auto bridge = Bridge{[](auto& /*requests*/) { return std::vector<int>{}; }, {1}};
+		REQUIRE_THROWS_AS(bridge.query(0), Exception);
+	}
+
+	SECTION("Zero batch size") { REQUIRE_THROWS_AS((Bridge{double_all, {0}}), Exception); }
+}
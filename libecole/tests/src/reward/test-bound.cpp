@@ -0,0 +1,74 @@
+#include <cmath>
+
+#include <catch2/catch.hpp>
+#include <scip/scip.h>
+
+#include "ecole/instance/pipeline.hpp"
+#include "ecole/instance/set-cover.hpp"
+#include "ecole/reward/bound.hpp"
+
+#include "conftest.hpp"
+#include "reward/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("PrimalBound unit tests", "[unit][reward]") {
+	reward::unit_tests(reward::PrimalBound{});
+}
+
+TEST_CASE("DualBound unit tests", "[unit][reward]") {
+	reward::unit_tests(reward::DualBound{});
+}
+
+TEST_CASE("PrimalBound and DualBound return the bounds of the current state", "[reward]") {
+	auto primal_func = reward::PrimalBound{};
+	auto dual_func = reward::DualBound{};
+	auto model = get_model();  // a non-trivial instance is loaded
+	primal_func.before_reset(model);
+	dual_func.before_reset(model);
+
+	SECTION("Bounds are infinite before solving") {
+		auto* const scip = model.get_scip_ptr();
+		REQUIRE(SCIPisInfinity(scip, std::abs(primal_func.extract(model))));
+		REQUIRE(SCIPisInfinity(scip, std::abs(dual_func.extract(model))));
+	}
+
+	SECTION("Bounds are the ones of SCIP after root node processing") {
+		advance_to_root_node(model);
+		auto* const scip = model.get_scip_ptr();
+		REQUIRE(primal_func.extract(model) == SCIPgetPrimalbound(scip));
+		REQUIRE(dual_func.extract(model) == SCIPgetDualbound(scip));
+		REQUIRE_FALSE(SCIPisInfinity(scip, std::abs(dual_func.extract(model))));
+	}
+
+	SECTION("Bounds are the ones of SCIP after solving") {
+		model.solve();
+		auto* const scip = model.get_scip_ptr();
+		REQUIRE(primal_func.extract(model, true) == SCIPgetPrimalbound(scip));
+		REQUIRE(dual_func.extract(model, true) == SCIPgetDualbound(scip));
+	}
+
+	SECTION("Bounds can be tracked if solving already started") {
+		model = get_model();
+		advance_to_root_node(model);
+		dual_func.before_reset(model);
+		REQUIRE(dual_func.extract(model) == SCIPgetDualbound(model.get_scip_ptr()));
+	}
+}
+
+TEST_CASE("PrimalBound and DualBound track presolved pipeline instances", "[reward]") {
+	auto options = instance::InstancePipeline::Options{};
+	options.presolve = true;
+	auto pipeline = instance::InstancePipeline::from_generator(
+		instance::SetCoverGenerator{{100, 200}}, options, Seed{0});  // NOLINT(readability-magic-numbers)
+	auto model = pipeline.next();
+	auto primal_func = reward::PrimalBound{};
+	auto dual_func = reward::DualBound{};
+	REQUIRE_NOTHROW(primal_func.before_reset(model));
+	REQUIRE_NOTHROW(dual_func.before_reset(model));
+
+	model.solve();
+	auto* const scip = model.get_scip_ptr();
+	REQUIRE(primal_func.extract(model, true) == SCIPgetPrimalbound(scip));
+	REQUIRE(dual_func.extract(model, true) == SCIPgetDualbound(scip));
+}
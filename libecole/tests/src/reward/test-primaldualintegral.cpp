@@ -0,0 +1,56 @@
+#include <catch2/catch.hpp>
+
+#include "ecole/reward/primaldualintegral.hpp"
+#include "ecole/scip/bound-tracker.hpp"
+#include "ecole/scip/model.hpp"
+
+#include "conftest.hpp"
+#include "reward/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("PrimalDualIntegral unit tests", "[unit][reward]") {
+	reward::unit_tests(reward::PrimalDualIntegral{});
+}
+
+TEST_CASE("PrimalDualIntegral returns the primal-dual integral between two states", "[reward]") {
+	auto reward_func = reward::PrimalDualIntegral{};
+	auto model = get_model();  // a non-trivial instance is loaded
+	reward_func.before_reset(model);
+
+	SECTION("Primal-dual integral is zero before solving") { REQUIRE(reward_func.extract(model) == 0); }
+
+	SECTION("Primal-dual integral is strictly positive after root node processing") {
+		advance_to_root_node(model);
+		REQUIRE(reward_func.extract(model) > 0);
+	}
+
+	SECTION("Primal-dual integral is bounded by the solving time") {
+		advance_to_root_node(model);
+		REQUIRE(reward_func.extract(model) <= SCIPgetSolvingTime(model.get_scip_ptr()));
+	}
+
+	SECTION("Primal-dual integral stops increasing once solved") {
+		model.solve();
+		REQUIRE(reward_func.extract(model, true) > 0);
+		REQUIRE(model.bound_tracker().last_gap == 0);
+		REQUIRE(reward_func.extract(model, true) == 0);
+	}
+
+	SECTION("Primal-dual integral is tracked on presolved models") {
+		model = get_model();
+		model.presolve();
+		reward_func.before_reset(model);
+		REQUIRE(reward_func.extract(model) == 0);
+		model.solve();
+		REQUIRE(reward_func.extract(model, true) > 0);
+	}
+
+	SECTION("Reset primal-dual integral") {
+		advance_to_root_node(model);
+		reward_func.extract(model);
+		model = get_model();
+		reward_func.before_reset(model);
+		REQUIRE(reward_func.extract(model) == 0);
+	}
+}
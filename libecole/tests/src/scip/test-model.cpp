@@ -1,11 +1,14 @@
 #include <future>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include <catch2/catch.hpp>
 #include <scip/scip.h>
 
+#include "ecole/scip/bound-tracker.hpp"
 #include "ecole/scip/exception.hpp"
+#include "ecole/scip/lp-snapshot.hpp"
 #include "ecole/scip/model.hpp"
 
 #include "conftest.hpp"
@@ -37,6 +40,14 @@ TEST_CASE("Model solving", "[scip]") {
 		model.solve();
 	}
 
+	SECTION("Resume after presolving") {
+		auto model = get_model();
+		model.presolve();
+		REQUIRE(model.get_stage() == SCIP_STAGE_PRESOLVED);
+		model.solve();
+		REQUIRE(model.is_solved());
+	}
+
 	SECTION("Asynchronously") {
 		auto load_solve = [] {
 			get_model().solve();
@@ -48,6 +59,65 @@ TEST_CASE("Model solving", "[scip]") {
 	}
 }
 
+TEST_CASE("LP snapshot gathers the current LP once per node", "[scip]") {
+	auto model = get_model();
+	REQUIRE_THROWS_AS(model.lp_snapshot(), scip::Exception);
+	advance_to_root_node(model);
+
+	auto const& lp = model.lp_snapshot();
+	auto const cols = model.lp_columns();
+	REQUIRE(lp.cols == std::vector<scip::Col*>(cols.begin(), cols.end()));
+	REQUIRE(lp.col_primsols.size() == lp.n_cols());
+	REQUIRE(lp.col_primsols[0] == SCIPcolGetPrimsol(cols[0]));
+	REQUIRE(lp.n_rows() == model.lp_rows().size());
+	REQUIRE(lp.row_dualsols.size() == lp.n_rows());
+	REQUIRE_FALSE(lp.lp_branch_cands.empty());
+
+	SECTION("Reuse the snapshot on the same node") {
+		auto const key = lp.key;
+		REQUIRE(&model.lp_snapshot() == &lp);
+		REQUIRE(model.lp_snapshot().key == key);
+	}
+
+	SECTION("Gather again on a new node") {
+		auto const key = lp.key;
+		model.solve_iter_branch(lp.lp_branch_cands[0]);
+		if (!model.solve_iter_is_done()) {
+			REQUIRE(model.lp_snapshot().key != key);
+		}
+	}
+}
+
+TEST_CASE("Bound tracker follows the bounds during solving", "[scip]") {
+	auto model = get_model();
+	REQUIRE_THROWS_AS(model.bound_tracker(), scip::Exception);
+	model.track_bounds();
+	model.track_bounds();
+	auto const& tracker = model.bound_tracker();
+	REQUIRE(tracker.n_updates == 0);
+	REQUIRE(tracker.gap(tracker.primal_bound, tracker.dual_bound) == 1.);
+
+	advance_to_root_node(model);
+	auto* const scip = model.get_scip_ptr();
+	REQUIRE(&model.bound_tracker() == &tracker);
+	REQUIRE(tracker.n_updates > 0);
+	REQUIRE(tracker.dual_bound == SCIPgetDualbound(scip));
+	REQUIRE(tracker.primal_bound == SCIPgetPrimalbound(scip));
+	REQUIRE(tracker.primal_dual_integral >= 0.);
+	REQUIRE(tracker.primal_dual_integral_at(SCIPgetSolvingTime(scip)) >= tracker.primal_dual_integral);
+
+	SECTION("Start tracking once solving from the current bounds") {
+		auto other_model = get_model();
+		advance_to_root_node(other_model);
+		other_model.track_bounds();
+		auto* const other_scip = other_model.get_scip_ptr();
+		auto const& other_tracker = other_model.bound_tracker();
+		REQUIRE(other_tracker.dual_bound == SCIPgetDualbound(other_scip));
+		REQUIRE(other_tracker.primal_bound == SCIPgetPrimalbound(other_scip));
+		REQUIRE(other_tracker.primal_dual_integral == 0.);
+	}
+}
+
 TEST_CASE("Explicit parameter management", "[scip]") {
 	using Catch::Contains;
 	using scip::ParamType;
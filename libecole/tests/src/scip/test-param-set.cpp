@@ -0,0 +1,83 @@
+#include <string>
+#include <unordered_set>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/scip/exception.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/param-set.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("ParamSet resolves parameter types", "[scip]") {
+	auto const param_set = scip::ParamSet{{
+		{"branching/scorefunc", std::string{"s"}},
+		{"branching/scorefac", 0.1},
+		{"conflict/lpiterations", 0.},
+		{"limits/nodes", 10},
+	}};
+	auto const dict = param_set.to_dict();
+	REQUIRE(param_set.size() == 4);
+	REQUIRE(std::holds_alternative<char>(dict.at("branching/scorefunc")));
+	REQUIRE(std::holds_alternative<scip::real>(dict.at("branching/scorefac")));
+	REQUIRE(std::holds_alternative<int>(dict.at("conflict/lpiterations")));
+	REQUIRE(std::holds_alternative<scip::long_int>(dict.at("limits/nodes")));
+}
+
+TEST_CASE("ParamSet validates parameters", "[scip]") {
+	SECTION("Throw on unknown parameters") {
+		REQUIRE_THROWS_AS(scip::ParamSet({{"not/a/param", 3}}), scip::Exception);
+	}
+
+	SECTION("Throw on out of bounds values") {
+		REQUIRE_THROWS_AS(scip::ParamSet({{"conflict/minmaxvars", -3}}), scip::Exception);
+	}
+
+	SECTION("Throw on invalid char values") {
+		REQUIRE_THROWS_AS(scip::ParamSet({{"branching/scorefunc", 'z'}}), scip::Exception);
+	}
+
+	SECTION("Throw on numerical rounding") {
+		REQUIRE_THROWS_AS(scip::ParamSet({{"conflict/minmaxvars", 3.1}}), std::runtime_error);
+	}
+}
+
+TEST_CASE("ParamSet can be applied on models", "[scip]") {
+	auto const param_set = scip::ParamSet{{{"branching/scorefunc", 's'}, {"conflict/minmaxvars", 3}}};
+	auto model = get_model();
+
+	SECTION("Apply parameters") {
+		param_set.apply(model);
+		REQUIRE(model.get_param<char>("branching/scorefunc") == 's');
+		REQUIRE(model.get_param<int>("conflict/minmaxvars") == 3);
+	}
+
+	SECTION("Resolve with a given model") {
+		auto const param_set_model = scip::ParamSet{{{"branching/scorefunc", 's'}, {"conflict/minmaxvars", 3}}, model};
+		REQUIRE(param_set_model == param_set);
+	}
+}
+
+TEST_CASE("ParamSet comparison, hashing, and diff", "[scip]") {
+	auto const param_set_1 = scip::ParamSet{{{"branching/scorefunc", 's'}, {"conflict/minmaxvars", 3}}};
+	auto const param_set_2 = scip::ParamSet{{{"branching/scorefunc", 's'}, {"conflict/minmaxvars", 3.}}};
+	auto const param_set_3 = scip::ParamSet{{{"branching/scorefunc", 'p'}, {"conflict/minmaxvars", 3}}};
+
+	SECTION("Equality on resolved values") {
+		REQUIRE(param_set_1 == param_set_2);
+		REQUIRE(param_set_1 != param_set_3);
+		REQUIRE(param_set_1.hash() == param_set_2.hash());
+		auto const sets = std::unordered_set<scip::ParamSet>{param_set_1, param_set_2, param_set_3};
+		REQUIRE(sets.size() == 2);
+	}
+
+	SECTION("Diff only keeps different values") {
+		auto const diff = param_set_3.diff(param_set_1);
+		REQUIRE(diff.size() == 1);
+		REQUIRE(diff.to_dict().at("branching/scorefunc") == scip::Param{'p'});
+		REQUIRE(param_set_1.diff(param_set_2).empty());
+		REQUIRE(param_set_1.diff(scip::ParamSet{}) == param_set_1);
+	}
+}
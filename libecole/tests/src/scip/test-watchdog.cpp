@@ -0,0 +1,47 @@
+#include <chrono>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/watchdog.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("Watchdog interrupts solves past their time limit", "[scip]") {
+	auto watchdog = scip::Watchdog{};
+	auto model = get_model();
+
+	SECTION("Solve is interrupted") {
+		auto const deadline = watchdog.watch(model, std::chrono::milliseconds{1});
+		model.solve();
+		REQUIRE(deadline.expired());
+		REQUIRE_FALSE(model.is_solved());
+	}
+
+	SECTION("Solve finishing before the limit is not interrupted") {
+		auto const deadline = watchdog.watch(model, std::chrono::hours{1});
+		model.solve();
+		REQUIRE_FALSE(deadline.expired());
+		REQUIRE(model.is_solved());
+	}
+
+	SECTION("Moved from deadlines are not expired") {
+		auto deadline = watchdog.watch(model, std::chrono::milliseconds{1});
+		auto const moved = std::move(deadline);
+		std::this_thread::sleep_for(std::chrono::milliseconds{20});  // NOLINT(readability-magic-numbers)
+		REQUIRE(moved.expired());
+		REQUIRE_FALSE(deadline.expired());  // NOLINT(bugprone-use-after-move, clang-analyzer-cplusplus.Move)
+	}
+
+	SECTION("Moved models remain watched") {
+		auto const deadline = watchdog.watch(model, std::chrono::milliseconds{1});
+		auto moved = std::move(model);
+		std::this_thread::sleep_for(std::chrono::milliseconds{20});  // NOLINT(readability-magic-numbers)
+		moved.solve();
+		REQUIRE(deadline.expired());
+		REQUIRE_FALSE(moved.is_solved());
+	}
+}
@@ -0,0 +1,100 @@
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/environment/branching.hpp"
+#include "ecole/instrumentation.hpp"
+#include "ecole/observation/nothing.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+using instrumentation::Stage;
+
+TEST_CASE("Scoped timers record in the current statistics", "[instrumentation]") {
+	auto stats = instrumentation::EpisodeStats{};
+
+	SECTION("Nothing is recorded without statistics") {
+		REQUIRE(instrumentation::current() == nullptr);
+		{ auto const timer = instrumentation::ScopedTimer{Stage::step}; }
+		REQUIRE(stats[Stage::step].count == 0);
+	}
+
+	SECTION("Timers are aggregated") {
+		{
+			auto const recording = instrumentation::ScopedRecording{stats};
+			{ auto const timer = instrumentation::ScopedTimer{Stage::step}; }
+			instrumentation::record(Stage::solve, std::chrono::milliseconds{2});
+			instrumentation::record(Stage::solve, std::chrono::milliseconds{3});
+		}
+		REQUIRE(instrumentation::current() == nullptr);
+		REQUIRE(stats[Stage::step].count == 1);
+		REQUIRE(stats[Stage::solve].count == 2);
+		REQUIRE(stats[Stage::solve].total == std::chrono::milliseconds{5});
+		stats.clear();
+		REQUIRE(stats[Stage::solve].count == 0);
+	}
+
+	SECTION("Stages have names") { REQUIRE(instrumentation::stage_name(Stage::python_conversion) == "python_conversion"); }
+}
+
+TEST_CASE("Trace events are written in the Chrome trace format", "[instrumentation]") {
+	auto const contains = [](std::string const& str, std::string const& sub) { return str.find(sub) != std::string::npos; };
+	auto const write = [] {
+		auto out = std::ostringstream{};
+		instrumentation::write_trace(out);
+		return out.str();
+	};
+
+	SECTION("Events are recorded per thread while tracing") {
+		instrumentation::start_tracing();
+		{ auto const trace = instrumentation::ScopedTrace{"outer"}; }
+		std::thread{[] { auto const trace = instrumentation::ScopedTrace{Stage::step}; }}.join();
+		instrumentation::stop_tracing();
+		{ auto const trace = instrumentation::ScopedTrace{"ignored"}; }
+
+		auto const json = write();
+		REQUIRE(contains(json, R"("name": "outer", "ph": "B")"));
+		REQUIRE(contains(json, R"("name": "outer", "ph": "E")"));
+		REQUIRE(contains(json, R"("name": "step", "ph": "B")"));
+		REQUIRE(contains(json, R"("tid": 1)"));
+		REQUIRE_FALSE(contains(json, "ignored"));
+	}
+
+	SECTION("Ring buffers keep the last events") {
+		instrumentation::start_tracing(2);
+		{ auto const trace = instrumentation::ScopedTrace{"first"}; }
+		{ auto const trace = instrumentation::ScopedTrace{"second"}; }
+		instrumentation::stop_tracing();
+
+		auto const json = write();
+		REQUIRE_FALSE(contains(json, "first"));
+		REQUIRE(contains(json, "second"));
+	}
+
+	SECTION("Zero capacity is rejected") { REQUIRE_THROWS(instrumentation::start_tracing(0)); }
+}
+
+TEST_CASE("Environment records its stages", "[instrumentation][slow]") {
+	auto env = environment::Branching<observation::Nothing>{};
+	auto [obs, action_set, reward, done, info] = env.reset(get_model());
+	while (!done) {
+		std::tie(obs, action_set, reward, done, info) = env.step(action_set.value()[0]);
+	}
+
+	auto const& stats = env.stats();
+	if constexpr (instrumentation::enabled) {
+		REQUIRE(stats[Stage::reset].count == 1);
+		REQUIRE(stats[Stage::step].count > 0);
+		REQUIRE(stats[Stage::solve].count == stats[Stage::step].count + 1);
+		REQUIRE(stats[Stage::handoff].count > 0);
+		REQUIRE(stats[Stage::observation].count == stats[Stage::step].count + 1);
+		REQUIRE(stats[Stage::solve].total <= stats[Stage::reset].total + stats[Stage::step].total);
+	} else {
+		REQUIRE(stats[Stage::step].count == 0);
+	}
+}
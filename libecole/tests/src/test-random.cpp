@@ -1,3 +1,5 @@
+#include <sstream>
+
 #include <catch2/catch.hpp>
 
 #include "ecole/random.hpp"
@@ -25,3 +27,55 @@ TEST_CASE("Successive random engines are different", "[random]") {
 	auto random_engine_2 = ecole::spawn_random_engine();
 	REQUIRE(random_engine_1 != random_engine_2);
 }
+
+TEST_CASE("Random engines with the same id are the same regardless of order", "[random]") {
+	ecole::seed(0);
+	auto const random_engine_1 = ecole::spawn_random_engine(1);
+	auto const random_engine_2 = ecole::spawn_random_engine(2);
+	ecole::seed(0);
+	REQUIRE(ecole::spawn_random_engine(2) == random_engine_2);
+	REQUIRE(ecole::spawn_random_engine() != random_engine_1);
+	REQUIRE(ecole::spawn_random_engine(1) == random_engine_1);
+}
+
+TEST_CASE("Philox engine matches the reference implementation", "[random]") {
+	// Known answers of the Random123 library
+	REQUIRE(
+		Philox4x32::block({0, 0, 0, 0}, {0, 0}) == Philox4x32::Counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+	REQUIRE(
+		Philox4x32::block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+		Philox4x32::Counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("Philox engine can be advanced and split in constant time", "[random]") {
+	auto random_engine = RandomEngine{42};  // NOLINT(readability-magic-numbers)
+
+	SECTION("Discard skips values") {
+		auto other = random_engine;
+		for (auto i = 0; i < 7; ++i) {  // NOLINT(readability-magic-numbers)
+			random_engine();
+		}
+		other.discard(6);  // NOLINT(readability-magic-numbers)
+		other();
+		REQUIRE(random_engine == other);
+		REQUIRE(random_engine() == other());
+	}
+
+	SECTION("Splits only depend on the id") {
+		auto const split = random_engine.split(3);
+		random_engine();
+		REQUIRE(random_engine.split(3) == split);
+		REQUIRE(random_engine.split(4) != split);
+		REQUIRE(split.split(3) != split);
+	}
+
+	SECTION("State can be saved and restored") {
+		random_engine();
+		auto stream = std::stringstream{};
+		stream << random_engine;
+		auto restored = RandomEngine{};
+		stream >> restored;
+		REQUIRE(restored == random_engine);
+		REQUIRE(restored() == random_engine());
+	}
+}
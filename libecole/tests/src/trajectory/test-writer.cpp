@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <xtensor/xarray.hpp>
+
+#include "ecole/exception.hpp"
+#include "ecole/random.hpp"
+#include "ecole/trajectory/writer.hpp"
+
+using namespace ecole;
+namespace fs = std::filesystem;
+
+namespace {
+
+/** Return the raw data of a ``.npy`` file, skipping its header. */
+template <typename T> std::vector<T> read_npy_data(fs::path const& path) {
+	auto file = std::ifstream{path, std::ios::binary};
+	auto const bytes = std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+	auto constexpr preamble_size = std::size_t{10};
+	auto const header_size =
+		static_cast<std::size_t>(static_cast<std::uint8_t>(bytes[8])) +
+		(static_cast<std::size_t>(static_cast<std::uint8_t>(bytes[9])) << 8U);  // NOLINT(readability-magic-numbers)
+	auto const* const begin = bytes.data() + preamble_size + header_size;
+	auto data = std::vector<T>((bytes.size() - preamble_size - header_size) / sizeof(T));
+	std::copy(begin, bytes.data() + bytes.size(), reinterpret_cast<char*>(data.data()));  // NOLINT
+	return data;
+}
+
+fs::path make_tmp_directory() {
+	auto const name = "ecole-trajectory-" + std::to_string(spawn_random_engine()());
+	return fs::temp_directory_path() / name;
+}
+
+trajectory::Record make_record(double reward, std::size_t n_actions) {
+	return {
+		{"reward", xt::xarray<double>(reward)},
+		{"action_set", xt::xarray<std::size_t>::from_shape({n_actions})},
+	};
+}
+
+}  // namespace
+
+TEST_CASE("TrajectoryWriter writes chunks of records", "[trajectory]") {
+	auto const directory = make_tmp_directory();
+
+	SECTION("Records are grouped in chunks") {
+		{
+			auto writer = trajectory::TrajectoryWriter{directory, {2}};
+			for (auto i = 0; i < 3; ++i) {
+				writer.write(make_record(i, 2));
+			}
+		}
+		REQUIRE(fs::exists(directory / "chunk-000000" / "reward.npy"));
+		REQUIRE(fs::exists(directory / "chunk-000001" / "reward.npy"));
+		REQUIRE_FALSE(fs::exists(directory / "chunk-000000" / "reward.offsets.npy"));
+		REQUIRE(read_npy_data<double>(directory / "chunk-000001" / "reward.npy") == std::vector<double>{2.});
+	}
+
+	SECTION("Arrays are concatenated with offsets") {
+		auto writer = trajectory::TrajectoryWriter{directory};
+		writer.write(make_record(0., 3));
+		writer.write(make_record(1., 1));
+		writer.flush();
+		auto const chunk = directory / "chunk-000000";
+		REQUIRE(read_npy_data<double>(chunk / "reward.npy") == std::vector<double>{0., 1.});
+		REQUIRE(read_npy_data<std::uint64_t>(chunk / "action_set.offsets.npy") == std::vector<std::uint64_t>{0, 3, 4});
+		REQUIRE(read_npy_data<std::uint64_t>(chunk / "action_set.npy").size() == 4);
+	}
+
+	SECTION("New writers continue the chunk numbering") {
+		for (auto i = 0; i < 2; ++i) {
+			auto writer = trajectory::TrajectoryWriter{directory};
+			writer.write(make_record(0., 1));
+		}
+		REQUIRE(fs::exists(directory / "chunk-000001"));
+	}
+
+	SECTION("Signed integers are written as such") {
+		auto writer = trajectory::TrajectoryWriter{directory};
+		writer.write({{"action", xt::xarray<std::int64_t>(std::int64_t{-1})}});
+		writer.flush();
+		REQUIRE(read_npy_data<std::int64_t>(directory / "chunk-000000" / "action.npy") == std::vector<std::int64_t>{-1});
+	}
+
+	SECTION("Directories that are not chunks are ignored") {
+		fs::create_directories(directory / "chunk-backup");
+		auto writer = trajectory::TrajectoryWriter{directory};
+		writer.write(make_record(0., 1));
+		writer.flush();
+		REQUIRE(fs::exists(directory / "chunk-000000"));
+	}
+
+	SECTION("Throw on inconsistent records") {
+		auto writer = trajectory::TrajectoryWriter{directory};
+		writer.write(make_record(0., 1));
+		writer.write({{"reward", xt::xarray<std::size_t>(std::size_t{1})}});
+		REQUIRE_THROWS_AS(writer.flush(), Exception);
+	}
+
+	fs::remove_all(directory);
+}
@@ -0,0 +1,35 @@
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/utility/thread-pool.hpp"
+
+using namespace ecole;
+
+TEST_CASE("ThreadPool runs all submitted tasks", "[utility]") {
+	auto counter = std::atomic<int>{0};
+	auto futures = std::vector<std::future<int>>{};
+	{
+		auto pool = utility::ThreadPool{4};
+		REQUIRE(pool.size() == 4);
+		for (int i = 0; i < 100; ++i) {
+			futures.push_back(pool.submit([&counter, i] {
+				++counter;
+				return i;
+			}));
+		}
+	}
+	REQUIRE(counter == 100);
+	for (int i = 0; i < 100; ++i) {
+		REQUIRE(futures[static_cast<std::size_t>(i)].get() == i);
+	}
+}
+
+TEST_CASE("ThreadPool forwards exceptions to futures", "[utility]") {
+	auto pool = utility::ThreadPool{2};
+	auto future = pool.submit([] { throw std::runtime_error{"error"}; });
+	REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+}
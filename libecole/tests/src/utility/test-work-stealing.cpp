@@ -0,0 +1,56 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/utility/work-stealing.hpp"
+
+using namespace ecole;
+
+TEST_CASE("Work stealing runs every task once", "[utility]") {
+	auto const n_tasks = std::size_t{100};
+	auto const n_threads = GENERATE(std::size_t{1}, std::size_t{4}, std::size_t{200});
+	auto counts = std::vector<std::atomic<int>>(n_tasks);
+	auto max_thread = std::atomic<std::size_t>{0};
+	utility::run_work_stealing(n_tasks, n_threads, [&](std::size_t task, std::size_t thread) {
+		++counts[task];
+		auto current = max_thread.load();
+		while (current < thread && !max_thread.compare_exchange_weak(current, thread)) {
+		}
+	});
+	for (auto const& count : counts) {
+		REQUIRE(count == 1);
+	}
+	REQUIRE(max_thread < n_threads);
+}
+
+TEST_CASE("Work stealing balances heterogeneous tasks", "[utility]") {
+	auto const n_tasks = std::size_t{8};
+	auto threads = std::vector<std::size_t>(n_tasks);
+	// The first thread gets the slow task first, its other tasks are stolen by the second thread
+	utility::run_work_stealing(n_tasks, 2, [&threads](std::size_t task, std::size_t thread) {
+		if (task == 0) {
+			std::this_thread::sleep_for(std::chrono::milliseconds{100});  // NOLINT(readability-magic-numbers)
+		}
+		threads[task] = thread;
+	});
+	REQUIRE(threads[1] == 1);
+}
+
+TEST_CASE("Work stealing rethrows the exceptions of tasks", "[utility]") {
+	auto n_run = std::atomic<std::size_t>{0};
+	auto const run = [&n_run] {
+		utility::run_work_stealing(100, 1, [&n_run](std::size_t task, std::size_t /*thread*/) {
+			++n_run;
+			if (task == 10) {
+				throw std::runtime_error{"error"};
+			}
+		});
+	};
+	REQUIRE_THROWS_AS(run(), std::runtime_error);
+	REQUIRE(n_run == 11);
+}
@@ -0,0 +1,69 @@
+import pytest
+
+import ecole
+
+
+GENERATORS = {
+    "SetCover": lambda: ecole.instance.SetCoverGenerator(n_rows=500, n_cols=1000),
+    "CombinatorialAuction": lambda: ecole.instance.CombinatorialAuctionGenerator(
+        n_items=100, n_bids=500
+    ),
+    "CapacitatedFacilityLocation": lambda: ecole.instance.CapacitatedFacilityLocationGenerator(
+        n_customers=100, n_facilities=100
+    ),
+    "IndependentSet": lambda: ecole.instance.IndependentSetGenerator(n_nodes=500),
+}
+
+
+@pytest.mark.parametrize("generator_name", GENERATORS.keys())
+@pytest.mark.benchmark(group="Instance generation")
+def test_generate_instance(benchmark, generator_name):
+    """Number of instances generated per second (default sizes)."""
+    generator = GENERATORS[generator_name]()
+    generator.seed(0)
+    benchmark(next, generator)
+
+
+def reference_generators():
+    """The former Python generators, with the same parameters as GENERATORS."""
+    pytest.importorskip("pyscipopt")
+    from reference.capacitated_facility_location_generator import (
+        CapacitatedFacilityLocationGenerator,
+    )
+    from reference.combinatorial_auction_generator import CombinatorialAuctionGenerator
+    from reference.independent_set_generator import IndependentSetGenerator
+    from reference.set_cover_generator import SetCoverGenerator
+
+    return {
+        "SetCover": lambda: SetCoverGenerator(n_rows=500, n_cols=1000),
+        "CombinatorialAuction": lambda: CombinatorialAuctionGenerator(n_items=100, n_bids=500),
+        "CapacitatedFacilityLocation": lambda: CapacitatedFacilityLocationGenerator(
+            n_customers=100, n_facilities=100
+        ),
+        "IndependentSet": lambda: IndependentSetGenerator(n_nodes=500),
+    }
+
+
+@pytest.mark.parametrize("generator_name", GENERATORS.keys())
+@pytest.mark.benchmark(group="Instance generation")
+def test_generate_instance_python_reference(benchmark, generator_name):
+    """Number of instances generated per second by the former Python generators, for comparison."""
+    generator = reference_generators()[generator_name]()
+    generator.seed(0)
+    benchmark(next, generator)
+
+
+@pytest.mark.parametrize("generator_name", GENERATORS.keys())
+@pytest.mark.benchmark(group="Instance generation and root node")
+@pytest.mark.slow
+def test_generate_and_root_node(benchmark, generator_name):
+    """Generation time compared with the cost of solving the root node."""
+    generator = GENERATORS[generator_name]()
+    generator.seed(0)
+
+    def generate_and_solve_root():
+        model = next(generator)
+        model.set_param("limits/nodes", 1)
+        model.solve()
+
+    benchmark.pedantic(generate_and_solve_root, rounds=5)
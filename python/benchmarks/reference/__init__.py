@@ -0,0 +1,4 @@
+"""Former Python instance generators, kept as a reference for the C++ ones in bench_instance.py.
+
+They build the problems with PyScipOpt, which must be installed.
+"""
@@ -1,6 +1,9 @@
 #define FORCE_IMPORT_ARRAY
 
+#include <cstdint>
 #include <limits>
+#include <sstream>
+#include <string>
 
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
@@ -54,20 +57,46 @@ PYBIND11_MODULE(core, m) {
 
 			Equivalent to calling operator() n times and discarding the result.
 		)")
+		.def("split", &RandomEngine::split, py::arg("id"), R"(
+			Create a new random engine, independent from this one and other ids.
+
+			The new engine only depends on this engine's seed and the id, for instance to derive
+			random engines deterministically in parallel workers.
+		)")
 		.def("__call__", &RandomEngine::operator(), R"(
 			Generate a pseudo-random value.
 
 			The state of the engine is advanced by one position.
 		)")
-		.def(py::self == py::self)   // NOLINT(misc-redundant-expression)  pybind specific syntax
-		.def(py::self != py::self);  // NOLINT(misc-redundant-expression)  pybind specific syntax
+		.def(py::self == py::self)  // NOLINT(misc-redundant-expression)  pybind specific syntax
+		.def(py::self != py::self)  // NOLINT(misc-redundant-expression)  pybind specific syntax
+		.def("__copy__", [](RandomEngine const& self) { return RandomEngine{self}; })
+		.def(
+			"__deepcopy__", [](RandomEngine const& self, py::dict const& /*memo*/) { return RandomEngine{self}; }, py::arg("memo"))
+		.def(py::pickle(
+			[](RandomEngine const& self) {
+				auto stream = std::ostringstream{};
+				stream << self;
+				return stream.str();
+			},
+			[](std::string const& state) {
+				auto stream = std::istringstream{state};
+				auto random_engine = RandomEngine{};
+				stream >> random_engine;
+				return random_engine;
+			}));
 
 	m.def("seed", &ecole::seed, py::arg("val"), "Seed the global source of randomness in Ecole.");
-	m.def("spawn_random_engine", &ecole::spawn_random_engine, R"(
+	m.def("spawn_random_engine", py::overload_cast<>(&ecole::spawn_random_engine), R"(
 		Create new random engine deriving from global source of randomness.
 
 		The global source of randomness is advance so two random engien created successively have different states.
 	)");
+	m.def("spawn_random_engine", py::overload_cast<std::uint64_t>(&ecole::spawn_random_engine), py::arg("id"), R"(
+		Create the random engine of the given id deriving from global source of randomness.
+
+		The engine only depends on the global seed and the id, not on the engines created before.
+	)");
 
 	py::register_exception<ecole::Exception>(m, "Exception");
 
@@ -77,4 +106,8 @@ PYBIND11_MODULE(core, m) {
 	reward::bind_submodule(m.def_submodule("reward"));
 	information::bind_submodule(m.def_submodule("information"));
 	dynamics::bind_submodule(m.def_submodule("dynamics"));
+	instance::bind_submodule(m.def_submodule("instance"));
+	trajectory::bind_submodule(m.def_submodule("trajectory"));
+	instrumentation::bind_submodule(m.def_submodule("instrumentation"));
+	policy::bind_submodule(m.def_submodule("policy"));
 }
@@ -1,11 +1,32 @@
 #pragma once
 
+#include <utility>
+
 #include <pybind11/pybind11.h>
 
+#include "ecole/instrumentation.hpp"
+
 #include "caster.hpp"
 
 namespace ecole {
 
+/**
+ * Wrap a method to call it without the GIL, and time the conversion of its result to Python.
+ *
+ * The conversion is recorded in the ``python_conversion`` stage of the instrumentation.
+ */
+template <typename Self, typename Class, typename Result, typename... Args>
+auto release_and_convert(Result (Class::*method)(Args...)) {
+	return [method](Self& self, Args... args) {
+		auto result = [&] {
+			pybind11::gil_scoped_release const release{};
+			return (self.*method)(std::forward<Args>(args)...);
+		}();
+		return instrumentation::timed(
+			instrumentation::Stage::python_conversion, [&result] { return pybind11::cast(std::move(result)); });
+	};
+}
+
 namespace scip {
 void bind_submodule(pybind11::module_ const& m);
 }
@@ -30,4 +51,20 @@ namespace dynamics {
 void bind_submodule(pybind11::module_ const& m);
 }
 
+namespace instance {
+void bind_submodule(pybind11::module_ const& m);
+}
+
+namespace trajectory {
+void bind_submodule(pybind11::module_ const& m);
+}
+
+namespace instrumentation {
+void bind_submodule(pybind11::module_ const& m);
+}
+
+namespace policy {
+void bind_submodule(pybind11::module_ const& m);
+}
+
 }  // namespace ecole
@@ -1,13 +1,26 @@
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
+#include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <xtensor-python/pytensor.hpp>
 
 #include "ecole/dynamics/branching.hpp"
 #include "ecole/dynamics/configuring.hpp"
+#include "ecole/dynamics/cut-selection.hpp"
+#include "ecole/dynamics/node-selection.hpp"
+#include "ecole/dynamics/parallel-configuring.hpp"
+#include "ecole/dynamics/primal-heuristic.hpp"
+#include "ecole/dynamics/racing-configuring.hpp"
 #include "ecole/scip/model.hpp"
+#include "ecole/scip/param-set.hpp"
 
 #include "core.hpp"
 
@@ -15,26 +28,237 @@ namespace ecole::dynamics {
 
 namespace py = pybind11;
 
-template <typename Dynamics> auto dynamics_class(py::module_ const& m, char const* name) {
-	return py::class_<Dynamics>(m, name)  //
-		.def("reset_dynamics", &Dynamics::reset_dynamics, py::arg("model"), py::call_guard<py::gil_scoped_release>())
-		.def(
-			"step_dynamics",
-			&Dynamics::step_dynamics,
-			py::arg("model"),
-			py::arg("action"),
-			py::call_guard<py::gil_scoped_release>())
+template <typename Dynamics> auto dynamics_class(py::module_ const& m, char const* name, char const* doc = "") {
+	return py::class_<Dynamics>(m, name, doc)  //
+		.def("reset_dynamics", release_and_convert<Dynamics>(&Dynamics::reset_dynamics), py::arg("model"))
+		.def("step_dynamics", release_and_convert<Dynamics>(&Dynamics::step_dynamics), py::arg("model"), py::arg("action"))
 		.def("set_dynamics_random_state", &Dynamics::set_dynamics_random_state, py::arg("model"), py::arg("random_engine"));
 }
 
+namespace {
+
+/**
+ * A read-only NumPy view of a buffer, sharing its ownership.
+ *
+ * The array keeps the buffer alive if the dynamics replace it, but its values are overwritten otherwise.
+ */
+template <typename T>
+auto shared_view(nonstd::span<T const> view, std::shared_ptr<std::vector<T> const> buffer) -> py::array_t<T> {
+	using Owner = std::shared_ptr<std::vector<T> const>;
+	auto const base = py::capsule{
+		new Owner{std::move(buffer)},  // NOLINT(cppcoreguidelines-owning-memory)
+		[](void* owner) { delete static_cast<Owner*>(owner); }};  // NOLINT(cppcoreguidelines-owning-memory)
+	auto array = py::array_t<T>(static_cast<py::ssize_t>(view.size()), view.data(), base);
+	array.attr("flags").attr("writeable") = false;
+	return array;
+}
+
+/** Convert a transition of BranchingDynamics, with the action set as a view of the candidate buffer. */
+auto branching_result(BranchingDynamics const& self, std::tuple<bool, BranchingDynamics::ActionSet> const& result) {
+	return instrumentation::timed(instrumentation::Stage::python_conversion, [&self, &result] {
+		auto const& [done, action_set] = result;
+		if (!action_set.has_value()) {
+			return py::make_tuple(done, py::none());
+		}
+		return py::make_tuple(done, shared_view(action_set.value(), self.candidate_indices_buffer()));
+	});
+}
+
+}  // namespace
+
 void bind_submodule(pybind11::module_ const& m) {
 	m.doc() = "Ecole collection of environment dynamics.";
 
-	dynamics_class<BranchingDynamics>(m, "BranchingDynamics")  //
-		.def(py::init<bool>(), py::arg("pseudo_candidates") = false);
+	py::class_<BranchingDynamics>(m, "BranchingDynamics")  //
+		.def(py::init<bool>(), py::arg("pseudo_candidates") = false)
+		.def(
+			"reset_dynamics",
+			[](BranchingDynamics& self, scip::Model& model) {
+				auto result = [&] {
+					py::gil_scoped_release const release{};
+					return self.reset_dynamics(model);
+				}();
+				return branching_result(self, result);
+			},
+			py::arg("model"))
+		.def(
+			"step_dynamics",
+			[](BranchingDynamics& self, scip::Model& model, std::size_t action) {
+				auto result = [&] {
+					py::gil_scoped_release const release{};
+					return self.step_dynamics(model, action);
+				}();
+				return branching_result(self, result);
+			},
+			py::arg("model"),
+			py::arg("action"))
+		.def(
+			"set_dynamics_random_state",
+			&BranchingDynamics::set_dynamics_random_state,
+			py::arg("model"),
+			py::arg("random_engine"))
+		.def_property_readonly(
+			"candidate_indices",
+			[](BranchingDynamics const& self) {
+				return shared_view(self.candidate_indices(), self.candidate_indices_buffer());
+			},
+			R"(
+			The branching candidates as LP column indices.
+
+			This is a read-only view, without copy, of a buffer overwritten on the next transition.
+			The action set returned by the transitions is the same view.
+			)")
+		.def_property_readonly(
+			"candidate_mask",
+			[](BranchingDynamics const& self) { return shared_view(self.candidate_mask(), self.candidate_mask_buffer()); },
+			R"(
+			An int32 array with one element per LP column, set to one for branching candidates.
 
-	dynamics_class<ConfiguringDynamics>(m, "ConfiguringDynamics")  //
+			This is a read-only view, without copy, of a buffer updated in place on the next
+			transition.
+			It can be used to mask the policy outputs directly.
+			)");
+
+	dynamics_class<BatchedBranchingDynamics>(m, "BatchedBranchingDynamics", R"(
+		Branching dynamics where one action is reused over many nodes.
+
+		The action is a ranking of LP column indices, from the highest to the lowest priority.
+		The node is branched on the highest ranked branching candidate.
+		The following nodes are branched the same way, without returning to the agent, as long as
+		all their branching candidates are in the ranking, and for at most ``refresh_interval``
+		nodes in total (or without limit if zero).
+		This amortizes the cost of the policy over many nodes.
+	)")
+		.def(
+			py::init<bool, std::size_t>(),
+			py::arg("pseudo_candidates") = false,
+			py::arg("refresh_interval") = BatchedBranchingDynamics{}.refresh_interval)
+		.def_readwrite("refresh_interval", &BatchedBranchingDynamics::refresh_interval)
+		.def_property_readonly("n_last_branchings", &BatchedBranchingDynamics::n_last_branchings);
+
+	dynamics_class<NodeSelectionDynamics>(m, "NodeSelectionDynamics", R"(
+		Select the next node to process in the branch-and-bound tree.
+
+		The action set holds the indices of the open nodes, and the action is one of these indices.
+		Open nodes are ordered as the leaves, then the children, and then the siblings of the current
+		node, that is in the same order as ``getOpenNodes`` in PySCIPOpt.
+	)")
 		.def(py::init<>());
+
+	dynamics_class<PrimalHeuristicDynamics>(m, "PrimalHeuristicDynamics", R"(
+		Schedule the primal heuristics run at the nodes of the branch-and-bound tree.
+
+		The solver pauses before processing the nodes whose depth is a multiple of the frequency.
+		The action set is the list of names of the heuristics that can be scheduled.
+		The action is a dictionary mapping heuristic names to an effort budget.
+		Heuristics that are omitted, or with a non positive budget, do not run.
+		The others run at every node until the next decision.
+		For diving heuristics, the budget is the maximal fraction of LP iterations (``maxlpiterquot``).
+		For large neighborhood search heuristics, it is the fraction of sub-SCIP nodes
+		(``nodesquot``).
+	)")
+		.def(py::init<int>(), py::arg("frequency") = 1)
+		.def_readwrite("frequency", &PrimalHeuristicDynamics::frequency);
+
+	dynamics_class<CutSelectionDynamics>(m, "CutSelectionDynamics", R"(
+		Select the cuts added to the LP among the cuts found by the separators.
+
+		The solver pauses at every separation round where the separators have found cuts.
+		The action set holds the indices of the cuts, and the action is a boolean mask over the
+		cuts, where the cuts to add to the LP are true.
+		Selected cuts are forced into the LP, bypassing the cut selection of SCIP.
+	)")
+		.def(py::init<>());
+
+	dynamics_class<ConfiguringDynamics>(m, "ConfiguringDynamics")  //
+		.def(py::init<>())
+		.def(
+			"step_dynamics",
+			[](ConfiguringDynamics& self, scip::Model& model, scip::ParamSet const& param_set) {
+				param_set.apply(model);
+				return self.step_dynamics(model, {});
+			},
+			py::arg("model"),
+			py::arg("action"),
+			py::call_guard<py::gil_scoped_release>());
+
+	dynamics_class<RacingConfiguringDynamics>(m, "RacingConfiguringDynamics", R"(
+		Race many configurations of the solver and keep the best one.
+
+		The action is a list of candidate parameter sets.
+		Every configuration is solved on its own copy of the instance in lockstep time slices.
+		After every slice, the candidates are compared on their primal-dual gap and only the best
+		fraction is resumed.
+		At the end of the step, the model is replaced by the winning copy.
+	)")
+		.def(
+			py::init<scip::real, scip::real, std::size_t>(),
+			py::arg("time_slice") = 1.,
+			py::arg("keep_fraction") = 0.5,
+			py::arg("n_threads") = 0,
+			R"(
+			Configure the race.
+
+			Parameters
+			----------
+			time_slice:
+				The wall clock time, in seconds, given to the candidates between every comparison.
+			keep_fraction:
+				The fraction of candidates resumed after every comparison.
+			n_threads:
+				The number of concurrent solves, or the number of cores if zero.
+			)")
+		.def_property_readonly("winner", &RacingConfiguringDynamics::winner)
+		.def_property_readonly("n_rounds", &RacingConfiguringDynamics::n_rounds)
+		.def_property_readonly("time_slice", &RacingConfiguringDynamics::time_slice)
+		.def_property_readonly("keep_fraction", &RacingConfiguringDynamics::keep_fraction);
+
+	py::class_<ParallelConfiguringDynamics>(m, "ParallelConfiguringDynamics", R"(
+		Solve many configurations of the same problem concurrently.
+
+		Every model is solved with its own parameter set on a pool of threads.
+		With racing enabled, once a first run is solved in time ``t``, the runs still going after
+		``race_factor * t`` (measured from their own start) are interrupted.
+	)")
+		.def(
+			py::init<std::size_t, std::optional<double>>(),
+			py::arg("n_threads") = 0,
+			py::arg("race_factor") = py::none(),
+			R"(
+			Create the pool of threads.
+
+			Parameters
+			----------
+			n_threads:
+				The number of concurrent solves, or the number of cores if zero.
+			race_factor:
+				If set, interrupt the runs slower than this factor times the fastest run.
+			)")
+		.def(
+			"set_dynamics_random_state",
+			&ParallelConfiguringDynamics::set_dynamics_random_state,
+			py::arg("model"),
+			py::arg("random_engine"))
+		.def(
+			"solve_all",
+			&ParallelConfiguringDynamics::solve_all,
+			py::arg("models"),
+			py::arg("param_sets"),
+			py::arg("before_solve") = py::none(),
+			py::arg("after_solve") = py::none(),
+			py::call_guard<py::gil_scoped_release>(),
+			R"(
+			Apply every parameter set on its model and solve all models concurrently.
+
+			The optional hooks are called with the index of the run in the worker threads, respectively
+			before the parameters are applied and after the model is solved.
+
+			Returns
+			-------
+			completed:
+				For every run, whether it completed, *i.e.* was not eliminated by racing.
+			)")
+		.def_property_readonly("race_factor", &ParallelConfiguringDynamics::race_factor);
 }
 
 }  // namespace ecole::dynamics
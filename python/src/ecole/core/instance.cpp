@@ -0,0 +1,507 @@
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/capacitated-facility-location.hpp"
+#include "ecole/instance/combinatorial-auction.hpp"
+#include "ecole/instance/independent-set.hpp"
+#include "ecole/instance/pipeline.hpp"
+#include "ecole/instance/set-cover.hpp"
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+
+#include "core.hpp"
+
+namespace ecole::instance {
+
+namespace py = pybind11;
+
+namespace {
+
+/**
+ * Bind the iterator protocol common to all generators.
+ */
+template <typename Generator> auto generator_class(py::module_ const& m, char const* name, char const* doc) {
+	return py::class_<Generator>(m, name, doc)  //
+		.def("__iter__", [](Generator& self) -> Generator& { return self; }, py::return_value_policy::reference)
+		.def("__next__", &Generator::next, py::call_guard<py::gil_scoped_release>(), R"(
+			Generate the next instance.
+
+			The generator parameters given in the constructor are used along with the generator
+			random state.
+		)")
+		.def("seed", &Generator::seed, py::arg("seed"), "Seed the random engine of the generator.");
+}
+
+auto graph_type_from_str(std::string const& graph_type) {
+	using GraphType = IndependentSetGenerator::GraphType;
+	if (graph_type == "barabasi_albert") {
+		return GraphType::barabasi_albert;
+	}
+	if (graph_type == "erdos_renyi") {
+		return GraphType::erdos_renyi;
+	}
+	throw Exception("Unknown graph type '" + graph_type + "'");
+}
+
+std::string graph_type_to_str(IndependentSetGenerator::GraphType graph_type) {
+	using GraphType = IndependentSetGenerator::GraphType;
+	switch (graph_type) {
+	case GraphType::barabasi_albert:
+		return "barabasi_albert";
+	case GraphType::erdos_renyi:
+		return "erdos_renyi";
+	default:
+		throw Exception("Unknown graph type");
+	}
+}
+
+/**
+ * Generate instances by calling ``next`` on a Python iterator.
+ *
+ * The random engine is not used as the iterator holds its own random state.
+ */
+class PyIteratorGenerate {
+public:
+	PyIteratorGenerate(py::object const& iterable) :
+		iterator{new py::object{py::iter(iterable)}, [](py::object* ptr) {
+							 // Can be deleted from a pipeline thread
+							 py::gil_scoped_acquire const gil{};
+							 delete ptr;  // NOLINT(cppcoreguidelines-owning-memory)
+						 }} {}
+
+	scip::Model operator()(RandomEngine& /*random_engine*/) const {
+		py::gil_scoped_acquire const gil{};
+		auto obj = iterator->attr("__next__")();
+		auto model_ptr = obj.cast<std::shared_ptr<scip::Model>>();
+		// Only steal the model if nobody else can see it, otherwise copy it
+		if ((obj.ref_count() == 1) && (model_ptr.use_count() == 2)) {
+			return std::move(*model_ptr);
+		}
+		return model_ptr->copy_orig();
+	}
+
+private:
+	std::shared_ptr<py::object> iterator;
+};
+
+/**
+ * Deleter releasing the GIL while the pipeline threads are joined.
+ */
+struct PipelineDeleter {
+	void operator()(InstancePipeline* ptr) const {
+		py::gil_scoped_release const release{};
+		delete ptr;  // NOLINT(cppcoreguidelines-owning-memory)
+	}
+};
+
+template <typename Generator>
+auto make_native_pipeline(py::object const& generator, InstancePipeline::Options const& options, Seed seed)
+	-> InstancePipeline* {
+	return new InstancePipeline(  // NOLINT(cppcoreguidelines-owning-memory)
+		InstancePipeline::from_generator(generator.cast<Generator const&>(), options, seed));
+}
+
+auto make_pipeline(py::object const& generator, InstancePipeline::Options options, std::optional<Seed> maybe_seed)
+	-> InstancePipeline* {
+	auto const seed = maybe_seed.has_value() ? maybe_seed.value() : spawn_random_engine()();
+	if (py::isinstance<SetCoverGenerator>(generator)) {
+		return make_native_pipeline<SetCoverGenerator>(generator, options, seed);
+	}
+	if (py::isinstance<CombinatorialAuctionGenerator>(generator)) {
+		return make_native_pipeline<CombinatorialAuctionGenerator>(generator, options, seed);
+	}
+	if (py::isinstance<CapacitatedFacilityLocationGenerator>(generator)) {
+		return make_native_pipeline<CapacitatedFacilityLocationGenerator>(generator, options, seed);
+	}
+	if (py::isinstance<IndependentSetGenerator>(generator)) {
+		return make_native_pipeline<IndependentSetGenerator>(generator, options, seed);
+	}
+	// A shared Python iterator must be called sequentially for the order of instances to be deterministic
+	options.n_threads = 1;
+	return new InstancePipeline{PyIteratorGenerate{generator}, options, seed};  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+}  // namespace
+
+void bind_submodule(py::module_ const& m) {
+	m.doc() = "Generators of random instances of combinatorial optimization problems.";
+
+	using SetCover = SetCoverGenerator;
+	auto constexpr set_cover_defaults = SetCover::Parameters{};
+	generator_class<SetCover>(m, "SetCoverGenerator", R"(
+		Generate set cover problems.
+
+		Algorithm described in:
+			E.Balas and A.Ho, Set covering algorithms using cutting planes, heuristics,
+			and subgradient optimization: A computational study, Mathematical
+			Programming, 12 (1980), 37-60.
+	)")
+		.def(
+			py::init([](std::size_t n_rows, std::size_t n_cols, double density, std::size_t max_coef) {
+				return SetCover{{n_rows, n_cols, density, max_coef}};
+			}),
+			py::arg("n_rows") = set_cover_defaults.n_rows,
+			py::arg("n_cols") = set_cover_defaults.n_cols,
+			py::arg("density") = set_cover_defaults.density,
+			py::arg("max_coef") = set_cover_defaults.max_coef,
+			R"(
+			Constructor for the set cover generator.
+
+			Parameters
+			----------
+			n_rows:
+				The number of rows.
+			n_cols:
+				The number of columns.
+			density:
+				The density of the constraint matrix.
+				The value must be in the range (0,1].
+			max_coef:
+				Maximum objective coefficient.
+				The value must be >= 1.
+		)")
+		.def_static(
+			"generate_instance",
+			[](std::size_t n_rows, std::size_t n_cols, double density, std::size_t max_coef, RandomEngine& random_engine) {
+				return SetCover::generate_instance({n_rows, n_cols, density, max_coef}, random_engine);
+			},
+			py::arg("n_rows"),
+			py::arg("n_cols"),
+			py::arg("density"),
+			py::arg("max_coef"),
+			py::arg("random_engine"),
+			py::call_guard<py::gil_scoped_release>(),
+			R"(
+			Generate an instance with the given parameters, drawing randomness from ``random_engine``.
+
+			The last argument is an :py:class:`ecole.RandomEngine` named ``random_engine``, which replaces
+			the ``rng`` ``numpy.random.RandomState`` of the former Python generators.
+		)")
+		.def_property_readonly("n_rows", [](SetCover const& self) { return self.get_parameters().n_rows; })
+		.def_property_readonly("n_cols", [](SetCover const& self) { return self.get_parameters().n_cols; })
+		.def_property_readonly("density", [](SetCover const& self) { return self.get_parameters().density; })
+		.def_property_readonly("max_coef", [](SetCover const& self) { return self.get_parameters().max_coef; });
+
+	using Auction = CombinatorialAuctionGenerator;
+	auto constexpr auction_defaults = Auction::Parameters{};
+	generator_class<Auction>(m, "CombinatorialAuctionGenerator", R"(
+		Generate combinatorial auction problems.
+
+		Algorithm described in:
+			Kevin Leyton-Brown, Mark Pearson, and Yoav Shoham. (2000).
+			Towards a universal test suite for combinatorial auction algorithms.
+			Proceedings of ACM Conference on Electronic Commerce (EC-00) 66-76.
+		Section 4.3., the 'arbitrary' scheme.
+	)")
+		.def(
+			py::init([](std::size_t n_items,
+									std::size_t n_bids,
+									double min_value,
+									double max_value,
+									double value_deviation,
+									double add_item_prob,
+									std::size_t max_n_sub_bids,
+									double additivity,
+									double budget_factor,
+									double resale_factor,
+									bool integers) {
+				return Auction{{
+					n_items,
+					n_bids,
+					min_value,
+					max_value,
+					value_deviation,
+					add_item_prob,
+					max_n_sub_bids,
+					additivity,
+					budget_factor,
+					resale_factor,
+					integers,
+				}};
+			}),
+			py::arg("n_items") = auction_defaults.n_items,
+			py::arg("n_bids") = auction_defaults.n_bids,
+			py::arg("min_value") = auction_defaults.min_value,
+			py::arg("max_value") = auction_defaults.max_value,
+			py::arg("value_deviation") = auction_defaults.value_deviation,
+			py::arg("add_item_prob") = auction_defaults.add_item_prob,
+			py::arg("max_n_sub_bids") = auction_defaults.max_n_sub_bids,
+			py::arg("additivity") = auction_defaults.additivity,
+			py::arg("budget_factor") = auction_defaults.budget_factor,
+			py::arg("resale_factor") = auction_defaults.resale_factor,
+			py::arg("integers") = auction_defaults.integers,
+			R"(
+			Constructor for the combinatorial auction generator.
+
+			Parameters
+			----------
+			n_items:
+				The number of items.
+			n_bids:
+				The number of bids.
+			min_value:
+				The minimum resale value for an item.
+			max_value:
+				The maximum resale value for an item.
+			value_deviation:
+				The deviation allowed for each bidder's private value of an item, relative from max_value.
+			add_item_prob:
+				The probability of adding a new item to an existing bundle.
+				This parameters must be in the range [0,1].
+			max_n_sub_bids:
+				The maximum number of substitutable bids per bidder (+1 gives the maximum number of bids per bidder).
+			additivity:
+				Additivity parameter for bundle prices. Note that additivity < 0 gives sub-additive bids,
+				while additivity > 0 gives super-additive bids.
+			budget_factor:
+				The budget factor for each bidder, relative to their initial bid's price.
+			resale_factor:
+				The resale factor for each bidder, relative to their initial bid's resale value.
+			integers:
+				Determines if the bid prices should be integral.
+		)")
+		.def_static(
+			"generate_instance",
+			[](std::size_t n_items,
+				 std::size_t n_bids,
+				 double min_value,
+				 double max_value,
+				 double value_deviation,
+				 double add_item_prob,
+				 std::size_t max_n_sub_bids,
+				 double additivity,
+				 double budget_factor,
+				 double resale_factor,
+				 bool integers,
+				 RandomEngine& random_engine) {
+				return Auction::generate_instance(
+					{
+						n_items,
+						n_bids,
+						min_value,
+						max_value,
+						value_deviation,
+						add_item_prob,
+						max_n_sub_bids,
+						additivity,
+						budget_factor,
+						resale_factor,
+						integers,
+					},
+					random_engine);
+			},
+			py::arg("n_items"),
+			py::arg("n_bids"),
+			py::arg("min_value"),
+			py::arg("max_value"),
+			py::arg("value_deviation"),
+			py::arg("add_item_prob"),
+			py::arg("max_n_sub_bids"),
+			py::arg("additivity"),
+			py::arg("budget_factor"),
+			py::arg("resale_factor"),
+			py::arg("integers"),
+			py::arg("random_engine"),
+			py::call_guard<py::gil_scoped_release>(),
+			R"(
+			Generate an instance with the given parameters, drawing randomness from ``random_engine``.
+
+			The last argument is an :py:class:`ecole.RandomEngine` named ``random_engine``, which replaces
+			the ``rng`` ``numpy.random.RandomState`` of the former Python generators.
+		)")
+		.def_property_readonly("n_items", [](Auction const& self) { return self.get_parameters().n_items; })
+		.def_property_readonly("n_bids", [](Auction const& self) { return self.get_parameters().n_bids; })
+		.def_property_readonly("min_value", [](Auction const& self) { return self.get_parameters().min_value; })
+		.def_property_readonly("max_value", [](Auction const& self) { return self.get_parameters().max_value; })
+		.def_property_readonly(
+			"value_deviation", [](Auction const& self) { return self.get_parameters().value_deviation; })
+		.def_property_readonly("add_item_prob", [](Auction const& self) { return self.get_parameters().add_item_prob; })
+		.def_property_readonly("max_n_sub_bids", [](Auction const& self) { return self.get_parameters().max_n_sub_bids; })
+		.def_property_readonly("additivity", [](Auction const& self) { return self.get_parameters().additivity; })
+		.def_property_readonly("budget_factor", [](Auction const& self) { return self.get_parameters().budget_factor; })
+		.def_property_readonly("resale_factor", [](Auction const& self) { return self.get_parameters().resale_factor; })
+		.def_property_readonly("integers", [](Auction const& self) { return self.get_parameters().integers; });
+
+	using Facility = CapacitatedFacilityLocationGenerator;
+	auto constexpr facility_defaults = Facility::Parameters{};
+	generator_class<Facility>(m, "CapacitatedFacilityLocationGenerator", R"(
+		Generate capacitated facility location problems.
+
+		Algorithm described in:
+			Cornuejols G, Sridharan R, Thizy J-M (1991)
+			A Comparison of Heuristics and Relaxations for the Capacitated Plant Location Problem.
+			European Journal of Operations Research 50:280-297.
+	)")
+		.def(
+			py::init([](std::size_t n_customers, std::size_t n_facilities, double ratio) {
+				return Facility{{n_customers, n_facilities, ratio}};
+			}),
+			py::arg("n_customers") = facility_defaults.n_customers,
+			py::arg("n_facilities") = facility_defaults.n_facilities,
+			py::arg("ratio") = facility_defaults.ratio,
+			R"(
+			Constructor for the capacitated facility location generator.
+
+			Parameters
+			----------
+			n_customers:
+				The number of customers.
+			n_facilities:
+				The number of facilities.
+			ratio:
+				The ratio of capacity/demand.
+		)")
+		.def_static(
+			"generate_instance",
+			[](std::size_t n_customers, std::size_t n_facilities, double ratio, RandomEngine& random_engine) {
+				return Facility::generate_instance({n_customers, n_facilities, ratio}, random_engine);
+			},
+			py::arg("n_customers"),
+			py::arg("n_facilities"),
+			py::arg("ratio"),
+			py::arg("random_engine"),
+			py::call_guard<py::gil_scoped_release>(),
+			R"(
+			Generate an instance with the given parameters, drawing randomness from ``random_engine``.
+
+			The last argument is an :py:class:`ecole.RandomEngine` named ``random_engine``, which replaces
+			the ``rng`` ``numpy.random.RandomState`` of the former Python generators.
+		)")
+		.def_property_readonly("n_customers", [](Facility const& self) { return self.get_parameters().n_customers; })
+		.def_property_readonly("n_facilities", [](Facility const& self) { return self.get_parameters().n_facilities; })
+		.def_property_readonly("ratio", [](Facility const& self) { return self.get_parameters().ratio; });
+
+	using IndependentSet = IndependentSetGenerator;
+	auto constexpr independent_set_defaults = IndependentSet::Parameters{};
+	generator_class<IndependentSet>(m, "IndependentSetGenerator", R"(
+		Generate maximum independent set problems.
+
+		The graph is randomly generated and the constraints are strengthened using a greedy clique
+		partition of the graph.
+	)")
+		.def(
+			py::init([](std::size_t n_nodes, double edge_probability, std::size_t affinity, std::string const& graph_type) {
+				return IndependentSet{{n_nodes, edge_probability, affinity, graph_type_from_str(graph_type)}};
+			}),
+			py::arg("n_nodes") = independent_set_defaults.n_nodes,
+			py::arg("edge_probability") = independent_set_defaults.edge_probability,
+			py::arg("affinity") = independent_set_defaults.affinity,
+			py::arg("graph_type") = graph_type_to_str(independent_set_defaults.graph_type),
+			R"(
+			Constructor for the independent set generator.
+
+			Parameters
+			----------
+			n_nodes:
+				The number of nodes in the graph.
+			edge_probability:
+				The probability of generating each edge.
+				This parameter must be in the range [0, 1].
+				This parameter will only be used if graph_type = "erdos_renyi".
+			affinity:
+				The number of nodes each new node will be attached to, in the sampling scheme.
+				This parameter must be an integer >= 1.
+				This parameter will only be used if graph_type = "barabasi_albert".
+			graph_type:
+				The method used in which to generate graphs.  One of "barabasi_albert" or "erdos_renyi".
+		)")
+		.def_static(
+			"generate_instance",
+			[](std::size_t n_nodes,
+				 double edge_probability,
+				 std::size_t affinity,
+				 std::string const& graph_type,
+				 RandomEngine& random_engine) {
+				auto const parameters = IndependentSet::Parameters{
+					n_nodes, edge_probability, affinity, graph_type_from_str(graph_type)};
+				py::gil_scoped_release const release{};
+				return IndependentSet::generate_instance(parameters, random_engine);
+			},
+			py::arg("n_nodes"),
+			py::arg("edge_probability"),
+			py::arg("affinity"),
+			py::arg("graph_type"),
+			py::arg("random_engine"),
+			R"(
+			Generate an instance with the given parameters, drawing randomness from ``random_engine``.
+
+			The last argument is an :py:class:`ecole.RandomEngine` named ``random_engine``, which replaces
+			the ``rng`` ``numpy.random.RandomState`` of the former Python generators.
+		)")
+		.def_property_readonly("n_nodes", [](IndependentSet const& self) { return self.get_parameters().n_nodes; })
+		.def_property_readonly(
+			"edge_probability", [](IndependentSet const& self) { return self.get_parameters().edge_probability; })
+		.def_property_readonly("affinity", [](IndependentSet const& self) { return self.get_parameters().affinity; })
+		.def_property_readonly(
+			"graph_type", [](IndependentSet const& self) { return graph_type_to_str(self.get_parameters().graph_type); });
+
+	auto constexpr pipeline_defaults = InstancePipeline::Options{};
+	py::class_<InstancePipeline, std::unique_ptr<InstancePipeline, PipelineDeleter>>(m, "InstancePipeline", R"(
+		Generate instances ahead of time on background threads.
+
+		Instances are produced into a bounded buffer so that getting the next instance, for instance
+		before resetting an environment, does not wait on instance creation.
+
+		With Ecole generators, the instances only depend on the seed of the pipeline, and not on the
+		number of threads.
+		Any other iterator of ``ecole.scip.Model`` can be wrapped, in which case it is called on a
+		single background thread (holding the GIL), and seeding the pipeline has no effect on the
+		instances.
+	)")
+		.def(
+			py::init([](py::object const& generator,
+									std::size_t buffer_size,
+									std::size_t n_threads,
+									bool copy_orig,
+									bool presolve,
+									std::optional<Seed> seed) {
+				return make_pipeline(generator, {buffer_size, n_threads, copy_orig, presolve}, seed);
+			}),
+			py::arg("generator"),
+			py::arg("buffer_size") = pipeline_defaults.buffer_size,
+			py::arg("n_threads") = pipeline_defaults.n_threads,
+			py::arg("copy_orig") = pipeline_defaults.copy_orig,
+			py::arg("presolve") = pipeline_defaults.presolve,
+			py::arg("seed") = py::none(),
+			R"(
+			Start generating instances in the background.
+
+			Parameters
+			----------
+			generator:
+				An Ecole instance generator, or any iterator of ``ecole.scip.Model``.
+				The parameters of Ecole generators are copied.
+			buffer_size:
+				Maximum number of instances generated ahead of time.
+			n_threads:
+				Number of background threads, or the number of cores if zero.
+			copy_orig:
+				Replace generated instances by a copy of their original problem.
+			presolve:
+				Presolve the instances ahead of time.
+				Parameters impacting presolving must then be set by the generator.
+			seed:
+				Seed of the sequence of instances, otherwise derived from Ecole's global random state.
+		)")
+		.def_property_readonly(
+			"presolve", [](InstancePipeline const& self) { return self.get_options().presolve; }, R"(
+			Whether the instances are presolved ahead of time.
+		)")
+		.def("__iter__", [](InstancePipeline& self) -> InstancePipeline& { return self; }, py::return_value_policy::reference)
+		.def("__next__", &InstancePipeline::next, py::call_guard<py::gil_scoped_release>(), R"(
+			Get the next instance, waiting for it only if it was not already generated.
+		)")
+		.def("seed", &InstancePipeline::seed, py::arg("seed"), py::call_guard<py::gil_scoped_release>(), R"(
+			Restart the sequence of instances from a new seed.
+
+			Instances already generated are discarded.
+		)");
+}
+
+}  // namespace ecole::instance
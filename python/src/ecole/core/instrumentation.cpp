@@ -0,0 +1,124 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+#include "ecole/instrumentation.hpp"
+
+#include "core.hpp"
+
+namespace ecole::instrumentation {
+
+namespace py = pybind11;
+
+namespace {
+
+/** Statistics that can record the timers of the current thread in ``with`` blocks. */
+struct PyEpisodeStats {
+	EpisodeStats stats;
+	/** One recording per nested ``with`` block, ended in reverse order. */
+	std::vector<std::unique_ptr<ScopedRecording>> recordings;
+};
+
+/** Time a ``with`` block in the statistics of the current thread. */
+struct PyTimer {
+	Stage stage;
+	std::unique_ptr<ScopedTimer> timer;
+	std::unique_ptr<ScopedTrace> trace;
+};
+
+}  // namespace
+
+void bind_submodule(py::module_ const& m) {
+	m.doc() = "Timers of the stages of the environments.";
+
+	m.attr("enabled") = enabled;
+
+	auto stage = py::enum_<Stage>(m, "Stage", "The timed parts of the environment.");
+	for (auto i = std::size_t{0}; i < n_stages; ++i) {
+		auto const value = static_cast<Stage>(i);
+		stage.value(std::string{stage_name(value)}.c_str(), value);
+	}
+
+	py::class_<PyTimer>(m, "Timer", "Time a ``with`` block in the statistics recorded by the current thread.")
+		.def(py::init([](Stage stage_) { return PyTimer{stage_, nullptr, nullptr}; }), py::arg("stage"))
+		.def(
+			"__enter__",
+			[](PyTimer& self) -> PyTimer& {
+				if constexpr (enabled) {
+					self.timer = std::make_unique<ScopedTimer>(self.stage);
+					self.trace = std::make_unique<ScopedTrace>(self.stage);
+				}
+				return self;
+			},
+			py::return_value_policy::reference)
+		.def("__exit__", [](PyTimer& self, py::args const& /*args*/) {
+			self.trace.reset();
+			self.timer.reset();
+		});
+
+	py::class_<PyEpisodeStats>(m, "EpisodeStats", R"(
+		Timers of the stages of an episode.
+
+		Timers are only recorded if Ecole was compiled with ``ECOLE_INSTRUMENTATION``, in which
+		case :py:data:`enabled` is true.
+		The timers of the current thread are recorded inside a ``with`` block on this object.
+	)")
+		.def(py::init<>())
+		.def("clear", [](PyEpisodeStats& self) { self.stats.clear(); }, "Reset all timers to zero.")
+		.def(
+			"as_dict",
+			[](PyEpisodeStats const& self) {
+				auto result = py::dict{};
+				for (auto i = std::size_t{0}; i < n_stages; ++i) {
+					auto const value = static_cast<Stage>(i);
+					auto const& timer = self.stats[value];
+					auto entry = py::dict{};
+					entry["total_time"] = std::chrono::duration<double>{timer.total}.count();
+					entry["count"] = timer.count;
+					result[py::str{std::string{stage_name(value)}}] = entry;
+				}
+				return result;
+			},
+			"Return the total time in seconds and the number of measures of every stage.")
+		.def(
+			"__enter__",
+			[](PyEpisodeStats& self) -> PyEpisodeStats& {
+				if constexpr (enabled) {
+					self.recordings.push_back(std::make_unique<ScopedRecording>(self.stats));
+				}
+				return self;
+			},
+			py::return_value_policy::reference)
+		.def("__exit__", [](PyEpisodeStats& self, py::args const& /*args*/) {
+			if constexpr (enabled) {
+				self.recordings.pop_back();
+			}
+		});
+
+	m.def("start_tracing", &start_tracing, py::arg("capacity") = default_trace_capacity, R"(
+		Start recording trace events, discarding events previously recorded.
+
+		Every thread records the begin and end of the stages of the environments, of the reverse
+		callbacks of the solver, and of the handoffs between the environment and the solving thread.
+		Events are kept in a ring buffer per thread, holding the last ``capacity`` events.
+		Only available if :py:data:`enabled` is true, otherwise nothing is recorded.
+	)");
+	m.def("stop_tracing", &stop_tracing, "Stop recording trace events, keeping the ones recorded.");
+	m.def("tracing", &tracing, "Whether trace events are being recorded.");
+	m.def(
+		"write_trace",
+		py::overload_cast<std::string const&>(&write_trace),
+		py::arg("filename"),
+		py::call_guard<py::gil_scoped_release>(),
+		R"(
+		Write the recorded events in a Chrome trace event JSON file.
+
+		The file can be opened in ``chrome://tracing`` or in Perfetto.
+		Events should be written after tracing is stopped.
+	)");
+}
+
+}  // namespace ecole::instrumentation
@@ -1,12 +1,16 @@
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <xtensor-python/pytensor.hpp>
 
+#include "ecole/observation/cutpool.hpp"
+#include "ecole/observation/heuristicstats.hpp"
 #include "ecole/observation/khalil-2016.hpp"
 #include "ecole/observation/nodebipartite.hpp"
 #include "ecole/observation/nothing.hpp"
@@ -37,12 +41,12 @@ template <typename PyClass, typename... Args> auto def_before_reset(PyClass pycl
  * Helper function to bind the `extract` method of observation functions.
  */
 template <typename PyClass, typename... Args> auto def_extract(PyClass pyclass, Args&&... args) {
+	using Function = typename PyClass::type;
 	return pyclass.def(
 		"extract",
-		&PyClass::type::extract,
+		release_and_convert<Function>(&Function::extract),
 		py::arg("model"),
 		py::arg("done"),
-		py::call_guard<py::gil_scoped_release>(),
 		std::forward<Args>(args)...);
 }
 
@@ -138,10 +142,75 @@ void bind_submodule(py::module_ const& m) {
 
 		This observation function extract structured :py:class:`NodeBipartiteObs`.
 	)");
-	node_bipartite.def(py::init<>());
+	py::enum_<NodeBipartiteObs::ColumnFeatureGroup>(node_bipartite, "ColumnFeatureGroup")
+		.value("bounds", NodeBipartiteObs::ColumnFeatureGroup::bounds)
+		.value("reduced_cost", NodeBipartiteObs::ColumnFeatureGroup::reduced_cost)
+		.value("objective", NodeBipartiteObs::ColumnFeatureGroup::objective)
+		.value("solution", NodeBipartiteObs::ColumnFeatureGroup::solution)
+		.value("age", NodeBipartiteObs::ColumnFeatureGroup::age)
+		.value("basis", NodeBipartiteObs::ColumnFeatureGroup::basis)
+		.value("incumbent", NodeBipartiteObs::ColumnFeatureGroup::incumbent)
+		.value("average_incumbent", NodeBipartiteObs::ColumnFeatureGroup::average_incumbent)
+		.value("type", NodeBipartiteObs::ColumnFeatureGroup::type);
+	node_bipartite.def(
+		py::init([](std::optional<std::vector<NodeBipartiteObs::ColumnFeatureGroup>> const& column_feature_groups) {
+			if (column_feature_groups.has_value()) {
+				return NodeBipartite{column_feature_groups.value()};
+			}
+			return NodeBipartite{};
+		}),
+		py::arg("column_feature_groups") = py::none(),
+		R"(
+		Constructor for NodeBipartite.
+
+		Parameters
+		----------
+		column_feature_groups :
+			The groups of column features to compute, from :py:class:`NodeBipartite.ColumnFeatureGroup`.
+			Other column features are neither computed nor allocated.
+			By default, all column features are computed.
+	)");
+	node_bipartite.def_property_readonly(
+		"column_features",
+		&NodeBipartite::column_features,
+		"The :py:class:`NodeBipartiteObs.ColumnFeatures` of every column of ``column_features``.");
 	def_before_reset(node_bipartite, "Cache some feature not expected to change during an episode.");
 	def_extract(node_bipartite, "Extract a new :py:class:`NodeBipartiteObs`.");
 
+	auto cut_pool_obs = py::class_<CutPoolObs>(m, "CutPoolObs", R"(
+		Cuts observation for cut selection.
+
+		The cuts found by the separators are represented with a vector of features and their
+		coefficients on the LP columns.
+	)");
+	cut_pool_obs
+		.def_property_readonly(
+			"cut_features",
+			[](CutPoolObs & self) -> auto& { return self.cut_features; },
+			"A matrix where each row represents a cut, and each column a feature of the cuts.")
+		.def_readwrite(
+			"coefficients",
+			&CutPoolObs::coefficients,
+			"The coefficient matrix of the cuts, with rows for cuts and columns for LP columns.");
+
+	py::enum_<CutPoolObs::CutFeatures>(cut_pool_obs, "CutFeatures")
+		.value("efficacy", CutPoolObs::CutFeatures::efficacy)
+		.value("objective_parallelism", CutPoolObs::CutFeatures::objective_parallelism)
+		.value("density", CutPoolObs::CutFeatures::density)
+		.value("integral_support", CutPoolObs::CutFeatures::integral_support)
+		.value("is_local", CutPoolObs::CutFeatures::is_local)
+		.value("rank", CutPoolObs::CutFeatures::rank);
+
+	auto cut_pool = py::class_<CutPool>(m, "CutPool", R"(
+		Features of the cuts waiting to be added to the LP.
+
+		This observation function extracts a :py:class:`CutPoolObs` where cuts are in the same
+		order as the action set of :py:class:`~ecole.dynamics.CutSelectionDynamics`.
+	)");
+	cut_pool.def(py::init<>());
+	def_before_reset(cut_pool, R"(Do nothing.)");
+	def_extract(cut_pool, "Extract a new :py:class:`CutPoolObs`.");
+
 	auto strong_branching_scores = py::class_<StrongBranchingScores>(m, "StrongBranchingScores", R"(
 		Strong branching score observation function on branch-and bound node.
 
@@ -198,9 +267,59 @@ void bind_submodule(py::module_ const& m) {
 			<https://www.cc.gatech.edu/~lsong/papers/KhaLebSonNemDil16.pdf>`_"
 			*Thirtieth AAAI Conference on Artificial Intelligence*. 2016.
 	)");
-	khalil_2016.def(py::init<>());
+	py::enum_<Khalil2016::Feature::Group>(khalil_2016, "FeatureGroup")
+		.value("obj_coef", Khalil2016::Feature::Group::obj_coef)
+		.value("n_rows", Khalil2016::Feature::Group::n_rows)
+		.value("rows_deg", Khalil2016::Feature::Group::rows_deg)
+		.value("rows_pos_coefs", Khalil2016::Feature::Group::rows_pos_coefs)
+		.value("rows_neg_coefs", Khalil2016::Feature::Group::rows_neg_coefs)
+		.value("slack_ceil_dist", Khalil2016::Feature::Group::slack_ceil_dist)
+		.value("pseudocosts", Khalil2016::Feature::Group::pseudocosts)
+		.value("infeasibility", Khalil2016::Feature::Group::infeasibility)
+		.value("dynamic_rows_deg", Khalil2016::Feature::Group::dynamic_rows_deg)
+		.value("coef_rhs_ratios", Khalil2016::Feature::Group::coef_rhs_ratios)
+		.value("coef_coef_ratios", Khalil2016::Feature::Group::coef_coef_ratios)
+		.value("active_coefs", Khalil2016::Feature::Group::active_coefs);
+	khalil_2016.def(
+		py::init([](std::optional<std::vector<Khalil2016::Feature::Group>> const& feature_groups) {
+			if (feature_groups.has_value()) {
+				return Khalil2016{feature_groups.value()};
+			}
+			return Khalil2016{};
+		}),
+		py::arg("feature_groups") = py::none(),
+		R"(
+		Constructor for Khalil2016.
+
+		Parameters
+		----------
+		feature_groups :
+			The groups of features to compute, from :py:class:`Khalil2016.FeatureGroup`.
+			Other features are neither computed nor allocated.
+			By default, all features are computed.
+	)");
+	khalil_2016.def_property_readonly(
+		"features", &Khalil2016::features, "The index of the feature of every column of the observation.");
 	def_before_reset(khalil_2016, R"(Precompute static features for all varaible columns.)");
 	def_extract(khalil_2016, "Extract the observation matrix.");
+
+	auto heuristic_stats = py::class_<HeuristicStats>(m, "HeuristicStats", R"(
+		Success statistics of the primal heuristics.
+
+		The observation is a matrix where rows represent the primal heuristics, in the same order as
+		the action set of :py:class:`~ecole.dynamics.PrimalHeuristicDynamics`, and columns represent
+		the features given in :py:class:`HeuristicStats.Features`.
+	)");
+	py::enum_<HeuristicStats::Features>(heuristic_stats, "Features")
+		.value("n_calls", HeuristicStats::Features::n_calls)
+		.value("n_solutions_found", HeuristicStats::Features::n_solutions_found)
+		.value("n_best_solutions_found", HeuristicStats::Features::n_best_solutions_found)
+		.value("success_rate", HeuristicStats::Features::success_rate)
+		.value("solving_time", HeuristicStats::Features::solving_time)
+		.value("is_scheduled", HeuristicStats::Features::is_scheduled);
+	heuristic_stats.def(py::init<>());
+	def_before_reset(heuristic_stats, R"(Do nothing.)");
+	def_extract(heuristic_stats, "Extract the observation matrix.");
 }
 
 }  // namespace ecole::observation
@@ -0,0 +1,411 @@
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <pybind11/chrono.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "ecole/environment/episode-runner.hpp"
+#include "ecole/exception.hpp"
+#include "ecole/policy/bridge.hpp"
+#include "ecole/random.hpp"
+#include "ecole/reward/abstract.hpp"
+#include "ecole/scip/model.hpp"
+
+#include "core.hpp"
+
+namespace ecole::policy {
+
+namespace py = pybind11;
+
+namespace {
+
+/**
+ * The action returned by the policy, or the Python error it raised.
+ *
+ * The error is copied for every request of the batch, under the GIL, so that each querying thread raises it with its
+ * own references.
+ */
+struct PyResponse {
+	py::object action;
+	py::object error_type;
+	py::object error_value;
+	py::object error_trace;
+};
+
+/** Requests are ``(observation, action_set)`` tuples. */
+using PyPolicyBridge = PolicyBridge<py::object, PyResponse>;
+
+/** Share a Python callable, so that copies of a std::function holding it do not touch its reference count. */
+auto share_function(py::function callback) -> std::shared_ptr<py::function> {
+	return {new py::function{std::move(callback)}, [](py::function* func) {
+						py::gil_scoped_acquire const acquire{};
+						delete func;  // NOLINT(cppcoreguidelines-owning-memory)
+					}};
+}
+
+/**
+ * Call the Python policy on a batch, from the dispatching thread.
+ *
+ * The GIL is acquired once per batch.
+ * All the Python objects handed to the bridge are moved out under the GIL, so that the bridge never touches reference
+ * counts without it.
+ */
+auto make_policy(py::function callback) -> PyPolicyBridge::Policy {
+	auto shared_callback = share_function(std::move(callback));
+	return [shared_callback](std::vector<py::object>& requests) {
+		py::gil_scoped_acquire const acquire{};
+		auto batch = py::list{requests.size()};
+		for (std::size_t i = 0; i < requests.size(); ++i) {
+			// Steals the reference, leaving an empty object in the request
+			PyList_SET_ITEM(batch.ptr(), static_cast<py::ssize_t>(i), requests[i].release().ptr());
+		}
+		auto responses = std::vector<PyResponse>(requests.size());
+		try {
+			auto const actions = py::list{(*shared_callback)(std::move(batch))};
+			if (actions.size() != responses.size()) {
+				throw Exception("The policy must return one action per request");
+			}
+			for (std::size_t i = 0; i < responses.size(); ++i) {
+				responses[i].action = actions[i];
+			}
+		} catch (py::error_already_set const& error) {
+			for (auto& response : responses) {
+				response.error_type = error.type();
+				response.error_value = error.value();
+				response.error_trace = error.trace();
+			}
+		}
+		return responses;
+	};
+}
+
+/** Stop the dispatching thread without the GIL, which the batch being evaluated may be waiting for. */
+struct ReleaseGilDeleter {
+	void operator()(PyPolicyBridge* bridge) const {
+		py::gil_scoped_release const release{};
+		delete bridge;  // NOLINT(cppcoreguidelines-owning-memory)
+	}
+};
+
+using PyPolicyBridgeHolder = std::unique_ptr<PyPolicyBridge, ReleaseGilDeleter>;
+
+/** A Python object that acquires the GIL when copied or released, to be handled by C++ threads. */
+class GilObject {
+public:
+	GilObject() = default;
+	explicit GilObject(py::object obj) noexcept : object{std::move(obj)} {}
+	GilObject(GilObject const& other) {
+		py::gil_scoped_acquire const acquire{};
+		object = other.object;
+	}
+	GilObject(GilObject&&) noexcept = default;
+	~GilObject() { reset(); }
+
+	GilObject& operator=(GilObject const& other) {
+		if (this != &other) {
+			py::gil_scoped_acquire const acquire{};
+			object = other.object;
+		}
+		return *this;
+	}
+	GilObject& operator=(GilObject&& other) noexcept {
+		if (this != &other) {
+			reset();
+			object = std::move(other.object);
+		}
+		return *this;
+	}
+
+	/** The object, to be used with the GIL held. */
+	[[nodiscard]] py::object const& get() const noexcept { return object; }
+
+private:
+	py::object object;
+
+	void reset() noexcept {
+		if (object) {
+			py::gil_scoped_acquire const acquire{};
+			object = py::object{};
+		}
+	}
+};
+
+/**
+ * Adapt a Python environment to the EpisodeRunner, acquiring the GIL for every call.
+ *
+ * Python environments release the GIL while SCIP is solving, so episodes still run concurrently.
+ */
+class PyEnvironment {
+public:
+	using Observation = GilObject;
+	using Action = GilObject;
+	using ActionSet = GilObject;
+	using Transition = std::tuple<Observation, ActionSet, reward::Reward, bool, GilObject>;
+
+	explicit PyEnvironment(GilObject env_) noexcept : env{std::move(env_)} {}
+
+	void seed(Seed seed) {
+		py::gil_scoped_acquire const acquire{};
+		env.get().attr("seed")(seed);
+	}
+
+	/** The model is handed over without copy, since the runner watches its time limit. */
+	auto reset(scip::Model&& model) -> Transition {
+		py::gil_scoped_acquire const acquire{};
+		auto const owned = py::module_::import("ecole.environment").attr("_Owned")(py::cast(std::move(model)));
+		return to_transition(env.get().attr("reset")(owned));
+	}
+
+	auto step(Action const& action) -> Transition {
+		py::gil_scoped_acquire const acquire{};
+		return to_transition(env.get().attr("step")(action.get()));
+	}
+
+private:
+	GilObject env;
+
+	static auto to_transition(py::object const& result) -> Transition {
+		auto const transition = result.cast<py::tuple>();
+		return {
+			GilObject{transition[0]},
+			GilObject{transition[1]},
+			transition[2].cast<reward::Reward>(),
+			transition[3].cast<bool>(),
+			GilObject{transition[4]}};
+	}
+};
+
+using PyEpisodeRunner = environment::EpisodeRunner<PyEnvironment>;
+
+/** Create environments from a Python callable, in the runner threads. */
+auto make_environment_factory(py::function callback) -> PyEpisodeRunner::EnvironmentFactory {
+	auto shared_callback = share_function(std::move(callback));
+	return [shared_callback] {
+		py::gil_scoped_acquire const acquire{};
+		return PyEnvironment{GilObject{(*shared_callback)()}};
+	};
+}
+
+/** Query the policy bridge with the GIL released while waiting for the batch. */
+auto make_runner_policy(PyPolicyBridge& bridge) -> PyEpisodeRunner::Policy {
+	return [&bridge](GilObject const& observation, GilObject const& action_set) {
+		auto request = [&] {
+			py::gil_scoped_acquire const acquire{};
+			return py::object{py::make_tuple(observation.get(), action_set.get())};
+		}();
+		auto response = bridge.query(std::move(request));
+		py::gil_scoped_acquire const acquire{};
+		if (response.error_type) {
+			PyErr_Restore(
+				response.error_type.release().ptr(), response.error_value.release().ptr(), response.error_trace.release().ptr());
+			throw py::error_already_set{};
+		}
+		return GilObject{std::move(response.action)};
+	};
+}
+
+/** Get the instance of an episode from a Python callable returning a Model (copied) or a file path. */
+auto make_instance_source(py::function callback) -> PyEpisodeRunner::InstanceSource {
+	auto shared_callback = share_function(std::move(callback));
+	return [shared_callback](std::size_t episode) {
+		py::gil_scoped_acquire const acquire{};
+		auto const instance = (*shared_callback)(episode);
+		if (py::isinstance<scip::Model>(instance)) {
+			auto const& model = instance.cast<scip::Model const&>();
+			py::gil_scoped_release const release{};
+			return model.copy_orig();
+		}
+		auto const path = py::str{instance}.cast<std::string>();
+		py::gil_scoped_release const release{};
+		return scip::Model::from_file(path);
+	};
+}
+
+auto to_dict(PyEpisodeRunner::EpisodeResult const& result) -> py::dict {
+	auto dict = py::dict{};
+	dict["episode"] = result.episode;
+	dict["thread"] = result.thread;
+	dict["cumulative_reward"] = result.cumulative_reward;
+	dict["n_steps"] = result.n_steps;
+	dict["done"] = result.done;
+	dict["time_limit_reached"] = result.time_limit_reached;
+	dict["wall_time"] = std::chrono::duration_cast<std::chrono::microseconds>(result.wall_time);
+	dict["error"] = py::none();
+	if (result.error != nullptr) {
+		try {
+			std::rethrow_exception(result.error);
+		} catch (py::error_already_set const& error) {
+			dict["error"] = error.value();
+		} catch (std::exception const& error) {
+			dict["error"] = py::module_::import("ecole.core").attr("Exception")(error.what());
+		}
+	}
+	return dict;
+}
+
+}  // namespace
+
+void bind_submodule(py::module_ const& m) {
+	m.doc() = "Utilities to evaluate policies.";
+
+	auto constexpr defaults = PyPolicyBridge::Options{};
+	py::class_<PyPolicyBridge, PyPolicyBridgeHolder>(m, "PolicyBridge", R"(
+		Gather the queries of many environment threads in batches evaluated by a single policy call.
+
+		Environment threads block in :py:meth:`query` until the batch holding their request is
+		evaluated.
+		Batches are evaluated when they hold ``batch_size`` requests, or when ``timeout`` has
+		elapsed since their first request was queued.
+		The policy is called, with the GIL acquired once, on a list of ``(observation, action_set)``
+		tuples, and must return a sequence with one action per tuple.
+		This is meant for policies with a high fixed cost per call, such as neural networks on GPU.
+
+		Typical use is to run an episode per thread, with every thread calling
+		``env.step(bridge.query(observation, action_set))``.
+	)")
+		.def(
+			py::init([](py::function callback, std::size_t batch_size, std::chrono::microseconds timeout) {
+				auto options = PyPolicyBridge::Options{batch_size, timeout};
+				return PyPolicyBridgeHolder{new PyPolicyBridge{make_policy(std::move(callback)), options}};
+			}),
+			py::arg("policy"),
+			py::arg("batch_size") = defaults.batch_size,
+			py::arg("timeout") = defaults.timeout)
+		.def(
+			"query",
+			[](PyPolicyBridge& self, py::object observation, py::object action_set) {
+				auto request = py::object{py::make_tuple(std::move(observation), std::move(action_set))};
+				auto response = PyResponse{};
+				{
+					py::gil_scoped_release const release{};
+					response = self.query(std::move(request));
+				}
+				if (response.error_type) {
+					PyErr_Restore(
+						response.error_type.release().ptr(),
+						response.error_value.release().ptr(),
+						response.error_trace.release().ptr());
+					throw py::error_already_set{};
+				}
+				return std::move(response.action);
+			},
+			py::arg("observation"),
+			py::arg("action_set") = py::none(),
+			"Queue an observation and wait for the action returned by the policy.")
+		.def(
+			"stats",
+			[](PyPolicyBridge const& self) {
+				auto stats = self.stats();
+				auto result = py::dict{};
+				result["batch_sizes"] = std::move(stats.batch_sizes);
+				result["queue_latencies"] = std::move(stats.queue_latencies);
+				return result;
+			},
+			R"(
+			Return the histograms of the batches evaluated.
+
+			``batch_sizes[k]`` is the number of batches of size ``k``.
+			``queue_latencies[i]`` is the number of requests that waited between ``2**i`` and
+			``2**(i+1)`` microseconds before being evaluated, the first and last buckets also holding
+			shorter and longer latencies.
+		)")
+		.def_property_readonly("batch_size", [](PyPolicyBridge const& self) { return self.get_options().batch_size; })
+		.def_property_readonly("timeout", [](PyPolicyBridge const& self) { return self.get_options().timeout; });
+
+	auto constexpr runner_defaults = PyEpisodeRunner::Options{};
+	py::class_<PyEpisodeRunner>(m, "EpisodeRunner", R"(
+		Evaluate a policy on many episodes, in parallel.
+
+		Episodes are scheduled on threads stealing work from each other, every thread running its
+		episodes in its own environment, created by ``environment_factory``.
+		Actions are queried from a :py:class:`PolicyBridge`, so that the requests of all the
+		threads are evaluated in batches.
+		Episode ``i`` is run with the environment seeded with ``seed + i``, so results do not depend
+		on the number of threads.
+		Python environments hold the GIL outside of solving, hence the parallelism is limited
+		by the time spent in Python observation and reward functions.
+	)")
+		.def(
+			py::init([](py::function environment_factory,
+									PyPolicyBridge& bridge,
+									std::size_t n_threads,
+									std::optional<std::chrono::microseconds> time_limit,
+									Seed seed) {
+				auto options = PyEpisodeRunner::Options{n_threads, {}, seed};
+				if (time_limit.has_value()) {
+					options.time_limit = time_limit.value();
+				}
+				return std::make_unique<PyEpisodeRunner>(
+					make_environment_factory(std::move(environment_factory)), make_runner_policy(bridge), options);
+			}),
+			py::keep_alive<1, 3>(),
+			py::arg("environment_factory"),
+			py::arg("bridge"),
+			py::arg("n_threads") = runner_defaults.n_threads,
+			py::arg("time_limit") = py::none(),
+			py::arg("seed") = runner_defaults.seed,
+			R"(
+			Parameters
+			----------
+			environment_factory:
+				Called without arguments to create the environment of every thread.
+			bridge:
+				The :py:class:`PolicyBridge` choosing the actions.
+			n_threads:
+				Number of concurrent episodes, or the number of cores if zero.
+			time_limit:
+				If given, episodes taking longer are interrupted, including the time spent in the policy.
+			seed:
+				Seed of the first episode.
+		)")
+		.def(
+			"run",
+			[](PyEpisodeRunner& self, py::function instance_source, std::size_t n_episodes, py::object const& callback) {
+				auto source = make_instance_source(std::move(instance_source));
+				if (callback.is_none()) {
+					auto results = [&] {
+						py::gil_scoped_release const release{};
+						return self.run(source, n_episodes);
+					}();
+					auto list = py::list{};
+					for (auto const& result : results) {
+						list.append(to_dict(result));
+					}
+					return py::object{std::move(list)};
+				}
+				{
+					py::gil_scoped_release const release{};
+					self.run(source, n_episodes, [&callback](PyEpisodeRunner::EpisodeResult const& result) {
+						py::gil_scoped_acquire const acquire{};
+						callback(to_dict(result));
+					});
+				}
+				return py::object{py::none()};
+			},
+			py::arg("instance_source"),
+			py::arg("n_episodes"),
+			py::arg("callback") = py::none(),
+			R"(
+			Run the given number of episodes.
+
+			``instance_source(i)`` returns the instance of episode ``i``, either a file path or an
+			``ecole.scip.Model`` whose problem is copied.
+			Every result is a dictionary with the ``episode``, the ``thread`` that ran it, the
+			``cumulative_reward`` (including the reward returned on reset), ``n_steps``, ``done``,
+			``time_limit_reached``, the ``wall_time``, and the ``error`` raised during the episode
+			(``None`` if none), in which case the other metrics are partial.
+
+			Without ``callback``, the results are returned in a list ordered by episode.
+			Otherwise, they are passed to ``callback`` as episodes finish.
+		)");
+}
+
+}  // namespace ecole::policy
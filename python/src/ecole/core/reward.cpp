@@ -3,10 +3,12 @@
 #include <pybind11/eval.h>
 #include <pybind11/pybind11.h>
 
+#include "ecole/reward/bound.hpp"
 #include "ecole/reward/constant.hpp"
 #include "ecole/reward/isdone.hpp"
 #include "ecole/reward/lpiterations.hpp"
 #include "ecole/reward/nnodes.hpp"
+#include "ecole/reward/primaldualintegral.hpp"
 #include "ecole/reward/solvingtime.hpp"
 #include "ecole/scip/model.hpp"
 
@@ -28,6 +30,7 @@ public:
 	void before_reset(py::object const& model);
 	Reward extract(py::object const& model, bool done);
 	[[nodiscard]] py::str toString() const;
+	[[nodiscard]] Arithmetic deepcopy(py::dict const& memo) const;
 
 private:
 	py::object operation;
@@ -41,6 +44,7 @@ public:
 	void before_reset(py::object const& model);
 	Reward extract(py::object const& model, bool done);
 	[[nodiscard]] py::str toString() const;
+	[[nodiscard]] Cumulative deepcopy(py::dict const& memo) const;
 
 private:
 	py::object reduce_func;
@@ -56,6 +60,7 @@ private:
 template <typename PyClass, typename... Args> void def_before_reset(PyClass /*pyclass*/, Args&&... /*args*/);
 template <typename PyClass, typename... Args> void def_extract(PyClass /*pyclass*/, Args&&... /*args*/);
 template <typename PyClass> void def_operators(PyClass /*pyclass*/);
+template <typename PyClass> void def_copy(PyClass /*pyclass*/);
 
 /**
  * Reward module bindings definitions.
@@ -70,6 +75,7 @@ void bind_submodule(py::module_ const& m) {
 	)");
 	constant.def(py::init<Reward>(), py::arg("constant") = 0.);
 	def_operators(constant);
+	def_copy(constant);
 	def_before_reset(constant, "Do nothing.");
 	def_extract(constant, "Return the constant value.");
 
@@ -81,7 +87,8 @@ void bind_submodule(py::module_ const& m) {
 	)");
 	arithmetic  //
 		.def(py::init<py::object, py::list, py::str>())
-		.def("__repr__", &Arithmetic::toString);
+		.def("__repr__", &Arithmetic::toString)
+		.def("__deepcopy__", &Arithmetic::deepcopy, py::arg("memo"));
 	def_operators(arithmetic);
 	def_before_reset(arithmetic, R"(
 		Reset the reward functions of the operator.
@@ -104,7 +111,8 @@ void bind_submodule(py::module_ const& m) {
 	)");
 	cumulative  //
 		.def(py::init<py::object, py::object, Reward, py::str>())
-		.def("__repr__", &Cumulative::toString);
+		.def("__repr__", &Cumulative::toString)
+		.def("__deepcopy__", &Cumulative::deepcopy, py::arg("memo"));
 	def_operators(cumulative);
 	def_before_reset(cumulative, "Reset the wrapped reward function and reset current cumulation.");
 	def_extract(cumulative, "Obtain the cumulative reward of result of wrapped function.");
@@ -112,6 +120,7 @@ void bind_submodule(py::module_ const& m) {
 	auto isdone = py::class_<IsDone>(m, "IsDone", "Single reward on terminal states.");
 	isdone.def(py::init<>());
 	def_operators(isdone);
+	def_copy(isdone);
 	def_before_reset(isdone, "Do nothing.");
 	def_extract(isdone, "Return 1 if the episode is on a terminal state, 0 otherwise.");
 
@@ -123,6 +132,7 @@ void bind_submodule(py::module_ const& m) {
 	)");
 	lpiterations.def(py::init<>());
 	def_operators(lpiterations);
+	def_copy(lpiterations);
 	def_before_reset(lpiterations, "Reset the internal LP iterations count.");
 	def_extract(lpiterations, R"(
 		Update the internal LP iteration count and return the difference.
@@ -137,6 +147,7 @@ void bind_submodule(py::module_ const& m) {
 	)");
 	nnodes.def(py::init<>());
 	def_operators(nnodes);
+	def_copy(nnodes);
 	def_before_reset(nnodes, "Reset the internal node count.");
 	def_extract(nnodes, R"(
 		Update the internal node count and return the difference.
@@ -161,12 +172,62 @@ void bind_submodule(py::module_ const& m) {
 
 	)");
 	def_operators(solvingtime);
+	def_copy(solvingtime);
 	def_before_reset(solvingtime, "Reset the internal clock counter.");
 	def_extract(solvingtime, R"(
 		Update the internal clock counter and return the difference.
 
 		The difference in solving time is computed in between calls.
 		)");
+
+	auto primal_bound = py::class_<PrimalBound>(m, "PrimalBound", R"(
+		Primal bound.
+
+		The reward is defined as the primal bound of the current state, in the original objective
+		space.
+		The bound is tracked by an event handler during solving, and refreshed in constant time on
+		extraction.
+	)");
+	primal_bound.def(py::init<>());
+	def_operators(primal_bound);
+	def_copy(primal_bound);
+	def_before_reset(primal_bound, "Start tracking the bounds of the model.");
+	def_extract(primal_bound, "Return the current primal bound.");
+
+	auto dual_bound = py::class_<DualBound>(m, "DualBound", R"(
+		Dual bound.
+
+		The reward is defined as the dual bound of the current state, in the original objective
+		space.
+		The bound is tracked by an event handler during solving, and refreshed in constant time on
+		extraction.
+	)");
+	dual_bound.def(py::init<>());
+	def_operators(dual_bound);
+	def_copy(dual_bound);
+	def_before_reset(dual_bound, "Start tracking the bounds of the model.");
+	def_extract(dual_bound, "Return the current dual bound.");
+
+	auto primal_dual_integral = py::class_<PrimalDualIntegral>(m, "PrimalDualIntegral", R"(
+		Primal-dual integral difference.
+
+		The reward is defined as the integral over solving time of the primal-dual gap since the
+		previous state.
+		The gap is the one of Berthold (2013): zero when the bounds are equal, one when a bound is
+		infinite or the bounds have different signs, and their relative difference otherwise.
+		As for :py:class:`SolvingTime`, the solving time includes the time spent waiting on the agent.
+		The gap is integrated by an event handler during solving, and refreshed in constant time on
+		extraction.
+	)");
+	primal_dual_integral.def(py::init<>());
+	def_operators(primal_dual_integral);
+	def_copy(primal_dual_integral);
+	def_before_reset(primal_dual_integral, "Start tracking the bounds of the model and reset the integral.");
+	def_extract(primal_dual_integral, R"(
+		Update the internal integral and return the difference.
+
+		The difference in primal-dual integral is computed in between calls.
+		)");
 }
 
 /******************************
@@ -203,6 +264,11 @@ py::str Arithmetic::toString() const {
 	return repr.format(*functions);
 }
 
+Arithmetic Arithmetic::deepcopy(py::dict const& memo) const {
+	auto const copy = py::module_::import("copy");
+	return {operation, copy.attr("deepcopy")(functions, memo).cast<py::list>(), repr};
+}
+
 /******************************
  *  Definition of Cumulative  *
  ******************************/
@@ -229,6 +295,11 @@ py::str Cumulative::toString() const {
 	return repr.format(function);
 }
 
+Cumulative Cumulative::deepcopy(py::dict const& memo) const {
+	auto const copy = py::module_::import("copy");
+	return {copy.attr("deepcopy")(function, memo), reduce_func, init_cumul, repr};
+}
+
 /************************************
  *  Definition of helper functions  *
  ************************************/
@@ -242,6 +313,14 @@ template <typename PyClass, typename... Args> void def_extract(PyClass pyclass,
 		"extract", &PyClass::type::extract, py::arg("model"), py::arg("done") = false, std::forward<Args>(args)...);
 }
 
+template <typename PyClass> void def_copy(PyClass pyclass) {
+	using Class = typename PyClass::type;
+	pyclass  //
+		.def("__copy__", [](Class const& self) { return Class{self}; })
+		.def(
+			"__deepcopy__", [](Class const& self, py::dict const& /*memo*/) { return Class{self}; }, py::arg("memo"));
+}
+
 template <typename PyClass> void def_operators(PyClass pyclass) {
 	// Import Python standrad modules
 	auto const builtins = py::module_::import("builtins");
@@ -1,9 +1,12 @@
+#include <map>
 #include <memory>
+#include <string>
 
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 
 #include "ecole/scip/model.hpp"
+#include "ecole/scip/param-set.hpp"
 #include "ecole/scip/scimpl.hpp"
 
 #include "core.hpp"
@@ -40,6 +43,7 @@ void bind_submodule(py::module_ const& m) {
 		.def(py::self != py::self)  // NOLINT(misc-redundant-expression)  pybind specific syntax
 
 		.def("copy_orig", &Model::copy_orig, py::call_guard<py::gil_scoped_release>())
+		.def("presolve", &Model::presolve, py::call_guard<py::gil_scoped_release>())
 		.def(
 			"as_pyscipopt",
 			[](scip::Model const& model) {
@@ -61,6 +65,35 @@ void bind_submodule(py::module_ const& m) {
 
 		.def("solve", &Model::solve, py::call_guard<py::gil_scoped_release>())
 		.def("is_solved", &Model::is_solved);
+
+	py::class_<ParamSet>(m, "ParamSet", R"(
+		A validated set of parameters ready to be applied on any Model.
+
+		The parameter types and values are resolved once at construction, so that applying the same
+		configuration many times only performs the final SCIP calls.
+		Parameter sets are immutable, hashable, and can be passed as actions to
+		:py:class:`~ecole.environment.Configuring`.
+	)")
+		.def(py::init<std::map<std::string, Param> const&>(), py::arg("name_values"), R"(
+			Resolve parameters using the types and bounds of SCIP default plugins.
+		)")
+		.def(py::init<std::map<std::string, Param> const&, Model const&>(), py::arg("name_values"), py::arg("model"), R"(
+			Resolve parameters using the types and bounds of the given model.
+		)")
+		.def("apply", &ParamSet::apply, py::arg("model"), "Set all the parameters on the model.")
+		.def("diff", &ParamSet::diff, py::arg("other"), R"(
+			Return the parameters that are missing or have a different value in the other set.
+		)")
+		.def("to_dict", &ParamSet::to_dict)
+		.def("__len__", &ParamSet::size)
+		.def("__hash__", &ParamSet::hash)
+		.def(py::self == py::self)  // NOLINT(misc-redundant-expression)  pybind specific syntax
+		.def(py::self != py::self)  // NOLINT(misc-redundant-expression)  pybind specific syntax
+		.def(py::pickle(
+			[](ParamSet const& self) { return self.to_dict(); },
+			[](std::map<std::string, Param> const& name_values) { return ParamSet{name_values}; }));
+	// Parameter dictionaries can be used wherever a ParamSet is expected, resolved with a shared default model
+	py::implicitly_convertible<std::map<std::string, Param>, ParamSet>();
 }
 
 }  // namespace ecole::scip
@@ -0,0 +1,130 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <xtensor/xadapt.hpp>
+#include <xtensor/xarray.hpp>
+
+#include "ecole/exception.hpp"
+#include "ecole/observation/nodebipartite.hpp"
+#include "ecole/trajectory/writer.hpp"
+#include "ecole/utility/sparse-matrix.hpp"
+
+#include "core.hpp"
+
+namespace ecole::trajectory {
+
+namespace py = pybind11;
+
+namespace {
+
+template <typename T> xt::xarray<T> to_xarray(py::handle const& obj) {
+	auto const array = py::array_t<T, py::array::c_style | py::array::forcecast>::ensure(obj);
+	if (!array) {
+		throw py::error_already_set{};
+	}
+	auto shape = std::vector<std::size_t>(array.shape(), array.shape() + array.ndim());
+	return xt::adapt(array.data(), static_cast<std::size_t>(array.size()), xt::no_ownership(), shape);
+}
+
+/**
+ * Convert keyword arguments into a record.
+ *
+ * Ecole observations are split in their arrays, floating point arrays are stored as double, unsigned integer arrays
+ * as unsigned integers, and signed integer or boolean arrays as signed integers.
+ */
+Record to_record(py::kwargs const& columns) {
+	using coo_matrix = utility::coo_matrix<double>;
+	auto record = Record{};
+	for (auto const& [key, value] : columns) {
+		auto const name = key.cast<std::string>();
+		if (py::isinstance<observation::NodeBipartiteObs>(value)) {
+			add_columns(record, name, value.cast<observation::NodeBipartiteObs const&>());
+		} else if (py::isinstance<coo_matrix>(value)) {
+			add_columns(record, name, value.cast<coo_matrix const&>());
+		} else {
+			auto const array = py::array::ensure(value);
+			if (!array) {
+				throw Exception("Column '" + name + "' cannot be converted to an array");
+			}
+			switch (array.dtype().kind()) {
+			case 'f':
+				record[name] = to_xarray<double>(array);
+				break;
+			case 'u':
+				record[name] = to_xarray<std::size_t>(array);
+				break;
+			case 'b':
+			case 'i':
+				record[name] = to_xarray<std::int64_t>(array);
+				break;
+			default:
+				throw Exception("Column '" + name + "' must hold numbers");
+			}
+		}
+	}
+	return record;
+}
+
+}  // namespace
+
+void bind_submodule(py::module_ const& m) {
+	m.doc() = "Recording of trajectories for building datasets.";
+
+	auto constexpr defaults = TrajectoryWriter::Options{};
+	py::class_<TrajectoryWriter>(m, "TrajectoryWriter", R"(
+		Record trajectories in a compact on-disk format.
+
+		Records are written in a directory, in chunks of a fixed number of steps.
+		Every chunk is a directory holding one ``.npy`` file per column, where the arrays of all
+		the steps of the chunk are concatenated along the first dimension.
+		Non scalar columns are accompanied with an ``.offsets.npy`` file giving the first row of
+		every step.
+		Chunks can be memory mapped back without copying using :py:class:`TrajectoryReader`.
+
+		Records are written by a background thread.
+		Every record of a chunk must have the same columns, with the same types and trailing
+		dimensions.
+	)")
+		.def(
+			py::init([](std::string directory, std::size_t chunk_size, std::size_t queue_size) {
+				return std::make_unique<TrajectoryWriter>(std::move(directory), TrajectoryWriter::Options{chunk_size, queue_size});
+			}),
+			py::arg("directory"),
+			py::arg("chunk_size") = defaults.chunk_size,
+			py::arg("queue_size") = defaults.queue_size)
+		.def(
+			"write",
+			[](TrajectoryWriter& self, py::kwargs const& columns) {
+				auto record = to_record(columns);
+				py::gil_scoped_release const release{};
+				self.write(std::move(record));
+			},
+			R"(
+			Queue a record to be written.
+
+			Columns are given as keyword arguments.
+			Values can be Ecole observations (e.g. ``NodeBipartiteObs``), sparse matrices, or anything
+			convertible to a NumPy array of numbers (e.g. the reward or the action set).
+			Observations are stored in multiple columns prefixed by the keyword name.
+			Errors from the writing thread are raised by the next call to write or flush.
+		)")
+		.def("flush", &TrajectoryWriter::flush, py::call_guard<py::gil_scoped_release>(), R"(
+			Wait for queued records to be written, and write the current (incomplete) chunk.
+		)")
+		.def("__enter__", [](TrajectoryWriter& self) -> TrajectoryWriter& { return self; }, py::return_value_policy::reference)
+		.def(
+			"__exit__",
+			[](TrajectoryWriter& self, py::args const& /*args*/) {
+				py::gil_scoped_release const release{};
+				self.flush();
+			})
+		.def_property_readonly("directory", &TrajectoryWriter::directory);
+}
+
+}  // namespace ecole::trajectory
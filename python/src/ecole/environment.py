@@ -1,6 +1,53 @@
 """Ecole collection of environments."""
 
+import collections
+import concurrent.futures
+import copy
+import threading
+import typing
+
 import ecole
+from ecole.instrumentation import Stage
+
+
+class Checkpoint(typing.NamedTuple):
+    """State of an episode, restored by deterministically replaying its actions.
+
+    SCIP cannot copy a branch-and-bound tree, so a checkpoint holds what is needed to rebuild it:
+    the instance, the solver parameters, the random state before the episode started, and the
+    sequence of transitions.
+    Instances presolved ahead of time by a pipeline are presolved again when replaying.
+    """
+
+    instance: typing.Any
+    scip_params: dict
+    random_engine: ecole.RandomEngine
+    reset_args: tuple
+    steps: tuple
+
+
+class _Presolved(typing.NamedTuple):
+    """Instance of a checkpoint that was presolved before the episode, as done by a pipeline.
+
+    Replaying presolves a copy of the original problem again, with the parameters the model had
+    when it was delivered, to start from the same presolved problem.
+    """
+
+    model: ecole.core.scip.Model
+    params: dict
+
+    def copy_orig(self):
+        return self._replace(model=self.model.copy_orig())
+
+
+class _Owned(typing.NamedTuple):
+    """Model handed over to an environment, which solves it without copy.
+
+    Used by :py:class:`~ecole.policy.EpisodeRunner`, whose time limit is watching that model.
+    Checkpoints replay the episode from a copy of its original problem.
+    """
+
+    model: ecole.core.scip.Model
 
 
 class Environment:
@@ -55,6 +102,13 @@ class Environment:
         self.dynamics = self.__Dynamics__(**dynamics_kwargs)
         self.can_transition = False
         self.random_engine = ecole.spawn_random_engine()
+        # The steps are kept apart, and only frozen in the episode when checkpointing
+        self.episode = None
+        self.episode_steps = []
+        self.instrumentation = ecole.instrumentation.EpisodeStats()
+        self.trajectory_writer = None
+        # The state returned by the last transition, recorded with the action taken in it
+        self.last_state = None
 
     def reset(self, instance, *dynamics_args, **dynamics_kwargs):
         """Start a new episode.
@@ -68,8 +122,10 @@ class Environment:
         instance:
             The combinatorial optimization problem to tackle during the newly startedre
             episode.
-            Either a file path to an instance that can be read by SCIP, or a `Model` whose problem
-            definition data will be copied.
+            Either a file path to an instance that can be read by SCIP, a `Model` whose problem
+            definition data will be copied, or an :py:class:`~ecole.instance.InstancePipeline`
+            whose next instance is used without copy, as it was prepared ahead of time for this
+            episode (including its presolve).
         dynamics_args:
             Extra arguments are forwarded as is to the underlying :py:class:`~ecole.typing.Dynamics`.
         dynamics_kwargs:
@@ -99,26 +155,21 @@ class Environment:
 
         """
         self.can_transition = True
+        self.episode = Checkpoint(
+            instance=instance,
+            scip_params=dict(self.scip_params),
+            random_engine=copy.copy(self.random_engine),
+            reset_args=(dynamics_args, dynamics_kwargs),
+            steps=(),
+        )
+        self.episode_steps = []
+        self.instrumentation.clear()
         try:
-            if isinstance(instance, ecole.core.scip.Model):
-                self.model = instance.copy_orig()
-            else:
-                self.model = ecole.core.scip.Model.from_file(instance)
-            self.model.set_params(self.scip_params)
-
-            self.dynamics.set_dynamics_random_state(self.model, self.random_engine)
-
-            self.observation_function.before_reset(self.model)
-            self.reward_function.before_reset(self.model)
-            self.information_function.before_reset(self.model)
-            done, action_set = self.dynamics.reset_dynamics(
-                self.model, *dynamics_args, **dynamics_kwargs
-            )
-
-            observation = self.observation_function.extract(self.model, done)
-            reward_offset = self.reward_function.extract(self.model, done)
-            information = self.information_function.extract(self.model, done)
-            return observation, action_set, reward_offset, done, information
+            # Context managers are skipped altogether when timers are compiled out
+            if not ecole.instrumentation.enabled:
+                return self._reset(instance, dynamics_args, dynamics_kwargs)
+            with self.instrumentation, ecole.instrumentation.Timer(Stage.reset):
+                return self._reset(instance, dynamics_args, dynamics_kwargs)
         except Exception as e:
             self.can_transition = False
             raise e
@@ -165,17 +216,98 @@ class Environment:
         if not self.can_transition:
             raise ecole.core.environment.Exception("Environment need to be reset.")
 
+        if self.trajectory_writer is not None:
+            # Written before the transition, which overwrites the action set
+            self._write_record(action)
+
         try:
-            done, action_set = self.dynamics.step_dynamics(
-                self.model, action, *dynamics_args, **dynamics_kwargs
+            if not ecole.instrumentation.enabled:
+                return self._step(action, dynamics_args, dynamics_kwargs)
+            with self.instrumentation, ecole.instrumentation.Timer(Stage.step):
+                return self._step(action, dynamics_args, dynamics_kwargs)
+        except Exception as e:
+            self.can_transition = False
+            raise e
+
+    def _reset(self, instance, dynamics_args, dynamics_kwargs):
+        """Start a new episode, see :py:meth:`reset`."""
+        if isinstance(instance, ecole.core.instance.InstancePipeline):
+            # Pipeline instances are only handed out once, so they are owned without copy
+            self.model = next(instance)
+            # Checkpoints replay the episode from the original problem, presolved again
+            if instance.presolve:
+                presolved = _Presolved(self.model, self.model.get_params())
+                self.episode = self.episode._replace(instance=presolved)
+            else:
+                self.episode = self.episode._replace(instance=self.model)
+        elif isinstance(instance, _Owned):
+            self.model = instance.model
+            self.episode = self.episode._replace(instance=self.model)
+        elif isinstance(instance, _Presolved):
+            self.model = instance.model.copy_orig()
+            self.model.set_params(instance.params)
+            self.model.presolve()
+        elif isinstance(instance, ecole.core.scip.Model):
+            self.model = instance.copy_orig()
+        else:
+            self.model = ecole.core.scip.Model.from_file(instance)
+        self.model.set_params(self.scip_params)
+
+        self.dynamics.set_dynamics_random_state(self.model, self.random_engine)
+
+        self.observation_function.before_reset(self.model)
+        self.reward_function.before_reset(self.model)
+        self.information_function.before_reset(self.model)
+        done, action_set = self.dynamics.reset_dynamics(
+            self.model, *dynamics_args, **dynamics_kwargs
+        )
+
+        observation, reward_offset, information = self._extract(done)
+        self.last_state = (observation, action_set, reward_offset)
+        return observation, action_set, reward_offset, done, information
+
+    def _step(self, action, dynamics_args, dynamics_kwargs):
+        """Transition from one state to another, see :py:meth:`step`."""
+        done, action_set = self.dynamics.step_dynamics(
+            self.model, action, *dynamics_args, **dynamics_kwargs
+        )
+        self.episode_steps.append((action, dynamics_args, dynamics_kwargs))
+        observation, reward, information = self._extract(done)
+        self.last_state = (observation, action_set, reward)
+        return observation, action_set, reward, done, information
+
+    def _write_record(self, action):
+        """Record the last state returned with the action taken in it."""
+        observation, action_set, reward = self.last_state
+        columns = {"action": action, "reward": reward}
+        if isinstance(observation, tuple):
+            columns.update({"obs.{}".format(i): obs for i, obs in enumerate(observation)})
+        elif isinstance(observation, dict):
+            columns.update({"obs.{}".format(name): obs for name, obs in observation.items()})
+        elif observation is not None:
+            columns["obs"] = observation
+        if action_set is not None:
+            columns["action_set"] = action_set
+        self.trajectory_writer.write(**columns)
+
+    def _extract(self, done):
+        """Extract the observation, reward, and information of the current state.
+
+        Each of the three functions is timed as a whole, including the functions nested in it.
+        """
+        if not ecole.instrumentation.enabled:
+            return (
+                self.observation_function.extract(self.model, done),
+                self.reward_function.extract(self.model, done),
+                self.information_function.extract(self.model, done),
             )
+        with ecole.instrumentation.Timer(Stage.observation):
             observation = self.observation_function.extract(self.model, done)
+        with ecole.instrumentation.Timer(Stage.reward):
             reward = self.reward_function.extract(self.model, done)
+        with ecole.instrumentation.Timer(Stage.information):
             information = self.information_function.extract(self.model, done)
-            return observation, action_set, reward, done, information
-        except Exception as e:
-            self.can_transition = False
-            raise e
+        return observation, reward, information
 
     def seed(self, value: int) -> None:
         """Set the random seed of the environment.
@@ -189,11 +321,391 @@ class Environment:
         """
         self.random_engine.seed(value)
 
+    def record(self, writer) -> None:
+        """Record the steps of the following episodes with a trajectory writer.
+
+        Every call to :py:meth:`step` writes one record of the state in which the action is taken,
+        as returned by the previous transition: the ``action``, the ``reward`` returned with the
+        state, the ``action_set`` (if any), and the observation in ``obs`` (split in ``obs.<key>``
+        for tuples and dictionaries).
+        Actions and observations must be supported by the writer.
+        Steps replayed by :py:meth:`restore` are not recorded.
+
+        Parameters
+        ----------
+        writer:
+            A :py:class:`~ecole.trajectory.TrajectoryWriter`, or ``None`` to stop recording.
+
+        """
+        self.trajectory_writer = writer
+
+    def checkpoint(self) -> Checkpoint:
+        """Save the current state of the episode.
+
+        The checkpoint can be restored with :py:meth:`restore`, or in many environments at once
+        with :py:func:`fork`.
+        The actions must be picklable if the checkpoint is to be sent to another process.
+        """
+        if self.episode is None:
+            raise ecole.core.Exception("Environment need to be reset.")
+        return self.episode._replace(steps=tuple(self.episode_steps))
+
+    def restore(self, checkpoint: Checkpoint):
+        """Bring the environment to the state saved in a checkpoint.
+
+        The episode of the checkpoint is replayed from the start with the same instance, solver
+        parameters, random state, and actions.
+        This is deterministic, up to functions relying on wall clock time.
+        The solver parameters of the checkpoint become the parameters of this environment.
+
+        Returns
+        -------
+        transition:
+            The return value of the last call to :meth:`reset` or :meth:`step` in the checkpoint,
+            that is the ``(observation, action_set, reward, done, info)`` of the saved state.
+
+        """
+        self.scip_params = dict(checkpoint.scip_params)
+        self.random_engine = copy.copy(checkpoint.random_engine)
+        reset_args, reset_kwargs = checkpoint.reset_args
+        trajectory_writer, self.trajectory_writer = self.trajectory_writer, None
+        try:
+            transition = self.reset(checkpoint.instance, *reset_args, **reset_kwargs)
+            for action, args, kwargs in checkpoint.steps:
+                transition = self.step(action, *args, **kwargs)
+        finally:
+            self.trajectory_writer = trajectory_writer
+        return transition
+
+
+def fork(checkpoint: Checkpoint, environments, n_threads: typing.Optional[int] = None):
+    """Restore a checkpoint into many environments, in parallel.
+
+    This is used to explore different continuations of the same episode (*e.g.* in a tree
+    search over branching decisions).
+    The instance is only read once, and the episode is replayed concurrently in every environment.
+    The environments must not share stateful observation, reward, or information functions.
+
+    Parameters
+    ----------
+    checkpoint:
+        A checkpoint obtained with :py:meth:`Environment.checkpoint`.
+    environments:
+        The environments in which to restore the checkpoint.
+    n_threads:
+        Number of threads replaying the episode, by default one per environment.
+
+    Returns
+    -------
+    transitions:
+        For every environment, the transition returned by :py:meth:`Environment.restore`.
+
+    """
+    environments = list(environments)
+    instance = checkpoint.instance
+    if not isinstance(instance, (ecole.core.scip.Model, _Presolved)):
+        instance = ecole.core.scip.Model.from_file(instance)
+    # Copies are made upfront since copying is not thread safe on the source model
+    checkpoints = [checkpoint._replace(instance=instance.copy_orig()) for _ in environments]
+    n_threads = n_threads if n_threads is not None else max(len(environments), 1)
+    with concurrent.futures.ThreadPoolExecutor(max_workers=n_threads) as pool:
+        return list(pool.map(lambda env, ckpt: env.restore(ckpt), environments, checkpoints))
+
+
+class ReplayEngine:
+    """Replay action sequences with memoization of intermediate states.
+
+    Given an instance, a seed, and a sequence of actions, the engine returns the resulting state of
+    the episode.
+    Environments suspended in the middle of an episode are kept alive in a least recently used
+    cache, so that a sequence extending a previously replayed one only replays the new actions.
+    This is meant for rollouts in tree search over branching decisions.
+
+    SCIP cannot copy a solver in the middle of a solve, so continuing a cached state consumes it.
+    Sibling sequences sharing a prefix each need their own state at that prefix, which can be
+    replayed ahead of time and in parallel with :py:meth:`warm`.
+    """
+
+    def __init__(self, environment_factory, capacity: int = 16) -> None:
+        """Create an empty engine.
+
+        Parameters
+        ----------
+        environment_factory:
+            A callable taking no arguments returning a new :py:class:`Environment`.
+            Environments must not share stateful observation, reward, or information functions.
+        capacity:
+            Maximum number of environments kept alive in the cache.
+
+        """
+        self.environment_factory = environment_factory
+        self.capacity = capacity
+        self.n_hits = 0
+        self.n_steps_replayed = 0
+        # Map (instance id, seed, actions) to a list of (environment, transition)
+        self._cache = collections.OrderedDict()
+        # Instances referenced by the cache keys, kept alive so that their ids are not reused
+        self._instances = {}
+        self._lock = threading.Lock()
+
+    def replay(self, instance, seed: int, actions):
+        """Return the transition obtained after taking the actions.
+
+        The state is kept in the cache, so replaying the same sequence again is free.
+        Actions must be hashable.
+
+        Returns
+        -------
+        transition:
+            The ``(observation, action_set, reward, done, info)`` of the last transition.
+            It is the transition held in the cache, without copy, and is returned again by later
+            calls replaying the same sequence, so it must be treated as read-only.
+
+        """
+        actions = tuple(actions)
+        key = self._key(instance, seed, actions)
+        with self._lock:
+            entries = self._cache.get(key)
+            if entries:
+                self._cache.move_to_end(key)
+                self.n_hits += 1
+                return entries[-1][1]
+        environment, transition = self.checkout(instance, seed, actions)
+        return self._insert(instance, key, environment, transition)
+
+    def checkout(self, instance, seed: int, actions):
+        """Take a live environment at the state obtained after taking the actions.
+
+        The environment is removed from the cache and can be stepped freely.
+
+        Returns
+        -------
+        environment:
+            The environment in the requested state.
+        transition:
+            The ``(observation, action_set, reward, done, info)`` of the last transition.
+
+        """
+        return self._advance(instance, seed, tuple(actions), instance)
+
+    def warm(self, instance, seed: int, actions, n_copies: int = 1, n_threads=None) -> None:
+        """Make sure the cache holds a number of states after taking the actions.
+
+        Missing states are replayed in parallel.
+        This is used before exploring ``n_copies`` different continuations of the same sequence.
+        """
+        actions = tuple(actions)
+        key = self._key(instance, seed, actions)
+        with self._lock:
+            n_missing = n_copies - len(self._cache.get(key, []))
+        if n_missing <= 0:
+            return
+        # Copies are made upfront since copying is not thread safe on the source model
+        if isinstance(instance, ecole.core.scip.Model):
+            instances = [instance.copy_orig() for _ in range(n_missing)]
+        else:
+            instances = [instance] * n_missing
+
+        def replay_copy(instance_copy):
+            environment, transition = self._advance(instance, seed, actions, instance_copy)
+            self._insert(instance, key, environment, transition)
+
+        n_threads = n_threads if n_threads is not None else n_missing
+        with concurrent.futures.ThreadPoolExecutor(max_workers=n_threads) as pool:
+            list(pool.map(replay_copy, instances))
+
+    def clear(self) -> None:
+        """Drop all the cached environments."""
+        with self._lock:
+            self._cache.clear()
+            self._instances.clear()
+
+    def __len__(self) -> int:
+        """Number of environments in the cache."""
+        with self._lock:
+            return sum(len(entries) for entries in self._cache.values())
+
+    @staticmethod
+    def _key(instance, seed, actions):
+        # Models are not hashable, and are kept alive in _instances while they are in the cache
+        if isinstance(instance, ecole.core.scip.Model):
+            instance = id(instance)
+        return (instance, seed, actions)
+
+    def _advance(self, instance, seed, actions, reset_instance):
+        """Continue the cached state with the longest prefix, or start a new episode."""
+        n_done, environment, transition = self._take_longest_prefix(instance, seed, actions)
+        if environment is None:
+            environment = self.environment_factory()
+            environment.seed(seed)
+            transition = environment.reset(reset_instance)
+        for action in actions[n_done:]:
+            if transition[3]:
+                raise ecole.core.Exception("Episode terminated before the end of the actions.")
+            transition = environment.step(action)
+        with self._lock:
+            self.n_steps_replayed += len(actions) - n_done
+        return environment, transition
+
+    def _take_longest_prefix(self, instance, seed, actions):
+        """Remove and return the cached environment with the longest prefix of the actions."""
+        with self._lock:
+            for n_done in range(len(actions), -1, -1):
+                entries = self._cache.get(self._key(instance, seed, actions[:n_done]))
+                if entries:
+                    environment, transition = entries.pop()
+                    self.n_hits += 1
+                    self._evict_empty()
+                    return n_done, environment, transition
+        return 0, None, None
+
+    def _insert(self, instance, key, environment, transition) -> None:
+        # The action set is a view overwritten when the environment continues, which cached ones do
+        observation, action_set, reward, done, info = transition
+        transition = (observation, copy.copy(action_set), reward, done, info)
+        with self._lock:
+            if isinstance(instance, ecole.core.scip.Model):
+                self._instances[key[0]] = instance
+            self._cache.setdefault(key, []).append((environment, transition))
+            self._cache.move_to_end(key)
+            n_environments = sum(len(entries) for entries in self._cache.values())
+            while n_environments > self.capacity:
+                oldest_key, oldest_entries = next(iter(self._cache.items()))
+                oldest_entries.pop(0)
+                n_environments -= 1
+                if not oldest_entries:
+                    del self._cache[oldest_key]
+            self._evict_empty()
+        return transition
+
+    def _evict_empty(self) -> None:
+        """Drop the keys of consumed states, and the instances no longer in the cache."""
+        for empty_key in [k for k, entries in self._cache.items() if not entries]:
+            del self._cache[empty_key]
+        cached_instances = {key[0] for key in self._cache}
+        for instance_id in [i for i in self._instances if i not in cached_instances]:
+            del self._instances[instance_id]
+
 
 class Branching(Environment):
     __Dynamics__ = ecole.dynamics.BranchingDynamics
     __DefaultObservationFunction__ = ecole.observation.NodeBipartite
 
 
+class BatchedBranching(Environment):
+    __Dynamics__ = ecole.dynamics.BatchedBranchingDynamics
+    __DefaultObservationFunction__ = ecole.observation.NodeBipartite
+
+
+class NodeSelection(Environment):
+    __Dynamics__ = ecole.dynamics.NodeSelectionDynamics
+
+
+class PrimalHeuristic(Environment):
+    __Dynamics__ = ecole.dynamics.PrimalHeuristicDynamics
+    __DefaultObservationFunction__ = ecole.observation.HeuristicStats
+
+
+class CutSelection(Environment):
+    __Dynamics__ = ecole.dynamics.CutSelectionDynamics
+    __DefaultObservationFunction__ = ecole.observation.CutPool
+
+
 class Configuring(Environment):
     __Dynamics__ = ecole.dynamics.ConfiguringDynamics
+
+
+class RacingConfiguring(Environment):
+    __Dynamics__ = ecole.dynamics.RacingConfiguringDynamics
+
+
+class ParallelConfiguring:
+    """Evaluate many solver configurations on the same instance concurrently.
+
+    Every configuration is solved on its own copy of the instance, on a pool of threads, and scored
+    with the reward function as if a :py:class:`Configuring` environment was run once per
+    configuration.
+    This is meant for bandit or Bayesian optimization loops over the solver parameters.
+    """
+
+    __DefaultRewardFunction__ = ecole.reward.IsDone
+
+    def __init__(
+        self, reward_function="default", scip_params=None, n_threads=0, race_factor=None
+    ) -> None:
+        """Create a new parallel configuring environment.
+
+        Parameters
+        ----------
+        reward_function:
+            An object of type :py:class:`~ecole.reward.RewardFunction` used to score every
+            configuration.
+            It is deep copied for every configuration.
+        scip_params:
+            Parameters set on every :py:class:`~ecole.scip.Model` before the configuration.
+        n_threads:
+            The number of concurrent solves, or the number of cores if zero.
+        race_factor:
+            If set, interrupt the runs slower than this factor times the fastest solved run.
+
+        """
+        self.reward_function = ecole.data.parse(reward_function, self.__DefaultRewardFunction__())
+        self.scip_params = scip_params if scip_params is not None else {}
+        self.dynamics = ecole.dynamics.ParallelConfiguringDynamics(n_threads, race_factor)
+        self.random_engine = ecole.spawn_random_engine()
+
+    def evaluate(self, instance, configurations):
+        """Solve every configuration on a copy of the instance.
+
+        Parameters
+        ----------
+        instance:
+            Either a file path to an instance that can be read by SCIP, or a `Model` whose problem
+            definition data will be copied.
+        configurations:
+            A list of parameter dictionaries or :py:class:`~ecole.scip.ParamSet`.
+
+        Returns
+        -------
+        rewards:
+            The reward of every configuration.
+        completed:
+            For every configuration, whether it ran to completion, *i.e.* was not eliminated by
+            racing.
+
+        """
+        if isinstance(instance, ecole.core.scip.Model):
+            model = instance
+        else:
+            model = ecole.core.scip.Model.from_file(instance)
+
+        param_sets = [
+            config
+            if isinstance(config, ecole.core.scip.ParamSet)
+            else ecole.core.scip.ParamSet(config, model)
+            for config in configurations
+        ]
+
+        # Models are prepared sequentially so that random states are deterministic
+        models = []
+        for _ in param_sets:
+            model_copy = model.copy_orig()
+            model_copy.set_params(self.scip_params)
+            self.dynamics.set_dynamics_random_state(model_copy, self.random_engine)
+            models.append(model_copy)
+
+        reward_functions = [copy.deepcopy(self.reward_function) for _ in param_sets]
+        rewards = [None] * len(param_sets)
+
+        def before_solve(i):
+            reward_functions[i].before_reset(models[i])
+
+        def after_solve(i):
+            rewards[i] = reward_functions[i].extract(models[i], True)
+
+        completed = self.dynamics.solve_all(models, param_sets, before_solve, after_solve)
+        return rewards, completed
+
+    def seed(self, value: int) -> None:
+        """Set the random seed of the environment."""
+        self.random_engine.seed(value)
@@ -1,4 +1 @@
-from ecole._set_cover_generator import SetCoverGenerator
-from ecole._combinatorial_auction_generator import CombinatorialAuctionGenerator
-from ecole._capacitated_facility_location_generator import CapacitatedFacilityLocationGenerator
-from ecole._independent_set_generator import IndependentSetGenerator
+from ecole.core.instance import *
@@ -0,0 +1,3 @@
+"""Timers of the stages of the environments."""
+
+from ecole.core.instrumentation import *
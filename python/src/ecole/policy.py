@@ -0,0 +1,3 @@
+"""Utilities to evaluate policies."""
+
+from ecole.core.policy import *
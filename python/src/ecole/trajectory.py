@@ -0,0 +1,87 @@
+"""Recording and reading of trajectories for building datasets."""
+
+import bisect
+import pathlib
+
+import numpy as np
+
+from ecole.core.trajectory import *
+
+
+class TrajectoryReader:
+    """Read trajectories recorded by a :py:class:`TrajectoryWriter`.
+
+    Chunks are memory mapped, so that the arrays of a step are views into the files and are only
+    read from disk when accessed.
+    Steps are indexed in the order they were written, across all chunks.
+    """
+
+    def __init__(self, directory) -> None:
+        """Open the chunks in the directory.
+
+        Parameters
+        ----------
+        directory:
+            The directory given to the :py:class:`TrajectoryWriter`.
+            Chunks written after the reader is created are not visible.
+
+        """
+        self.directory = pathlib.Path(directory)
+        # Chunks being written have a temporary suffix, and other directories are ignored
+        self.chunk_paths = sorted(
+            (
+                path
+                for path in self.directory.iterdir()
+                if path.is_dir()
+                and path.name.startswith("chunk-")
+                and path.name[len("chunk-") :].isdigit()
+            ),
+            key=lambda path: int(path.name[len("chunk-") :]),
+        )
+        self.chunks = [self._open_chunk(path) for path in self.chunk_paths]
+        self.chunk_starts = list(np.cumsum([0] + [n_steps for n_steps, _ in self.chunks]))
+
+    def __len__(self) -> int:
+        """Total number of steps."""
+        return int(self.chunk_starts[-1])
+
+    def __getitem__(self, index: int) -> dict:
+        """Return the columns of a step as a dictionary of arrays, without copying."""
+        if index < 0:
+            index += len(self)
+        if not 0 <= index < len(self):
+            raise IndexError("Step index out of range")
+        chunk_idx = bisect.bisect_right(self.chunk_starts, index) - 1
+        _, columns = self.chunks[chunk_idx]
+        step = index - self.chunk_starts[chunk_idx]
+        return {name: self._step_view(data, offsets, step) for name, (data, offsets) in columns.items()}
+
+    def __iter__(self):
+        """Iterate over all the steps."""
+        return (self[i] for i in range(len(self)))
+
+    def column(self, name: str):
+        """Return the concatenated data of a column for every chunk, without copying."""
+        return [columns[name][0] for _, columns in self.chunks]
+
+    @staticmethod
+    def _open_chunk(path):
+        columns = {}
+        for data_path in path.glob("*.npy"):
+            if data_path.name.endswith(".offsets.npy"):
+                continue
+            name = data_path.name[: -len(".npy")]
+            offsets_path = path / (name + ".offsets.npy")
+            offsets = np.load(offsets_path) if offsets_path.exists() else None
+            columns[name] = (np.load(data_path, mmap_mode="r"), offsets)
+        if not columns:
+            return 0, columns
+        data, offsets = next(iter(columns.values()))
+        n_steps = len(data) if offsets is None else len(offsets) - 1
+        return n_steps, columns
+
+    @staticmethod
+    def _step_view(data, offsets, step):
+        if offsets is None:
+            return data[step]
+        return data[offsets[step] : offsets[step + 1]]
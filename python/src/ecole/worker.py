@@ -0,0 +1,317 @@
+"""Environments running in worker processes, with observations returned through shared memory."""
+
+import mmap
+import multiprocessing
+import os
+import pathlib
+import tempfile
+import typing
+
+import numpy as np
+
+import ecole
+
+
+class SharedCooMatrix(typing.NamedTuple):
+    """A sparse matrix in COO format whose arrays are views into shared memory."""
+
+    values: np.ndarray
+    indices: np.ndarray
+    shape: tuple
+
+
+class SharedNodeBipartiteObs(typing.NamedTuple):
+    """A :py:class:`~ecole.observation.NodeBipartiteObs` whose arrays are views into shared memory."""
+
+    column_features: np.ndarray
+    row_features: np.ndarray
+    edge_features: SharedCooMatrix
+
+
+class SharedMemory:
+    """A memory region shared between processes.
+
+    The region is backed by a file, in ``/dev/shm`` when available so that it never touches the
+    disk.
+    The file can be removed with :py:meth:`unlink` as soon as every process has mapped it.
+    """
+
+    def __init__(self, size: int, path: typing.Optional[str] = None) -> None:
+        """Create a new region of the given size, or map an existing one if a path is given."""
+        if path is None:
+            directory = "/dev/shm" if os.path.isdir("/dev/shm") else None
+            fd, path = tempfile.mkstemp(prefix="ecole-", dir=directory)
+            os.ftruncate(fd, size)
+        else:
+            fd = os.open(path, os.O_RDWR)
+        try:
+            self.mmap = mmap.mmap(fd, size)
+        finally:
+            os.close(fd)
+        self.path = path
+        self.buffer = memoryview(self.mmap)
+
+    def unlink(self) -> None:
+        """Remove the backing file, the memory remains mapped in the processes using it."""
+        pathlib.Path(self.path).unlink()
+
+    def close(self) -> None:
+        """Unmap the region, or leave it to the garbage collector if arrays still use it."""
+        try:
+            self.buffer.release()
+            self.mmap.close()
+        except BufferError:
+            pass
+
+
+class ObservationRing:
+    """Slots of a shared memory region where arrays are written by a worker.
+
+    Slots are used in turn, so that the arrays of a transition remain valid until ``n_slots - 1``
+    other transitions have been written.
+    The region starts with the action slot, where the parent writes integer actions.
+    """
+
+    action_size = 64
+    alignment = 64
+
+    def __init__(self, memory: SharedMemory, n_slots: int, slot_size: int) -> None:
+        self.memory = memory
+        self.n_slots = n_slots
+        self.slot_size = slot_size
+        self.action = np.frombuffer(memory.buffer, dtype=np.int64, count=1)
+
+    @classmethod
+    def size_for(cls, n_slots: int, slot_size: int) -> int:
+        """Size of the shared memory region needed for the given slots."""
+        return cls.action_size + n_slots * slot_size
+
+    def write(self, slot: int, arrays) -> list:
+        """Copy arrays in a slot and return their layout, raises if they do not fit."""
+        layout = []
+        offset = 0
+        for array in arrays:
+            array = np.ascontiguousarray(array)
+            if offset + array.nbytes > self.slot_size:
+                raise ecole.core.Exception(
+                    "Observation does not fit in the shared memory slots of {} bytes".format(
+                        self.slot_size
+                    )
+                )
+            start = self.action_size + slot * self.slot_size + offset
+            np.frombuffer(
+                self.memory.buffer, dtype=array.dtype, count=array.size, offset=start
+            ).reshape(array.shape)[...] = array
+            layout.append((offset, array.dtype.str, array.shape))
+            offset += -(-array.nbytes // self.alignment) * self.alignment
+        return layout
+
+    def read(self, slot: int, layout: list) -> list:
+        """Return views, without copy, of the arrays written in a slot."""
+        base = self.action_size + slot * self.slot_size
+        return [
+            np.frombuffer(
+                self.memory.buffer,
+                dtype=np.dtype(dtype),
+                count=int(np.prod(shape, dtype=np.int64)),
+                offset=base + offset,
+            ).reshape(shape)
+            for offset, dtype, shape in layout
+        ]
+
+
+def _flatten(obj, arrays):
+    """Replace the arrays in an object by their index in a list, keeping other values as is."""
+    if isinstance(obj, ecole.observation.NodeBipartiteObs):
+        return (
+            "node_bipartite",
+            _flatten(obj.column_features, arrays),
+            _flatten(obj.row_features, arrays),
+            _flatten(obj.edge_features, arrays),
+        )
+    if isinstance(obj, ecole.core.observation.coo_matrix):
+        return (
+            "coo",
+            _flatten(obj.values, arrays),
+            _flatten(obj.indices, arrays),
+            tuple(obj.shape),
+        )
+    if isinstance(obj, np.ndarray) and obj.dtype != object:
+        arrays.append(obj)
+        return ("array", len(arrays) - 1)
+    if isinstance(obj, tuple):
+        return ("tuple", tuple(_flatten(o, arrays) for o in obj))
+    if isinstance(obj, list):
+        return ("list", [_flatten(o, arrays) for o in obj])
+    if isinstance(obj, dict):
+        return ("dict", {k: _flatten(v, arrays) for k, v in obj.items()})
+    return ("value", obj)
+
+
+def _unflatten(flat, arrays):
+    """Inverse of :py:func:`_flatten`, with arrays read from shared memory."""
+    kind = flat[0]
+    if kind == "node_bipartite":
+        return SharedNodeBipartiteObs(*(_unflatten(f, arrays) for f in flat[1:]))
+    if kind == "coo":
+        return SharedCooMatrix(_unflatten(flat[1], arrays), _unflatten(flat[2], arrays), flat[3])
+    if kind == "array":
+        return arrays[flat[1]]
+    if kind == "tuple":
+        return tuple(_unflatten(f, arrays) for f in flat[1])
+    if kind == "list":
+        return [_unflatten(f, arrays) for f in flat[1]]
+    if kind == "dict":
+        return {k: _unflatten(v, arrays) for k, v in flat[1].items()}
+    return flat[1]
+
+
+def _send_error(connection, error):
+    try:
+        connection.send(("error", error))
+    except Exception:
+        # The exception could not be pickled
+        connection.send(("error", RuntimeError(repr(error))))
+
+
+def _run_worker(connection, path, n_slots, slot_size, environment_factory):
+    """Serve the commands of a :py:class:`WorkerEnvironment` until asked to stop."""
+    memory = SharedMemory(ObservationRing.size_for(n_slots, slot_size), path)
+    ring = ObservationRing(memory, n_slots, slot_size)
+    try:
+        try:
+            env = environment_factory()
+        except Exception as e:
+            _send_error(connection, e)
+            return
+        connection.send(("ready", None))
+        while True:
+            command, slot, args, kwargs = connection.recv()
+            try:
+                if command == "close":
+                    break
+                if command == "seed":
+                    connection.send(("result", env.seed(*args)))
+                    continue
+                if command == "reset":
+                    transition = env.reset(*args, **kwargs)
+                elif command == "step_slot":
+                    transition = env.step(int(ring.action[0]), *args, **kwargs)
+                else:
+                    transition = env.step(*args, **kwargs)
+                arrays = []
+                flat = _flatten(transition, arrays)
+                connection.send(("transition", (flat, ring.write(slot, arrays))))
+            except Exception as e:
+                _send_error(connection, e)
+    finally:
+        del ring
+        memory.close()
+        connection.close()
+
+
+class WorkerEnvironment:
+    """An environment running in a worker process.
+
+    Running environments in processes avoids contention on the Python GIL and on the global state
+    of SCIP.
+    Instead of pickling the transitions through a pipe, the worker writes the arrays of the
+    observations (and of the action sets) in shared memory, where they are read without copy.
+    :py:class:`~ecole.observation.NodeBipartiteObs` are returned as
+    :py:class:`SharedNodeBipartiteObs`, with the same array attributes.
+    Integer actions are written in a shared slot, other actions and values are pickled.
+
+    Arrays are views into a ring of ``n_slots`` memory slots, so they are overwritten after
+    ``n_slots - 1`` other calls to :py:meth:`reset` or :py:meth:`step`, and must be copied to be
+    kept longer.
+    Only local inter process communication is used.
+    """
+
+    def __init__(
+        self,
+        environment_factory,
+        n_slots: int = 2,
+        slot_size: int = 32 * 2 ** 20,
+        context: typing.Optional[str] = None,
+    ) -> None:
+        """Start the worker process.
+
+        Parameters
+        ----------
+        environment_factory:
+            A callable taking no arguments returning a new :py:class:`~ecole.environment.Environment`.
+            It must be picklable if the start method of processes is not ``fork``.
+        n_slots:
+            Number of transitions whose arrays remain valid at any time, at least two.
+        slot_size:
+            Maximum size in bytes of the arrays of a transition.
+        context:
+            The :py:mod:`multiprocessing` start method, by default the platform default.
+
+        """
+        if n_slots < 2:
+            raise ValueError("At least two slots are needed")
+        self.memory = SharedMemory(ObservationRing.size_for(n_slots, slot_size))
+        self.ring = ObservationRing(self.memory, n_slots, slot_size)
+        self.n_transitions = 0
+        self.connection, child_connection = multiprocessing.Pipe()
+        self.process = multiprocessing.get_context(context).Process(
+            target=_run_worker,
+            args=(child_connection, self.memory.path, n_slots, slot_size, environment_factory),
+            daemon=True,
+        )
+        try:
+            self.process.start()
+            child_connection.close()
+            self._receive()
+        finally:
+            # Mapped in both processes (or failed), the file is not needed anymore
+            self.memory.unlink()
+
+    def reset(self, instance, *dynamics_args, **dynamics_kwargs):
+        """Start a new episode in the worker, see :py:meth:`ecole.environment.Environment.reset`."""
+        return self._transition("reset", (instance,) + dynamics_args, dynamics_kwargs)
+
+    def step(self, action, *dynamics_args, **dynamics_kwargs):
+        """Transition in the worker, see :py:meth:`ecole.environment.Environment.step`."""
+        if isinstance(action, (int, np.integer)) and not isinstance(action, bool):
+            # Written before the command is sent, which orders it before the worker reads it
+            self.ring.action[0] = action
+            return self._transition("step_slot", dynamics_args, dynamics_kwargs)
+        return self._transition("step", (action,) + dynamics_args, dynamics_kwargs)
+
+    def seed(self, value: int) -> None:
+        """Set the random seed of the environment in the worker."""
+        self.connection.send(("seed", None, (value,), {}))
+        return self._receive()
+
+    def close(self) -> None:
+        """Stop the worker process, arrays previously returned must not be used anymore."""
+        if self.process is None:
+            return
+        if self.process.is_alive():
+            self.connection.send(("close", None, (), {}))
+        self.process.join()
+        self.connection.close()
+        self.process = None
+        del self.ring
+        self.memory.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args) -> None:
+        self.close()
+
+    def _transition(self, command, args, kwargs):
+        slot = self.n_transitions % self.ring.n_slots
+        self.n_transitions += 1
+        self.connection.send((command, slot, args, kwargs))
+        flat, layout = self._receive()
+        return _unflatten(flat, self.ring.read(slot, layout))
+
+    def _receive(self):
+        kind, value = self.connection.recv()
+        if kind == "error":
+            raise value
+        return value
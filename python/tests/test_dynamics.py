@@ -67,6 +67,21 @@ class TestBranching(DynamicsUnitTests):
         self.policy = lambda action_set: action_set[0]
         self.bad_action = 1 << 31
 
+    def test_candidate_views(self, model):
+        """Candidates are also available as indices and mask over the LP columns."""
+        _, action_set = self.dynamics.reset_dynamics(model)
+        assert np.array_equal(self.dynamics.candidate_indices, action_set)
+        mask = self.dynamics.candidate_mask
+        assert mask.dtype == np.int32
+        assert np.array_equal(np.flatnonzero(mask), np.sort(action_set))
+
+    def test_candidate_views_without_copy(self, model):
+        """The action set and the candidates are read-only views of the same buffer."""
+        _, action_set = self.dynamics.reset_dynamics(model)
+        assert np.shares_memory(self.dynamics.candidate_indices, action_set)
+        assert not action_set.flags.writeable
+        assert not self.dynamics.candidate_mask.flags.writeable
+
 
 class TestBranchingPseudocost(DynamicsUnitTests):
     @staticmethod
@@ -82,6 +97,67 @@ class TestBranchingPseudocost(DynamicsUnitTests):
         self.bad_action = 1 << 31
 
 
+class TestBatchedBranching(DynamicsUnitTests):
+    @staticmethod
+    def assert_action_set(action_set):
+        assert isinstance(action_set, np.ndarray)
+        assert action_set.ndim == 1
+        assert action_set.size > 0
+        assert action_set.dtype == np.uint64
+
+    def setup_method(self, method):
+        self.dynamics = ecole.dynamics.BatchedBranchingDynamics(False, 4)
+        self.policy = lambda action_set: action_set
+        self.bad_action = np.array([1 << 31], dtype=np.uint64)
+
+    def test_many_branchings(self, model):
+        """Nodes are branched with the ranking until the refresh interval."""
+        done, action_set = self.dynamics.reset_dynamics(model)
+        self.dynamics.step_dynamics(model, action_set)
+        assert 1 <= self.dynamics.n_last_branchings <= 4
+
+
+class TestNodeSelection(DynamicsUnitTests):
+    @staticmethod
+    def assert_action_set(action_set):
+        assert isinstance(action_set, np.ndarray)
+        assert action_set.ndim == 1
+        assert action_set.size > 0
+        assert action_set.dtype == np.uint64
+
+    def setup_method(self, method):
+        self.dynamics = ecole.dynamics.NodeSelectionDynamics()
+        self.policy = lambda action_set: action_set[-1]
+        self.bad_action = 1 << 31
+
+
+class TestPrimalHeuristic(DynamicsUnitTests):
+    @staticmethod
+    def assert_action_set(action_set):
+        assert isinstance(action_set, list)
+        assert len(action_set) > 0
+        assert all(isinstance(name, str) for name in action_set)
+
+    def setup_method(self, method):
+        self.dynamics = ecole.dynamics.PrimalHeuristicDynamics()
+        self.policy = lambda action_set: {action_set[0]: 0.1}
+        self.bad_action = {"not-a-heuristic": 1.0}
+
+
+class TestCutSelection(DynamicsUnitTests):
+    @staticmethod
+    def assert_action_set(action_set):
+        assert isinstance(action_set, np.ndarray)
+        assert action_set.ndim == 1
+        assert action_set.size > 0
+        assert action_set.dtype == np.uint64
+
+    def setup_method(self, method):
+        self.dynamics = ecole.dynamics.CutSelectionDynamics()
+        self.policy = lambda action_set: np.ones(action_set.shape, dtype=bool)
+        self.bad_action = np.ones(1 << 20, dtype=bool)
+
+
 class TestConfiguring(DynamicsUnitTests):
     @staticmethod
     def assert_action_set(action_set):
@@ -97,3 +173,33 @@ class TestConfiguring(DynamicsUnitTests):
             "heuristics/undercover/fixingalts": "ln",
         }
         self.bad_action = {"not/a/parameter": 44}
+
+    def test_param_set_action(self, model):
+        """Validated parameter sets can be used as actions."""
+        param_set = ecole.scip.ParamSet({"branching/scorefunc": "s", "conflict/lpiterations": 0})
+        self.dynamics.reset_dynamics(model)
+        done, _ = self.dynamics.step_dynamics(model, param_set)
+        assert done
+        assert model.get_param("branching/scorefunc") == "s"
+
+
+class TestRacingConfiguring(DynamicsUnitTests):
+    @staticmethod
+    def assert_action_set(action_set):
+        assert action_set is None
+
+    def setup_method(self, method):
+        self.dynamics = ecole.dynamics.RacingConfiguringDynamics(time_slice=0.1)
+        self.policy = lambda _: [
+            {"branching/scorefunc": "s"},
+            ecole.scip.ParamSet({"branching/scorefunc": "p"}),
+        ]
+        self.bad_action = []
+
+    def test_winner(self, model):
+        """The model is replaced by the winning configuration."""
+        self.dynamics.reset_dynamics(model)
+        self.dynamics.step_dynamics(model, self.policy(None))
+        assert self.dynamics.winner in (0, 1)
+        assert model.get_param("branching/scorefunc") == "sp"[self.dynamics.winner]
+        assert model.is_solved()
@@ -1,6 +1,13 @@
 """Unit tests for Ecole Environment."""
 
+import copy
+import gc
+import json
+import pickle
 import unittest.mock as mock
+import weakref
+
+import numpy as np
 
 import ecole
 
@@ -27,6 +34,18 @@ def test_reset(model):
     env.dynamics.set_dynamics_random_state.assert_called()
 
 
+def test_reset_pipeline():
+    """Reset with an instance pipeline, using its presolved instance without copy."""
+    generator = ecole.instance.SetCoverGenerator(n_rows=100, n_cols=200)
+    pipeline = ecole.instance.InstancePipeline(generator, presolve=True, seed=0)
+    env = ecole.environment.Branching()
+    _, action_set, _, done, _ = env.reset(pipeline)
+    assert env.episode.instance.model is env.model
+    while not done:
+        _, action_set, _, done, _ = env.step(action_set[0])
+    assert env.model.is_solved()
+
+
 def test_step(model):
     """Stepmwith some action."""
     env = MockEnvironment()
@@ -47,3 +66,180 @@ def test_scip_params(model):
     env = MockEnvironment(scip_params={"concurrent/paramsetprefix": "testname"})
     env.reset(model)
     assert env.model.get_param("concurrent/paramsetprefix") == "testname"
+
+
+def test_parallel_configuring(model):
+    env = ecole.environment.ParallelConfiguring(reward_function=ecole.reward.NNodes(), n_threads=2)
+    configs = [{"branching/scorefunc": "s"}, ecole.scip.ParamSet({"branching/scorefunc": "p"})]
+    env.seed(0)
+    rewards, completed = env.evaluate(model, configs)
+    assert len(rewards) == 2
+    assert completed == [True, True]
+    assert all(r > 0 for r in rewards)
+    env.seed(0)
+    assert env.evaluate(model, configs)[0] == rewards
+
+
+def test_parallel_configuring_racing(model):
+    env = ecole.environment.ParallelConfiguring(n_threads=2, race_factor=1.0)
+    _, completed = env.evaluate(model, [{}, {"branching/scorefunc": "s"}])
+    assert any(completed)
+
+
+def test_checkpoint_restore(model):
+    """Restoring a checkpoint replays the episode to the same state."""
+    env = ecole.environment.Branching(observation_function=ecole.observation.Nothing())
+    env.seed(0)
+    _, action_set, _, done, _ = env.reset(model)
+    for _ in range(3):
+        _, action_set, _, done, _ = env.step(action_set[0])
+    checkpoint = env.checkpoint()
+    assert len(checkpoint.steps) == 3
+
+    other = ecole.environment.Branching(observation_function=ecole.observation.Nothing())
+    _, other_action_set, _, other_done, _ = other.restore(checkpoint)
+    assert other_done == done
+    assert list(other_action_set) == list(action_set)
+
+
+def test_checkpoint_restore_pipeline():
+    """Restoring a presolved pipeline episode replays it from the same presolved problem."""
+    generator = ecole.instance.SetCoverGenerator(n_rows=100, n_cols=200)
+    pipeline = ecole.instance.InstancePipeline(generator, presolve=True, seed=0)
+    env = ecole.environment.Branching(observation_function=ecole.observation.NodeBipartite())
+    env.seed(0)
+    obs, action_set, _, done, _ = env.reset(pipeline)
+    for _ in range(3):
+        if done:
+            break
+        obs, action_set, _, done, _ = env.step(action_set[0])
+
+    other = ecole.environment.Branching(observation_function=ecole.observation.NodeBipartite())
+    other_obs, other_action_set, _, other_done, _ = other.restore(env.checkpoint())
+    assert other_done == done
+    if not done:
+        assert list(other_action_set) == list(action_set)
+        assert np.array_equal(other_obs.column_features, obs.column_features, equal_nan=True)
+        assert np.array_equal(other_obs.row_features, obs.row_features, equal_nan=True)
+
+
+def test_fork(model):
+    """Forked environments continue independently from the same state."""
+    env = ecole.environment.Branching(observation_function=ecole.observation.Nothing())
+    _, action_set, _, _, _ = env.reset(model)
+    _, action_set, _, _, _ = env.step(action_set[0])
+
+    forks = [
+        ecole.environment.Branching(observation_function=ecole.observation.Nothing())
+        for _ in range(3)
+    ]
+    transitions = ecole.environment.fork(env.checkpoint(), forks)
+    for (_, fork_action_set, _, _, _), fork in zip(transitions, forks):
+        assert list(fork_action_set) == list(action_set)
+        fork.step(fork_action_set[-1])
+    assert len(forks[0].checkpoint().steps) == 2
+
+
+def test_random_engine_copy():
+    """Checkpoints keep independent copies of the random state."""
+    random_engine = ecole.RandomEngine(3)
+    copied = copy.copy(random_engine)
+    random_engine()
+    assert copied == ecole.RandomEngine(3)
+    assert pickle.loads(pickle.dumps(copied)) == copied
+
+
+def make_branching():
+    return ecole.environment.Branching(observation_function=ecole.observation.Nothing())
+
+
+def test_replay_engine_memoization(model):
+    """Extending a replayed sequence only replays the new actions."""
+    engine = ecole.environment.ReplayEngine(make_branching, capacity=4)
+    _, action_set, _, _, _ = engine.replay(model, 0, [])
+    actions = [action_set[0]]
+    _, action_set, _, _, _ = engine.replay(model, 0, actions)
+    assert engine.n_steps_replayed == 1
+
+    transition = engine.replay(model, 0, actions)
+    assert transition[1] is action_set
+    assert engine.n_steps_replayed == 1
+
+    engine.replay(model, 0, actions + [action_set[0]])
+    assert engine.n_steps_replayed == 2
+
+
+def test_replay_engine_deterministic(model):
+    """Replaying the same sequence from scratch gives the same state."""
+    engine = ecole.environment.ReplayEngine(make_branching)
+    _, action_set, _, _, _ = engine.replay(model, 0, [])
+    actions = [action_set[0]]
+    _, (_, first_action_set, _, _, _) = engine.checkout(model, 0, actions)
+    engine.clear()
+    _, (_, second_action_set, _, _, _) = engine.checkout(model, 0, actions)
+    assert list(first_action_set) == list(second_action_set)
+
+
+def test_replay_engine_warm(model):
+    """Many states can be prepared for sibling sequences, within the capacity."""
+    engine = ecole.environment.ReplayEngine(make_branching, capacity=2)
+    engine.warm(model, 0, [], n_copies=3)
+    assert len(engine) == 2
+    _, action_set, _, _, _ = engine.replay(model, 0, [])
+    engine.checkout(model, 0, [action_set[0]])
+    engine.checkout(model, 0, [action_set[-1]])
+    assert engine.n_steps_replayed == 2
+
+
+def test_replay_engine_releases_instances(model):
+    """Instances are only kept alive while their states are in the cache."""
+    engine = ecole.environment.ReplayEngine(make_branching, capacity=1)
+    first_model, other_model = model.copy_orig(), model.copy_orig()
+    first_ref, other_ref = weakref.ref(first_model), weakref.ref(other_model)
+    engine.replay(first_model, 0, [])
+    engine.replay(other_model, 0, [])
+    assert len(engine) == 1
+    del first_model, other_model
+    gc.collect()
+    assert first_ref() is None
+    assert other_ref() is not None
+    engine.checkout(other_ref(), 0, [])
+    gc.collect()
+    assert other_ref() is None
+
+
+def test_instrumentation(model):
+    """Timers of the episode are reset on every episode."""
+    env = ecole.environment.Branching()
+    for _ in range(2):
+        _, action_set, _, done, _ = env.reset(model)
+        if not done:
+            env.step(action_set[0])
+        stats = env.instrumentation.as_dict()
+        assert set(stats) == set(ecole.instrumentation.Stage.__members__)
+        if ecole.instrumentation.enabled:
+            assert stats["reset"]["count"] == 1
+            assert stats["step"]["count"] == (0 if done else 1)
+            assert stats["solve"]["total_time"] > 0
+        else:
+            assert all(timer["count"] == 0 for timer in stats.values())
+
+
+def test_tracing(model, tmp_path):
+    """Trace events are written as Chrome trace JSON."""
+    env = ecole.environment.Branching()
+    ecole.instrumentation.start_tracing()
+    _, action_set, _, done, _ = env.reset(model)
+    if not done:
+        env.step(action_set[0])
+    ecole.instrumentation.stop_tracing()
+    assert not ecole.instrumentation.tracing()
+
+    ecole.instrumentation.write_trace(str(tmp_path / "trace.json"))
+    with open(tmp_path / "trace.json") as file:
+        events = json.load(file)["traceEvents"]
+    names = {event["name"] for event in events}
+    if ecole.instrumentation.enabled:
+        assert {"reset", "solve", "Controller::wait_thread"} <= names
+    else:
+        assert len(events) == 0
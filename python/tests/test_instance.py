@@ -1,6 +1,6 @@
 """Test Ecole instance generators in Python.
 
-The instance generators are written in python.
+The instance generators are written in C++ and bound to Python.
 This file tests the instance generators with their default set of parameters.
 """
 
@@ -174,3 +174,39 @@ def test_IndependentSet_instance():
         assert model.getRhs(constraint) == 1
         for coef in model.getValsLinear(constraint).values():
             assert coef == 1
+
+
+def problem_text(model, tmp_path):
+    """Return the instance written in LP format to compare instances."""
+    path = tmp_path / "problem.lp"
+    model.write_problem(str(path))
+    return path.read_text()
+
+
+def test_pipeline_deterministic(tmp_path):
+    """Pipeline instances only depend on the seed."""
+    generator = ecole.instance.SetCoverGenerator(n_rows=100, n_cols=200)
+    sequential = ecole.instance.InstancePipeline(generator, n_threads=1, seed=3)
+    parallel = ecole.instance.InstancePipeline(generator, n_threads=3, buffer_size=4, seed=3)
+    for _ in range(4):
+        assert problem_text(next(sequential), tmp_path) == problem_text(next(parallel), tmp_path)
+
+
+def test_pipeline_python_iterator():
+    """Any iterator of models can be prefetched."""
+
+    def models():
+        for _ in range(3):
+            yield ecole.scip.Model.prob_basic()
+
+    instances = list(ecole.instance.InstancePipeline(models(), buffer_size=2))
+    assert len(instances) == 3
+    assert all(isinstance(instance, ecole.scip.Model) for instance in instances)
+
+
+def test_pipeline_presolve():
+    """Instances can be presolved ahead of time and solved afterward."""
+    generator = ecole.instance.SetCoverGenerator(n_rows=100, n_cols=200)
+    model = next(ecole.instance.InstancePipeline(generator, presolve=True, seed=0))
+    model.solve()
+    assert model.is_solved()
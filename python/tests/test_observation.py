@@ -26,6 +26,8 @@ def pytest_generate_tests(metafunc):
             ecole.observation.StrongBranchingScores(False),
             ecole.observation.Pseudocosts(),
             ecole.observation.Khalil2016(),
+            ecole.observation.HeuristicStats(),
+            ecole.observation.CutPool(),
         )
         metafunc.parametrize("observation_function", all_observation_functions)
 
@@ -103,3 +105,41 @@ def test_Khalil2016_observatio(model):
     """Observation of Khalil2016 is a numpy matrix."""
     obs = make_obs(ecole.observation.Khalil2016(), model)
     assert_array(obs, ndim=2)
+
+
+def test_NodeBipartite_column_feature_groups(model):
+    """Only the column features of the given groups are in the observation."""
+    Group = ecole.observation.NodeBipartite.ColumnFeatureGroup
+    obs_func = ecole.observation.NodeBipartite(column_feature_groups=[Group.objective, Group.type])
+    Features = ecole.observation.NodeBipartiteObs.ColumnFeatures
+    assert obs_func.column_features[0] == Features.objective
+    obs = make_obs(obs_func, model)
+    assert obs.column_features.shape[1] == len(obs_func.column_features) == 5
+    assert obs.row_features.shape[1] == 5
+
+
+def test_Khalil2016_feature_groups(model):
+    """Only the features of the given groups are in the observation."""
+    Group = ecole.observation.Khalil2016.FeatureGroup
+    obs_func = ecole.observation.Khalil2016(feature_groups=[Group.obj_coef, Group.pseudocosts])
+    assert len(ecole.observation.Khalil2016().features) == 72
+    obs = make_obs(obs_func, model)
+    assert obs.shape[1] == len(obs_func.features) == 8
+
+
+def test_HeuristicStats_observation(model):
+    """Observation of HeuristicStats is a numpy matrix."""
+    obs = make_obs(ecole.observation.HeuristicStats(), model)
+    assert_array(obs, ndim=2)
+    assert obs.shape[1] == len(ecole.observation.HeuristicStats.Features.__members__)
+
+
+def test_CutPool_observation(model):
+    """Observation of CutPool is a type with array attributes."""
+    ecole.observation.CutPool().before_reset(model)
+    ecole.dynamics.CutSelectionDynamics().reset_dynamics(model)
+    obs = ecole.observation.CutPool().extract(model, False)
+    assert isinstance(obs, ecole.observation.CutPoolObs)
+    assert_array(obs.cut_features, ndim=2)
+    assert_array(obs.coefficients.values)
+    assert len(ecole.observation.CutPoolObs.CutFeatures.__members__) == 6
@@ -0,0 +1,113 @@
+"""Test policy utilities."""
+
+import datetime
+import threading
+
+import pytest
+
+import ecole.environment
+import ecole.policy
+
+
+def test_policy_bridge_batches():
+    """Queries from many threads are evaluated in batches."""
+    batches = []
+
+    def policy(requests):
+        batches.append(len(requests))
+        return [observation * 2 for observation, _ in requests]
+
+    bridge = ecole.policy.PolicyBridge(policy, batch_size=4, timeout=datetime.timedelta(seconds=1))
+    results = [None] * 8
+
+    def query(i):
+        results[i] = bridge.query(i)
+
+    threads = [threading.Thread(target=query, args=(i,)) for i in range(8)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert results == [2 * i for i in range(8)]
+    assert sum(batches) == 8
+    stats = bridge.stats()
+    assert sum(size * count for size, count in enumerate(stats["batch_sizes"])) == 8
+    assert sum(stats["queue_latencies"]) == 8
+
+
+def test_policy_bridge_branching(model):
+    """Actions are returned to environments."""
+    bridge = ecole.policy.PolicyBridge(
+        lambda requests: [action_set[0] for _, action_set in requests], batch_size=2
+    )
+    env = ecole.environment.Branching()
+    obs, action_set, _, done, _ = env.reset(model)
+    for _ in range(3):
+        if done:
+            break
+        obs, action_set, _, done, _ = env.step(bridge.query(obs, action_set))
+
+
+def test_policy_bridge_errors():
+    """Errors in the policy are raised in the querying thread."""
+
+    def policy(requests):
+        raise ValueError("error")
+
+    bridge = ecole.policy.PolicyBridge(policy, batch_size=1)
+    with pytest.raises(ValueError):
+        bridge.query(0)
+
+
+def test_policy_bridge_errors_batch():
+    """Errors in the policy are raised in all the querying threads of the batch."""
+
+    def policy(requests):
+        raise ValueError("error")
+
+    bridge = ecole.policy.PolicyBridge(policy, batch_size=4, timeout=datetime.timedelta(seconds=1))
+    errors = [None] * 4
+
+    def query(i):
+        try:
+            bridge.query(i)
+        except ValueError as error:
+            errors[i] = str(error)
+
+    threads = [threading.Thread(target=query, args=(i,)) for i in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert errors == ["error"] * 4
+
+
+
+def test_episode_runner(problem_file):
+    """Episodes are run in parallel with actions from the bridge, and results are ordered."""
+    bridge = ecole.policy.PolicyBridge(
+        lambda requests: [action_set[0] for _, action_set in requests], batch_size=2
+    )
+    runner = ecole.policy.EpisodeRunner(ecole.environment.Branching, bridge, n_threads=2, seed=3)
+    results = runner.run(lambda episode: str(problem_file), 3)
+    assert [result["episode"] for result in results] == [0, 1, 2]
+    for result in results:
+        assert result["error"] is None
+        assert result["done"]
+        assert not result["time_limit_reached"]
+
+
+def test_episode_runner_errors(problem_file):
+    """Errors in the policy are reported in the results, and results are streamed."""
+
+    def policy(requests):
+        raise ValueError("error")
+
+    bridge = ecole.policy.PolicyBridge(policy, batch_size=1)
+    runner = ecole.policy.EpisodeRunner(ecole.environment.Branching, bridge, n_threads=2)
+    results = []
+    runner.run(lambda episode: str(problem_file), 2, callback=results.append)
+    assert sorted(result["episode"] for result in results) == [0, 1]
+    assert all(isinstance(result["error"], ValueError) for result in results)
@@ -36,3 +36,22 @@ def test_spawn_engine():
     random_engine_1 = ecole.spawn_random_engine()
     random_engine_2 = ecole.spawn_random_engine()
     assert random_engine_1 != random_engine_2
+
+
+def test_spawn_engine_with_id():
+    """Random engines with the same id are the same regardless of order."""
+    ecole.seed(0)
+    random_engine_1 = ecole.spawn_random_engine(1)
+    random_engine_2 = ecole.spawn_random_engine(2)
+    ecole.seed(0)
+    assert ecole.spawn_random_engine(2) == random_engine_2
+    assert ecole.spawn_random_engine(1) == random_engine_1
+
+
+def test_split_engine():
+    """Split random engines only depend on the id."""
+    random_engine = ecole.RandomEngine(42)
+    split = random_engine.split(3)
+    random_engine()
+    assert random_engine.split(3) == split
+    assert random_engine.split(4) != split
@@ -24,6 +24,7 @@ def pytest_generate_tests(metafunc):
             ecole.reward.Constant(),
             ecole.reward.IsDone(),
             ecole.reward.LpIterations(),
+            ecole.reward.DualBound(),
         )
         metafunc.parametrize("reward_function", all_reward_functions)
 
@@ -110,3 +111,59 @@ def test_cumsum(reward_function, model, model_copy):
 
     assert cum_reward1 == reward1
     assert cum_reward2 == reward1 + reward2
+
+
+def test_deepcopy():
+    """Reward functions are copied with their internal state."""
+    import copy
+
+    reward_func = ecole.reward.NNodes() + 3
+    assert copy.deepcopy(reward_func) is not reward_func
+    assert isinstance(copy.deepcopy(ecole.reward.SolvingTime().cumsum()), ecole.reward.Cumulative)
+
+
+def test_bounds(model):
+    """Bounds are tracked from before the reset."""
+    primal_bound = ecole.reward.PrimalBound()
+    dual_bound = ecole.reward.DualBound()
+    primal_bound.before_reset(model)
+    dual_bound.before_reset(model)
+    advance_to_root_node(model)
+    assert dual_bound.extract(model) <= primal_bound.extract(model)
+
+
+def test_PrimalDualIntegral(model):
+    """The primal-dual integral is zero before solving and positive after."""
+    reward_function = ecole.reward.PrimalDualIntegral()
+    reward_function.before_reset(model)
+    assert reward_function.extract(model) == 0
+    advance_to_root_node(model)
+    assert reward_function.extract(model) > 0
+
+
+def test_bounds_solved(model):
+    """Bounds and gap are the ones of SCIP once solved."""
+    primal_bound = ecole.reward.PrimalBound()
+    dual_bound = ecole.reward.DualBound()
+    integral = ecole.reward.PrimalDualIntegral()
+    for reward_function in (primal_bound, dual_bound, integral):
+        reward_function.before_reset(model)
+    model.solve()
+    assert model.is_solved()
+    assert dual_bound.extract(model, True) == primal_bound.extract(model, True)
+    integral.extract(model, True)
+    assert integral.extract(model, True) == 0
+
+
+def test_bounds_presolved():
+    """Bounds are tracked on presolved pipeline instances."""
+    generator = ecole.instance.SetCoverGenerator(n_rows=100, n_cols=200)
+    model = next(ecole.instance.InstancePipeline(generator, presolve=True, seed=0))
+    primal_bound = ecole.reward.PrimalBound()
+    dual_bound = ecole.reward.DualBound()
+    integral = ecole.reward.PrimalDualIntegral()
+    for reward_function in (primal_bound, dual_bound, integral):
+        reward_function.before_reset(model)
+    assert integral.extract(model) == 0
+    model.solve()
+    assert dual_bound.extract(model, True) == primal_bound.extract(model, True)
@@ -120,3 +120,30 @@ def test_set_params(model):
 
     for name, _ in names_types:
         assert model.get_param(name) == params[name]
+
+
+def test_param_set_resolve():
+    param_set = ecole.scip.ParamSet({"branching/scorefunc": "s", "conflict/lpiterations": 0.0})
+    assert len(param_set) == 2
+    assert param_set.to_dict() == {"branching/scorefunc": "s", "conflict/lpiterations": 0}
+
+
+def test_param_set_validate():
+    with pytest.raises(ecole.scip.Exception):
+        ecole.scip.ParamSet({"not/a/param": 3})
+    with pytest.raises(ecole.scip.Exception):
+        ecole.scip.ParamSet({"conflict/minmaxvars": -3})
+
+
+def test_param_set_apply(model):
+    param_set = ecole.scip.ParamSet({"branching/scorefunc": "s"}, model)
+    param_set.apply(model)
+    assert model.get_param("branching/scorefunc") == "s"
+
+
+def test_param_set_hash_diff():
+    param_set_1 = ecole.scip.ParamSet({"branching/scorefunc": "s", "conflict/minmaxvars": 3})
+    param_set_2 = ecole.scip.ParamSet({"branching/scorefunc": "p", "conflict/minmaxvars": 3.0})
+    assert param_set_1 == ecole.scip.ParamSet(param_set_1.to_dict())
+    assert len({param_set_1, param_set_2, ecole.scip.ParamSet(param_set_1.to_dict())}) == 2
+    assert param_set_2.diff(param_set_1).to_dict() == {"branching/scorefunc": "p"}
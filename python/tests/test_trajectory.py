@@ -0,0 +1,95 @@
+"""Test recording and reading trajectories."""
+
+import numpy as np
+import pytest
+
+import ecole.environment
+import ecole.observation
+import ecole.trajectory
+
+
+def test_write_read(tmp_path):
+    """Records can be read back in order across chunks."""
+    with ecole.trajectory.TrajectoryWriter(str(tmp_path), chunk_size=2) as writer:
+        for i in range(5):
+            writer.write(reward=float(i), action_set=np.arange(i + 1))
+
+    reader = ecole.trajectory.TrajectoryReader(tmp_path)
+    assert len(reader) == 5
+    for i, step in enumerate(reader):
+        assert step["reward"] == i
+        assert np.array_equal(step["action_set"], np.arange(i + 1))
+
+
+def test_signed_integers(tmp_path):
+    """Negative integers are recorded as is."""
+    with ecole.trajectory.TrajectoryWriter(str(tmp_path)) as writer:
+        writer.write(action=-1, mask=np.array([True, False]))
+    step = ecole.trajectory.TrajectoryReader(tmp_path)[0]
+    assert step["action"] == -1
+    assert np.array_equal(step["mask"], [1, 0])
+
+
+def test_read_is_memory_mapped(tmp_path):
+    """Arrays returned by the reader are views on the files."""
+    with ecole.trajectory.TrajectoryWriter(str(tmp_path)) as writer:
+        writer.write(features=np.ones((3, 4)))
+    step = ecole.trajectory.TrajectoryReader(tmp_path)[0]
+    assert step["features"].shape == (3, 4)
+    assert not step["features"].flags.owndata
+
+
+def test_inconsistent_records(tmp_path):
+    """Columns must keep the same type and trailing shape inside a chunk."""
+    writer = ecole.trajectory.TrajectoryWriter(str(tmp_path))
+    writer.write(features=np.ones((3, 4)))
+    writer.write(features=np.ones((3, 5)))
+    with pytest.raises(ecole.core.Exception):
+        writer.flush()
+
+
+def test_write_observations(tmp_path, model):
+    """Ecole observations are recorded as multiple columns."""
+    env = ecole.environment.Branching(observation_function=ecole.observation.NodeBipartite())
+    obs, action_set, reward, done, _ = env.reset(model)
+    first_obs = obs
+    with ecole.trajectory.TrajectoryWriter(str(tmp_path)) as writer:
+        while not done:
+            writer.write(obs=obs, action_set=action_set, reward=reward)
+            obs, action_set, reward, done, _ = env.step(action_set[0])
+
+    step = ecole.trajectory.TrajectoryReader(tmp_path)[0]
+    assert step["obs.column_features"].shape == first_obs.column_features.shape
+    assert step["obs.edge_features.indices"].shape[1] == 2
+    assert len(step["obs.edge_features.values"]) == len(step["obs.edge_features.indices"])
+
+
+def test_environment_record(tmp_path, model):
+    """Environments record the state, action set, action, and reward of every step."""
+    env = ecole.environment.Branching(observation_function=ecole.observation.NodeBipartite())
+    with ecole.trajectory.TrajectoryWriter(str(tmp_path)) as writer:
+        env.record(writer)
+        obs, action_set, _, done, _ = env.reset(model)
+        first_obs, first_action_set = obs, np.array(action_set)
+        n_steps = 0
+        while not done:
+            obs, action_set, _, done, _ = env.step(action_set[0])
+            n_steps += 1
+        env.record(None)
+
+    reader = ecole.trajectory.TrajectoryReader(tmp_path)
+    assert len(reader) == n_steps
+    assert np.array_equal(reader[0]["action_set"], first_action_set)
+    assert reader[0]["action"] == first_action_set[0]
+    assert np.array_equal(
+        reader[0]["obs.column_features"], first_obs.column_features, equal_nan=True
+    )
+
+
+def test_chunks_are_read_in_numeric_order(tmp_path):
+    """Chunk numbers are compared as integers."""
+    with ecole.trajectory.TrajectoryWriter(str(tmp_path), chunk_size=1) as writer:
+        for i in range(12):
+            writer.write(step=i)
+    reader = ecole.trajectory.TrajectoryReader(tmp_path)
+    assert [int(step["step"]) for step in reader] == list(range(12))
@@ -0,0 +1,41 @@
+"""Test environments running in worker processes."""
+
+import numpy as np
+import pytest
+
+import ecole
+import ecole.worker
+
+
+def make_environment():
+    return ecole.environment.Branching(observation_function=ecole.observation.NodeBipartite())
+
+
+def test_worker_transitions(model):
+    """Transitions are the same as in the current process."""
+    env = make_environment()
+    env.seed(0)
+    obs, action_set, _, done, _ = env.reset(model)
+
+    with ecole.worker.WorkerEnvironment(make_environment) as worker_env:
+        worker_env.seed(0)
+        worker_obs, worker_action_set, _, worker_done, _ = worker_env.reset(model)
+        assert isinstance(worker_obs, ecole.worker.SharedNodeBipartiteObs)
+        assert worker_done == done
+        assert np.array_equal(worker_action_set, action_set)
+        assert np.array_equal(worker_obs.column_features, obs.column_features)
+        assert np.array_equal(worker_obs.edge_features.indices, obs.edge_features.indices)
+
+        obs, action_set, _, done, _ = env.step(action_set[0])
+        worker_obs, worker_action_set, _, worker_done, _ = worker_env.step(worker_action_set[0])
+        assert worker_done == done
+        assert np.array_equal(worker_obs.row_features, obs.row_features)
+
+
+def test_worker_errors(model):
+    """Errors in the worker are raised in the parent process."""
+    with ecole.worker.WorkerEnvironment(make_environment, slot_size=64) as worker_env:
+        with pytest.raises(ecole.core.Exception):
+            worker_env.reset(model)
+        with pytest.raises(Exception):
+            worker_env.step(0)